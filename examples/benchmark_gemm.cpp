@@ -0,0 +1,93 @@
+// Benchmark of the built-in (emulated) matrix multiplication versus BLAS.
+// 
+// Example build command (adjust as required):
+// g++ benchmark_gemm.cpp -o benchmark_gemm -O2 -std=c++11 -I ../include -DARMA_DONT_USE_WRAPPER -lopenblas
+
+#include <iostream>
+#include <armadillo>
+
+using namespace std;
+using namespace arma;
+
+
+template<typename eT>
+double
+time_gemm_emul(const Mat<eT>& A, const Mat<eT>& B, const uword n_reps)
+  {
+  Mat<eT> C(A.n_rows, B.n_cols);
+  
+  wall_clock timer;
+  
+  timer.tic();
+  
+  for(uword i=0; i < n_reps; ++i)  { gemm_emul<>::apply(C, A, B); }
+  
+  return timer.toc() / double(n_reps);
+  }
+
+
+template<typename eT>
+double
+time_gemm_emul_large(const Mat<eT>& A, const Mat<eT>& B, const uword n_reps)
+  {
+  Mat<eT> C(A.n_rows, B.n_cols);
+  
+  wall_clock timer;
+  
+  timer.tic();
+  
+  for(uword i=0; i < n_reps; ++i)  { gemm_emul_large<>::apply(C, A, B); }
+  
+  return timer.toc() / double(n_reps);
+  }
+
+
+template<typename eT>
+double
+time_gemm_blas(const Mat<eT>& A, const Mat<eT>& B, const uword n_reps)
+  {
+  Mat<eT> C(A.n_rows, B.n_cols);
+  
+  wall_clock timer;
+  
+  timer.tic();
+  
+  for(uword i=0; i < n_reps; ++i)  { gemm<>::apply_blas_type(C, A, B); }
+  
+  return timer.toc() / double(n_reps);
+  }
+
+
+int
+main(int argc, char** argv)
+  {
+  const uword sizes[] = { 32, 64, 128, 256, 512, 1024 };
+  
+  cout << "size  blas(double)  blocked(double)  naive(double)  blocked(float)  blocked(s32)  naive(s32)" << endl;
+  
+  for(uword k=0; k < sizeof(sizes)/sizeof(uword); ++k)
+    {
+    const uword N      = sizes[k];
+    const uword n_reps = (std::max)(uword(1), uword(256*256*256) / (N*N*N));
+    
+    mat A = randn<mat>(N,N);
+    mat B = randn<mat>(N,N);
+    
+    fmat fA = conv_to<fmat>::from(A);
+    fmat fB = conv_to<fmat>::from(B);
+    
+    Mat<s32> iA = randi< Mat<s32> >(N, N, distr_param(-100,100));
+    Mat<s32> iB = randi< Mat<s32> >(N, N, distr_param(-100,100));
+    
+    cout << N
+         << "  " << time_gemm_blas(A, B, n_reps)
+         << "  " << time_gemm_emul(A, B, n_reps)
+         << "  " << time_gemm_emul_large(A, B, n_reps)
+         << "  " << time_gemm_emul(fA, fB, n_reps)
+         << "  " << time_gemm_emul(iA, iB, n_reps)
+         << "  " << time_gemm_emul_large(iA, iB, n_reps)
+         << endl;
+    }
+  
+  return 0;
+  }
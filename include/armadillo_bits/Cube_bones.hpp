@@ -167,8 +167,14 @@ class Cube : public BaseCube< eT, Cube<eT> >
   template<typename T1> arma_inline const subview_elem1<eT,T1> operator()(const Base<uword,T1>& a) const;
   
   
+  #if defined(ARMA_USE_CXX11)
+  arma_inline       subview_cube_each1<eT> each_slice() &;
+  arma_inline const subview_cube_each1<eT> each_slice() const &;
+  arma_inline       subview_cube_each1<eT> each_slice() &&;  //!< the memory of the temporary cube can be reused by the result
+  #else
   arma_inline       subview_cube_each1<eT> each_slice();
   arma_inline const subview_cube_each1<eT> each_slice() const;
+  #endif
   
   template<typename T1> inline       subview_cube_each2<eT, T1> each_slice(const Base<uword, T1>& indices);
   template<typename T1> inline const subview_cube_each2<eT, T1> each_slice(const Base<uword, T1>& indices) const;
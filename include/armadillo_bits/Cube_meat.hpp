@@ -1743,6 +1743,46 @@ Cube<eT>::operator()(const Base<uword,T1>& a) const
 
 
 
+#if defined(ARMA_USE_CXX11)
+
+template<typename eT>
+arma_inline
+subview_cube_each1<eT>
+Cube<eT>::each_slice() &
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_cube_each1<eT>(*this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+const subview_cube_each1<eT>
+Cube<eT>::each_slice() const &
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_cube_each1<eT>(*this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+subview_cube_each1<eT>
+Cube<eT>::each_slice() &&
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_cube_each1<eT>(*this, true);
+  }
+
+
+
+#else
+
 template<typename eT>
 arma_inline
 subview_cube_each1<eT>
@@ -1767,6 +1807,10 @@ Cube<eT>::each_slice() const
 
 
 
+#endif
+
+
+
 template<typename eT>
 template<typename T1>
 inline
@@ -262,11 +262,22 @@ class Mat : public Base< eT, Mat<eT> >
   template<typename T2> arma_inline const subview_elem2<eT,T2,T2> cols(const Base<uword,T2>& ci) const;
   
   
+  #if defined(ARMA_USE_CXX11)
+  arma_inline       subview_each1< Mat<eT>, 0 > each_col() &;
+  arma_inline       subview_each1< Mat<eT>, 1 > each_row() &;
+  
+  arma_inline const subview_each1< Mat<eT>, 0 > each_col() const &;
+  arma_inline const subview_each1< Mat<eT>, 1 > each_row() const &;
+  
+  arma_inline       subview_each1< Mat<eT>, 0 > each_col() &&;  //!< the memory of the temporary matrix can be reused by the result
+  arma_inline       subview_each1< Mat<eT>, 1 > each_row() &&;
+  #else
   arma_inline       subview_each1< Mat<eT>, 0 > each_col();
   arma_inline       subview_each1< Mat<eT>, 1 > each_row();
   
   arma_inline const subview_each1< Mat<eT>, 0 > each_col() const;
   arma_inline const subview_each1< Mat<eT>, 1 > each_row() const;
+  #endif
   
   template<typename T1> inline       subview_each2< Mat<eT>, 0, T1 > each_col(const Base<uword, T1>& indices);
   template<typename T1> inline       subview_each2< Mat<eT>, 1, T1 > each_row(const Base<uword, T1>& indices);
@@ -743,6 +754,7 @@ class Mat : public Base< eT, Mat<eT> >
   friend class op_mean;
   friend class op_max;
   friend class op_min;
+  friend class batch_linalg;
 
   
   public:
@@ -3753,6 +3753,82 @@ Mat<eT>::cols(const Base<uword,T2>& ci) const
 
 
 
+#if defined(ARMA_USE_CXX11)
+
+template<typename eT>
+arma_inline
+subview_each1< Mat<eT>, 0 >
+Mat<eT>::each_col() &
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_each1< Mat<eT>, 0>(*this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+subview_each1< Mat<eT>, 1 >
+Mat<eT>::each_row() &
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_each1< Mat<eT>, 1>(*this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+const subview_each1< Mat<eT>, 0 >
+Mat<eT>::each_col() const &
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_each1< Mat<eT>, 0>(*this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+const subview_each1< Mat<eT>, 1 >
+Mat<eT>::each_row() const &
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_each1< Mat<eT>, 1>(*this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+subview_each1< Mat<eT>, 0 >
+Mat<eT>::each_col() &&
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_each1< Mat<eT>, 0>(*this, true);
+  }
+
+
+
+template<typename eT>
+arma_inline
+subview_each1< Mat<eT>, 1 >
+Mat<eT>::each_row() &&
+  {
+  arma_extra_debug_sigprint();
+  
+  return subview_each1< Mat<eT>, 1>(*this, true);
+  }
+
+
+
+#else
+
 template<typename eT>
 arma_inline
 subview_each1< Mat<eT>, 0 >
@@ -3801,6 +3877,10 @@ Mat<eT>::each_row() const
 
 
 
+#endif
+
+
+
 template<typename eT>
 template<typename T1>
 inline
@@ -631,6 +631,230 @@ class Proxy< Glue<T1, T2, glue_type> >
 
 
 
+//! join_rows() and join_cols() are not evaluated;
+//! elements are obtained directly from the two operands, without materialising the concatenation
+
+template<typename T1, typename T2>
+class Proxy< Glue<T1, T2, glue_join_rows> >
+  {
+  public:
+  
+  typedef typename T1::elem_type                   elem_type;
+  typedef typename get_pod_type<elem_type>::result pod_type;
+  typedef Glue<T1, T2, glue_join_rows>             stored_type;
+  typedef const Proxy<stored_type>&                ea_type;
+  typedef const Proxy<stored_type>&                aligned_ea_type;
+  
+  static const bool use_at      = true;
+  static const bool use_mp      = (Proxy<T1>::use_mp || Proxy<T2>::use_mp);
+  static const bool has_subview = true;   // the result has a different size than the operands, so aliasing must always be detected
+  static const bool fake_mat    = false;
+  
+  static const bool is_row = Glue<T1, T2, glue_join_rows>::is_row;
+  static const bool is_col = Glue<T1, T2, glue_join_rows>::is_col;
+  
+  arma_aligned const Glue<T1, T2, glue_join_rows>& Q;
+  arma_aligned const Proxy<T1>                     PA;
+  arma_aligned const Proxy<T2>                     PB;
+  
+  const uword n_rows;
+  const uword A_n_cols;
+  const uword n_cols;
+  
+  inline explicit Proxy(const Glue<T1, T2, glue_join_rows>& X)
+    : Q       (X)
+    , PA      (X.A)
+    , PB      (X.B)
+    , n_rows  ( (std::max)(PA.get_n_rows(), PB.get_n_rows()) )
+    , A_n_cols( PA.get_n_cols() )
+    , n_cols  ( PA.get_n_cols() + PB.get_n_cols() )
+    {
+    arma_extra_debug_sigprint();
+    
+    const uword A_n_rows = PA.get_n_rows();
+    const uword B_n_rows = PB.get_n_rows();
+    
+    arma_debug_check
+      (
+      ( (A_n_rows != B_n_rows) && ( (A_n_rows > 0) || (A_n_cols > 0) ) && ( (B_n_rows > 0) || (PB.get_n_cols() > 0) ) ),
+      "join_rows() / join_horiz(): number of rows must be the same"
+      );
+    }
+  
+  arma_inline uword get_n_rows() const { return is_row ? 1 : n_rows; }
+  arma_inline uword get_n_cols() const { return is_col ? 1 : n_cols; }
+  arma_inline uword get_n_elem() const { return n_rows * n_cols;     }
+  
+  arma_inline elem_type at(const uword row, const uword col) const
+    {
+    return (col < A_n_cols) ? PA.at(row, col) : PB.at(row, col - A_n_cols);
+    }
+  
+  arma_inline elem_type operator[] (const uword i) const { return (*this).at(i % n_rows, i / n_rows); }
+  arma_inline elem_type at_alt     (const uword i) const { return (*this).at(i % n_rows, i / n_rows); }
+  
+  arma_inline         ea_type         get_ea() const { return *this; }
+  arma_inline aligned_ea_type get_aligned_ea() const { return *this; }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return (PA.is_alias(X) || PB.is_alias(X)); }
+  
+  template<typename eT2>
+  arma_inline bool has_overlap(const subview<eT2>& X) const { return (PA.has_overlap(X) || PB.has_overlap(X)); }
+  
+  arma_inline bool is_aligned() const { return false; }
+  };
+
+
+
+template<typename T1, typename T2>
+class Proxy< Glue<T1, T2, glue_join_cols> >
+  {
+  public:
+  
+  typedef typename T1::elem_type                   elem_type;
+  typedef typename get_pod_type<elem_type>::result pod_type;
+  typedef Glue<T1, T2, glue_join_cols>             stored_type;
+  typedef const Proxy<stored_type>&                ea_type;
+  typedef const Proxy<stored_type>&                aligned_ea_type;
+  
+  static const bool use_at      = true;
+  static const bool use_mp      = (Proxy<T1>::use_mp || Proxy<T2>::use_mp);
+  static const bool has_subview = true;
+  static const bool fake_mat    = false;
+  
+  static const bool is_row = Glue<T1, T2, glue_join_cols>::is_row;
+  static const bool is_col = Glue<T1, T2, glue_join_cols>::is_col;
+  
+  arma_aligned const Glue<T1, T2, glue_join_cols>& Q;
+  arma_aligned const Proxy<T1>                     PA;
+  arma_aligned const Proxy<T2>                     PB;
+  
+  const uword A_n_rows;
+  const uword n_rows;
+  const uword n_cols;
+  
+  inline explicit Proxy(const Glue<T1, T2, glue_join_cols>& X)
+    : Q       (X)
+    , PA      (X.A)
+    , PB      (X.B)
+    , A_n_rows( PA.get_n_rows() )
+    , n_rows  ( PA.get_n_rows() + PB.get_n_rows() )
+    , n_cols  ( (std::max)(PA.get_n_cols(), PB.get_n_cols()) )
+    {
+    arma_extra_debug_sigprint();
+    
+    const uword A_n_cols = PA.get_n_cols();
+    const uword B_n_cols = PB.get_n_cols();
+    
+    arma_debug_check
+      (
+      ( (A_n_cols != B_n_cols) && ( (A_n_rows > 0) || (A_n_cols > 0) ) && ( (PB.get_n_rows() > 0) || (B_n_cols > 0) ) ),
+      "join_cols() / join_vert(): number of columns must be the same"
+      );
+    }
+  
+  arma_inline uword get_n_rows() const { return is_row ? 1 : n_rows; }
+  arma_inline uword get_n_cols() const { return is_col ? 1 : n_cols; }
+  arma_inline uword get_n_elem() const { return n_rows * n_cols;     }
+  
+  arma_inline elem_type at(const uword row, const uword col) const
+    {
+    return (row < A_n_rows) ? PA.at(row, col) : PB.at(row - A_n_rows, col);
+    }
+  
+  arma_inline elem_type operator[] (const uword i) const { return (*this).at(i % n_rows, i / n_rows); }
+  arma_inline elem_type at_alt     (const uword i) const { return (*this).at(i % n_rows, i / n_rows); }
+  
+  arma_inline         ea_type         get_ea() const { return *this; }
+  arma_inline aligned_ea_type get_aligned_ea() const { return *this; }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return (PA.is_alias(X) || PB.is_alias(X)); }
+  
+  template<typename eT2>
+  arma_inline bool has_overlap(const subview<eT2>& X) const { return (PA.has_overlap(X) || PB.has_overlap(X)); }
+  
+  arma_inline bool is_aligned() const { return false; }
+  };
+
+
+
+//! repmat() is not evaluated; the operand is unwrapped once and its elements are indexed cyclically,
+//! via tables of row indices and column offsets (computed once, so that at() does not need a modulus)
+
+template<typename T1>
+class Proxy< Op<T1, op_repmat> >
+  {
+  public:
+  
+  typedef typename T1::elem_type                   elem_type;
+  typedef typename get_pod_type<elem_type>::result pod_type;
+  typedef Op<T1, op_repmat>                        stored_type;
+  typedef const Proxy<stored_type>&                ea_type;
+  typedef const Proxy<stored_type>&                aligned_ea_type;
+  
+  static const bool use_at      = true;
+  static const bool use_mp      = false;
+  static const bool has_subview = true;
+  static const bool fake_mat    = false;
+  
+  static const bool is_row = false;
+  static const bool is_col = false;
+  
+  arma_aligned const Op<T1, op_repmat>& Q;
+  arma_aligned const quasi_unwrap<T1>   U;
+  
+  const uword n_rows;
+  const uword n_cols;
+  
+  podarray<uword> row_index;
+  podarray<uword> col_offset;
+  
+  inline explicit Proxy(const Op<T1, op_repmat>& X)
+    : Q     (X)
+    , U     (X.m)
+    , n_rows(U.M.n_rows * X.aux_uword_a)
+    , n_cols(U.M.n_cols * X.aux_uword_b)
+    {
+    arma_extra_debug_sigprint();
+    
+    row_index.set_size(n_rows);
+    col_offset.set_size(n_cols);
+    
+    const uword A_n_rows = U.M.n_rows;
+    const uword A_n_cols = U.M.n_cols;
+    
+    for(uword i=0; i < n_rows; ++i)  { row_index[i]  = i % A_n_rows;             }
+    for(uword i=0; i < n_cols; ++i)  { col_offset[i] = (i % A_n_cols) * A_n_rows; }
+    }
+  
+  arma_inline uword get_n_rows() const { return n_rows;          }
+  arma_inline uword get_n_cols() const { return n_cols;          }
+  arma_inline uword get_n_elem() const { return n_rows * n_cols; }
+  
+  arma_inline elem_type at(const uword row, const uword col) const
+    {
+    return U.M.mem[ row_index[row] + col_offset[col] ];
+    }
+  
+  arma_inline elem_type operator[] (const uword i) const { return (*this).at(i % n_rows, i / n_rows); }
+  arma_inline elem_type at_alt     (const uword i) const { return (*this).at(i % n_rows, i / n_rows); }
+  
+  arma_inline         ea_type         get_ea() const { return *this; }
+  arma_inline aligned_ea_type get_aligned_ea() const { return *this; }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return U.is_alias(X); }
+  
+  template<typename eT2>
+  arma_inline bool has_overlap(const subview<eT2>& X) const { return U.is_alias(X.m); }
+  
+  arma_inline bool is_aligned() const { return false; }
+  };
+
+
+
 template<typename out_eT, typename T1, typename op_type>
 class Proxy< mtOp<out_eT, T1, op_type> >
   {
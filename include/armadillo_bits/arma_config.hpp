@@ -161,6 +161,13 @@ struct arma_config
   #else
     static const bool openmp = false;
   #endif
+  
+  
+  #if defined(ARMA_USE_COMPENSATED_SUM)
+    static const bool compensated_sum = true;
+  #else
+    static const bool compensated_sum = false;
+  #endif
   };
 
 
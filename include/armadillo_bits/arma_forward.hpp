@@ -86,6 +86,7 @@ class op_arg;
 class op_diagmat;
 class op_trimat;
 class op_diagvec;
+class op_repmat;
 class op_vectorise_col;
 class op_normalise_vec;
 class op_clamp;
@@ -170,6 +171,9 @@ class glue_hist_default;
 class glue_histc;
 class glue_histc_default;
 
+class glue_quantile;
+class glue_quantile_default;
+
 class op_cx_scalar_times;
 class op_cx_scalar_plus;
 class op_cx_scalar_minus_pre;
@@ -219,6 +223,9 @@ template<typename T1> class ProxyCube;
 
 template<typename T1> class diagmat_proxy;
 
+template<typename T1> struct partial_unwrap;
+template<typename T1> struct quasi_unwrap;
+
 class spop_strans;
 class spop_htrans;
 class spop_scalar_times;
@@ -20,11 +20,18 @@
 
 #if defined(ARMA_RNG_ALT)
   #undef ARMA_USE_EXTERN_CXX11_RNG
+  #undef ARMA_USE_PHILOX_RNG
 #endif
 
 
 #if !defined(ARMA_USE_CXX11)
   #undef ARMA_USE_EXTERN_CXX11_RNG
+  #undef ARMA_USE_PHILOX_RNG
+#endif
+
+
+#if defined(ARMA_USE_PHILOX_RNG)
+  #undef ARMA_USE_EXTERN_CXX11_RNG
 #endif
 
 
@@ -40,6 +47,8 @@ class arma_rng
   
   #if   defined(ARMA_RNG_ALT)
     typedef arma_rng_alt::seed_type   seed_type;
+  #elif defined(ARMA_USE_PHILOX_RNG)
+    typedef arma_rng_philox::seed_type seed_type;
   #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
     typedef arma_rng_cxx11::seed_type seed_type;
   #else
@@ -48,6 +57,8 @@ class arma_rng
   
   #if   defined(ARMA_RNG_ALT)
     static const int rng_method = 2;
+  #elif defined(ARMA_USE_PHILOX_RNG)
+    static const int rng_method = 3;
   #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
     static const int rng_method = 1;
   #else
@@ -57,9 +68,14 @@ class arma_rng
   inline static void set_seed(const seed_type val);
   inline static void set_seed_random();
   
+  #if defined(ARMA_USE_PHILOX_RNG)
+    inline static void set_stream(const u32 stream, const u32 substream = 0);
+  #endif
+  
   template<typename eT> struct randi;
   template<typename eT> struct randu;
   template<typename eT> struct randn;
+  template<typename eT> struct randg;
   };
 
 
@@ -72,6 +88,10 @@ arma_rng::set_seed(const arma_rng::seed_type val)
     {
     arma_rng_alt::set_seed(val);
     }
+  #elif defined(ARMA_USE_PHILOX_RNG)
+    {
+    arma_rng_philox::instance().set_seed(val);
+    }
   #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
     {
     arma_rng_cxx11_instance.set_seed(val);
@@ -177,6 +197,21 @@ arma_rng::set_seed_random()
 
 
 
+#if defined(ARMA_USE_PHILOX_RNG)
+
+//! select an independent stream (and substream) of the counter-based generator for the calling thread;
+//! the position within the stream is reset, while the seed is kept
+inline
+void
+arma_rng::set_stream(const u32 stream, const u32 substream)
+  {
+  arma_rng_philox::instance().set_stream(stream, substream);
+  }
+
+#endif
+
+
+
 template<typename eT>
 struct arma_rng::randi
   {
@@ -187,6 +222,10 @@ struct arma_rng::randi
       {
       return eT( arma_rng_alt::randi_val() );
       }
+    #elif defined(ARMA_USE_PHILOX_RNG)
+      {
+      return eT( arma_rng_philox::instance().randi_val() );
+      }
     #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
       {
       return eT( arma_rng_cxx11_instance.randi_val() );
@@ -208,6 +247,10 @@ struct arma_rng::randi
       {
       return arma_rng_alt::randi_max_val();
       }
+    #elif defined(ARMA_USE_PHILOX_RNG)
+      {
+      return arma_rng_philox::randi_max_val();
+      }
     #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
       {
       return arma_rng_cxx11::randi_max_val();
@@ -229,6 +272,10 @@ struct arma_rng::randi
       {
       arma_rng_alt::randi_fill(mem, N, a, b);
       }
+    #elif defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng_philox::instance().randi_fill(mem, N, a, b);
+      }
     #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
       {
       arma_rng_cxx11_instance.randi_fill(mem, N, a, b);
@@ -253,6 +300,10 @@ struct arma_rng::randu
       {
       return eT( arma_rng_alt::randu_val() );
       }
+    #elif defined(ARMA_USE_PHILOX_RNG)
+      {
+      return eT( arma_rng_philox::instance().randu_val() );
+      }
     #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
       {
       return eT( arma_rng_cxx11_instance.randu_val() );
@@ -270,21 +321,29 @@ struct arma_rng::randu
   void
   fill(eT* mem, const uword N)
     {
-    uword j;
-    
-    for(j=1; j < N; j+=2)
+    #if defined(ARMA_USE_PHILOX_RNG)
       {
-      const eT tmp_i = eT( arma_rng::randu<eT>() );
-      const eT tmp_j = eT( arma_rng::randu<eT>() );
-      
-      (*mem) = tmp_i;  mem++;
-      (*mem) = tmp_j;  mem++;
+      arma_rng_philox::instance().randu_fill(mem, N);
       }
-    
-    if((j-1) < N)
+    #else
       {
-      (*mem) = eT( arma_rng::randu<eT>() );
+      uword j;
+      
+      for(j=1; j < N; j+=2)
+        {
+        const eT tmp_i = eT( arma_rng::randu<eT>() );
+        const eT tmp_j = eT( arma_rng::randu<eT>() );
+        
+        (*mem) = tmp_i;  mem++;
+        (*mem) = tmp_j;  mem++;
+        }
+      
+      if((j-1) < N)
+        {
+        (*mem) = eT( arma_rng::randu<eT>() );
+        }
       }
+    #endif
     }
   };
 
@@ -308,13 +367,22 @@ struct arma_rng::randu< std::complex<T> >
   void
   fill(std::complex<T>* mem, const uword N)
     {
-    for(uword i=0; i < N; ++i)
+    #if defined(ARMA_USE_PHILOX_RNG)
       {
-      const T a = T( arma_rng::randu<T>() );
-      const T b = T( arma_rng::randu<T>() );
-      
-      mem[i] = std::complex<T>(a, b);
+      // std::complex<T> is layout compatible with T[2]
+      arma_rng_philox::instance().randu_fill(reinterpret_cast<T*>(mem), 2*N);
+      }
+    #else
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        const T a = T( arma_rng::randu<T>() );
+        const T b = T( arma_rng::randu<T>() );
+        
+        mem[i] = std::complex<T>(a, b);
+        }
       }
+    #endif
     }
   };
 
@@ -330,6 +398,10 @@ struct arma_rng::randn
       {
       return eT( arma_rng_alt::randn_val() );
       }
+    #elif defined(ARMA_USE_PHILOX_RNG)
+      {
+      return eT( arma_rng_philox::instance().randn_val() );
+      }
     #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
       {
       return eT( arma_rng_cxx11_instance.randn_val() );
@@ -351,6 +423,10 @@ struct arma_rng::randn
       {
       arma_rng_alt::randn_dual_val(out1, out2);
       }
+    #elif defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng_philox::instance().randn_dual_val(out1, out2);
+      }
     #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
       {
       arma_rng_cxx11_instance.randn_dual_val(out1, out2);
@@ -387,7 +463,11 @@ struct arma_rng::randn
   void
   fill(eT* mem, const uword N)
     {
-    #if defined(ARMA_USE_CXX11) && defined(ARMA_USE_OPENMP)
+    #if defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng_philox::instance().randn_fill(mem, N);
+      }
+    #elif defined(ARMA_USE_CXX11) && defined(ARMA_USE_OPENMP)
       {
       if((N < 1024) || omp_in_parallel())  { arma_rng::randn<eT>::fill_simple(mem, N); return; }
       
@@ -467,7 +547,11 @@ struct arma_rng::randn< std::complex<T> >
   void
   fill(std::complex<T>* mem, const uword N)
     {
-    #if defined(ARMA_USE_CXX11) && defined(ARMA_USE_OPENMP)
+    #if defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng_philox::instance().randn_fill(reinterpret_cast<T*>(mem), 2*N);
+      }
+    #elif defined(ARMA_USE_CXX11) && defined(ARMA_USE_OPENMP)
       {
       if((N < 512) || omp_in_parallel())  { arma_rng::randn< std::complex<T> >::fill_simple(mem, N); return; }
       
@@ -526,4 +610,73 @@ struct arma_rng::randn< std::complex<T> >
 
 
 
+
+
+//! bulk generation of gamma variates; requires C++11.
+//! If the counter-based generator is not the default, a local instance is seeded from the default generator.
+template<typename eT>
+struct arma_rng::randg
+  {
+  inline
+  static
+  void
+  fill(eT* mem, const uword N, const double a, const double b)
+    {
+    #if defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng_philox::instance().randg_fill(mem, N, a, b);
+      }
+    #elif defined(ARMA_USE_CXX11)
+      {
+      typedef arma_rng_philox::seed_type seed_type;
+      
+      arma_rng_philox local_rng;
+      
+      local_rng.set_seed( (seed_type(arma_rng::randi<int>()) << 32) ^ seed_type(arma_rng::randi<int>()) );
+      
+      local_rng.randg_fill(mem, N, a, b);
+      }
+    #else
+      {
+      arma_ignore(mem);
+      arma_ignore(N);
+      arma_ignore(a);
+      arma_ignore(b);
+      }
+    #endif
+    }
+  
+  
+  inline
+  static
+  void
+  fill_varying(eT* mem, const eT* a_mem, const uword N, const double b)
+    {
+    #if defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng_philox::instance().randg_fill_varying(mem, a_mem, N, b);
+      }
+    #elif defined(ARMA_USE_CXX11)
+      {
+      typedef arma_rng_philox::seed_type seed_type;
+      
+      arma_rng_philox local_rng;
+      
+      local_rng.set_seed( (seed_type(arma_rng::randi<int>()) << 32) ^ seed_type(arma_rng::randi<int>()) );
+      
+      local_rng.randg_fill_varying(mem, a_mem, N, b);
+      }
+    #else
+      {
+      arma_ignore(mem);
+      arma_ignore(a_mem);
+      arma_ignore(N);
+      arma_ignore(b);
+      }
+    #endif
+    }
+  };
+
+
+
 //! @}
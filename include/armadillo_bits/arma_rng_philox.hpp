@@ -0,0 +1,673 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup arma_rng_philox
+//! @{
+
+
+#if defined(ARMA_USE_CXX11)
+
+
+//! Counter-based Philox4x32-10 generator.
+//! Salmon et al, "Parallel random numbers: as easy as 1, 2, 3", Proc. SC 2011.
+//! Each 128 bit output block is a pure function of the seed, the stream and substream numbers,
+//! and a 64 bit block counter, so any part of the sequence can be generated independently.
+//! Bulk fills map element i to a fixed block offset from the current counter,
+//! so the results do not depend on the number of threads used.
+class arma_rng_philox
+  {
+  public:
+  
+  typedef u64 seed_type;
+  
+  static const uword batch_size = 8;  // blocks per batch; the batch loops are written to allow auto-vectorisation
+  
+  inline arma_rng_philox();
+  
+  inline static arma_rng_philox& instance();
+  
+  inline void set_seed(const seed_type val);
+  inline void set_stream(const u32 in_stream, const u32 in_substream);
+  
+  inline int    randi_val();
+  inline double randu_val();
+  inline double randn_val();
+  
+  template<typename eT>
+  inline void randn_dual_val(eT& out1, eT& out2);
+  
+  template<typename eT>
+  inline void randi_fill(eT* mem, const uword N, const int a, const int b);
+  
+  template<typename eT>
+  inline void randu_fill(eT* mem, const uword N);
+  
+  template<typename eT>
+  inline void randn_fill(eT* mem, const uword N);
+  
+  template<typename eT>
+  inline void randg_fill(eT* mem, const uword N, const double a, const double b);
+  
+  template<typename eT>
+  inline void randg_fill_varying(eT* mem, const eT* a_mem, const uword N, const double b);
+  
+  inline static int randi_max_val();
+  
+  arma_hot inline static void gen_block(u32* out, const u64 ctr, const u32 stream, const u32 substream, const u64 key);
+  arma_hot inline static void gen_batch(u32* out, const u64 ctr, const u32 stream, const u32 substream, const u64 key);
+  
+  
+  private:
+  
+  static const uword kind_randi = 0;
+  static const uword kind_randu = 1;
+  static const uword kind_randn = 2;
+  
+  static const uword randg_block_size = 4096;  // outputs per independently generated block of gamma variates
+  static const uword randg_pool_size  = 256;   // candidates per batch of the rejection sampler
+  
+  template<uword kind, typename eT>
+  inline void fill_generic(eT* mem, const uword N, const int a, const int b);
+  
+  template<uword kind, typename eT>
+  arma_hot inline static void fill_batch(eT* mem, const uword N, const uword batch, const u64 ctr, const u32 stream, const u32 substream, const u64 key, const int a, const u64 width);
+  
+  template<typename eT>
+  inline void randg_fill_generic(eT* mem, const eT* a_mem, const uword N, const double a, const double b);
+  
+  template<typename eT>
+  arma_hot inline static void randg_fill_block(eT* out, const eT* a_mem, const uword n, const double a, const double b, arma_rng_philox& g);
+  
+  arma_inline static double u32_to_double(const u32 hi, const u32 lo);
+  
+  inline u32 next_word();
+  
+  u64 key;
+  u64 counter;     // next unused block
+  u32 stream;
+  u32 substream;
+  u32 buf[4];      // unused words of the most recent block, for single values
+  uword buf_pos;
+  };
+
+
+
+inline
+arma_rng_philox::arma_rng_philox()
+  : key      (0)
+  , counter  (0)
+  , stream   (0)
+  , substream(0)
+  , buf_pos  (4)
+  {
+  buf[0] = 0;
+  buf[1] = 0;
+  buf[2] = 0;
+  buf[3] = 0;
+  }
+
+
+
+//! state of the calling thread
+inline
+arma_rng_philox&
+arma_rng_philox::instance()
+  {
+  static thread_local arma_rng_philox obj;
+  
+  return obj;
+  }
+
+
+
+inline
+void
+arma_rng_philox::set_seed(const arma_rng_philox::seed_type val)
+  {
+  key     = val;
+  counter = 0;
+  buf_pos = 4;
+  }
+
+
+
+inline
+void
+arma_rng_philox::set_stream(const u32 in_stream, const u32 in_substream)
+  {
+  stream    = in_stream;
+  substream = in_substream;
+  counter   = 0;
+  buf_pos   = 4;
+  }
+
+
+
+arma_hot
+inline
+void
+arma_rng_philox::gen_block(u32* out, const u64 ctr, const u32 stream, const u32 substream, const u64 key)
+  {
+  u32 c0 = u32(ctr);
+  u32 c1 = u32(ctr >> 32);
+  u32 c2 = substream;
+  u32 c3 = stream;
+  
+  u32 k0 = u32(key);
+  u32 k1 = u32(key >> 32);
+  
+  for(uword r=0; r < 10; ++r)
+    {
+    const u64 p0 = u64(0xD2511F53) * u64(c0);
+    const u64 p1 = u64(0xCD9E8D57) * u64(c2);
+    
+    c0 = u32(p1 >> 32) ^ c1 ^ k0;
+    c1 = u32(p1);
+    c2 = u32(p0 >> 32) ^ c3 ^ k1;
+    c3 = u32(p0);
+    
+    k0 += u32(0x9E3779B9);
+    k1 += u32(0xBB67AE85);
+    }
+  
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+  }
+
+
+
+//! generate batch_size consecutive blocks;
+//! the state is kept in separate arrays so that each round is a simple loop over the blocks
+arma_hot
+inline
+void
+arma_rng_philox::gen_batch(u32* out, const u64 ctr, const u32 stream, const u32 substream, const u64 key)
+  {
+  u32 c0[batch_size];
+  u32 c1[batch_size];
+  u32 c2[batch_size];
+  u32 c3[batch_size];
+  
+  for(uword j=0; j < batch_size; ++j)
+    {
+    const u64 ctr_j = ctr + u64(j);
+    
+    c0[j] = u32(ctr_j);
+    c1[j] = u32(ctr_j >> 32);
+    c2[j] = substream;
+    c3[j] = stream;
+    }
+  
+  u32 k0 = u32(key);
+  u32 k1 = u32(key >> 32);
+  
+  for(uword r=0; r < 10; ++r)
+    {
+    for(uword j=0; j < batch_size; ++j)
+      {
+      const u64 p0 = u64(0xD2511F53) * u64(c0[j]);
+      const u64 p1 = u64(0xCD9E8D57) * u64(c2[j]);
+      
+      c0[j] = u32(p1 >> 32) ^ c1[j] ^ k0;
+      c1[j] = u32(p1);
+      c2[j] = u32(p0 >> 32) ^ c3[j] ^ k1;
+      c3[j] = u32(p0);
+      }
+    
+    k0 += u32(0x9E3779B9);
+    k1 += u32(0xBB67AE85);
+    }
+  
+  for(uword j=0; j < batch_size; ++j)
+    {
+    out[4*j + 0] = c0[j];
+    out[4*j + 1] = c1[j];
+    out[4*j + 2] = c2[j];
+    out[4*j + 3] = c3[j];
+    }
+  }
+
+
+
+//! uniform double in [0,1) using 53 random bits
+arma_inline
+double
+arma_rng_philox::u32_to_double(const u32 hi, const u32 lo)
+  {
+  return double( (u64(hi >> 5) << 26) | u64(lo >> 6) ) * (1.0 / 9007199254740992.0);
+  }
+
+
+
+inline
+u32
+arma_rng_philox::next_word()
+  {
+  if(buf_pos >= 4)
+    {
+    arma_rng_philox::gen_block(buf, counter, stream, substream, key);
+    
+    ++counter;
+    
+    buf_pos = 0;
+    }
+  
+  return buf[buf_pos++];
+  }
+
+
+
+inline
+int
+arma_rng_philox::randi_val()
+  {
+  return int( next_word() >> 1 );
+  }
+
+
+
+inline
+double
+arma_rng_philox::randu_val()
+  {
+  const u32 hi = next_word();
+  const u32 lo = next_word();
+  
+  return arma_rng_philox::u32_to_double(hi, lo);
+  }
+
+
+
+inline
+double
+arma_rng_philox::randn_val()
+  {
+  double out1;
+  double out2;
+  
+  (*this).randn_dual_val(out1, out2);
+  
+  return out1;
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_philox::randn_dual_val(eT& out1, eT& out2)
+  {
+  const double u1 = 1.0 - (*this).randu_val();  // (0,1]
+  const double u2 =       (*this).randu_val();
+  
+  const double r     = std::sqrt( -2.0 * std::log(u1) );
+  const double theta = double(2) * Datum<double>::pi * u2;
+  
+  out1 = eT( r * std::cos(theta) );
+  out2 = eT( r * std::sin(theta) );
+  }
+
+
+
+inline
+int
+arma_rng_philox::randi_max_val()
+  {
+  return std::numeric_limits<int>::max();
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_philox::randi_fill(eT* mem, const uword N, const int a, const int b)
+  {
+  (*this).template fill_generic<kind_randi>(mem, N, a, b);
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_philox::randu_fill(eT* mem, const uword N)
+  {
+  (*this).template fill_generic<kind_randu>(mem, N, 0, 0);
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_philox::randn_fill(eT* mem, const uword N)
+  {
+  (*this).template fill_generic<kind_randn>(mem, N, 0, 0);
+  }
+
+
+
+template<uword kind, typename eT>
+inline
+void
+arma_rng_philox::fill_generic(eT* mem, const uword N, const int a, const int b)
+  {
+  if(N == 0)  { return; }
+  
+  const uword n_per_block = (kind == kind_randi) ? uword(4) : uword(2);
+  const uword n_per_batch = n_per_block * batch_size;
+  const uword n_batches   = (N + n_per_batch - 1) / n_per_batch;
+  
+  const u64 width = (kind == kind_randi) ? u64( s64(b) - s64(a) + s64(1) ) : u64(0);
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (N >= 1024) && (mp_thread_limit::in_parallel() == false) )
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword batch=0; batch < n_batches; ++batch)
+        {
+        arma_rng_philox::fill_batch<kind>(mem, N, batch, counter, stream, substream, key, a, width);
+        }
+      }
+    else
+      {
+      for(uword batch=0; batch < n_batches; ++batch)
+        {
+        arma_rng_philox::fill_batch<kind>(mem, N, batch, counter, stream, substream, key, a, width);
+        }
+      }
+    }
+  #else
+    {
+    for(uword batch=0; batch < n_batches; ++batch)
+      {
+      arma_rng_philox::fill_batch<kind>(mem, N, batch, counter, stream, substream, key, a, width);
+      }
+    }
+  #endif
+  
+  counter += u64(n_batches) * u64(batch_size);
+  }
+
+
+
+//! element i of the fill is taken from block (ctr + i/n_per_block), independently of how the batches are scheduled
+template<uword kind, typename eT>
+arma_hot
+inline
+void
+arma_rng_philox::fill_batch(eT* mem, const uword N, const uword batch, const u64 ctr, const u32 stream, const u32 substream, const u64 key, const int a, const u64 width)
+  {
+  const uword n_per_block = (kind == kind_randi) ? uword(4) : uword(2);
+  const uword n_per_batch = n_per_block * batch_size;
+  
+  u32    words[4*batch_size];
+  double  vals[4*batch_size];
+  
+  arma_rng_philox::gen_batch(words, ctr + u64(batch) * u64(batch_size), stream, substream, key);
+  
+  if(kind == kind_randi)
+    {
+    for(uword i=0; i < 4*batch_size; ++i)
+      {
+      vals[i] = double( s64(a) + s64( (u64(words[i]) * width) >> 32 ) );
+      }
+    }
+  else
+  if(kind == kind_randu)
+    {
+    for(uword i=0; i < 2*batch_size; ++i)
+      {
+      vals[i] = arma_rng_philox::u32_to_double(words[2*i], words[2*i + 1]);
+      }
+    }
+  else
+  if(kind == kind_randn)
+    {
+    // Box-Muller transform
+    
+    for(uword j=0; j < batch_size; ++j)
+      {
+      const double u1 = 1.0 - arma_rng_philox::u32_to_double(words[4*j + 0], words[4*j + 1]);
+      const double u2 =       arma_rng_philox::u32_to_double(words[4*j + 2], words[4*j + 3]);
+      
+      const double r     = std::sqrt( -2.0 * std::log(u1) );
+      const double theta = double(2) * Datum<double>::pi * u2;
+      
+      vals[2*j + 0] = r * std::cos(theta);
+      vals[2*j + 1] = r * std::sin(theta);
+      }
+    }
+  
+  const uword start = batch * n_per_batch;
+  const uword n_out = (std::min)(n_per_batch, N - start);
+  
+  eT* out = &(mem[start]);
+  
+  for(uword i=0; i < n_out; ++i)  { out[i] = eT(vals[i]); }
+  }
+
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_philox::randg_fill(eT* mem, const uword N, const double a, const double b)
+  {
+  (*this).randg_fill_generic(mem, (const eT*)(0), N, a, b);
+  }
+
+
+
+//! gamma variates with shape a_mem[i] and scale b; mem and a_mem may be the same; non-positive shapes give NaN
+template<typename eT>
+inline
+void
+arma_rng_philox::randg_fill_varying(eT* mem, const eT* a_mem, const uword N, const double b)
+  {
+  (*this).randg_fill_generic(mem, a_mem, N, double(0), b);
+  }
+
+
+
+//! each block of randg_block_size outputs is drawn from its own range of 2^32 counter values,
+//! so the blocks can be generated in any order despite the variable number of variates consumed by rejection sampling
+template<typename eT>
+inline
+void
+arma_rng_philox::randg_fill_generic(eT* mem, const eT* a_mem, const uword N, const double a, const double b)
+  {
+  if(N == 0)  { return; }
+  
+  const uword n_blocks = (N + randg_block_size - 1) / randg_block_size;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const bool use_mp = (n_blocks >= 2) && (mp_thread_limit::in_parallel() == false);
+    
+    const int n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+    for(uword blk=0; blk < n_blocks; ++blk)
+      {
+      const uword start = blk * randg_block_size;
+      const uword n     = (std::min)(uword(randg_block_size), N - start);
+      
+      arma_rng_philox g(*this);
+      
+      g.counter = counter + (u64(blk) << 32);
+      g.buf_pos = 4;
+      
+      arma_rng_philox::randg_fill_block(&(mem[start]), ((a_mem != 0) ? &(a_mem[start]) : (const eT*)(0)), n, a, b, g);
+      }
+    }
+  #else
+    {
+    for(uword blk=0; blk < n_blocks; ++blk)
+      {
+      const uword start = blk * randg_block_size;
+      const uword n     = (std::min)(uword(randg_block_size), N - start);
+      
+      arma_rng_philox g(*this);
+      
+      g.counter = counter + (u64(blk) << 32);
+      g.buf_pos = 4;
+      
+      arma_rng_philox::randg_fill_block(&(mem[start]), ((a_mem != 0) ? &(a_mem[start]) : (const eT*)(0)), n, a, b, g);
+      }
+    }
+  #endif
+  
+  counter += u64(n_blocks) << 32;
+  }
+
+
+
+//! Marsaglia and Tsang, "A simple method for generating gamma variables", ACM TOMS 26, 2000.
+//! Candidates are drawn in batches of randg_pool_size normal and uniform variates;
+//! for a constant shape, the acceptance test is evaluated for the whole batch at once.
+//! Shapes below 1 use the boost X(a) = X(a+1) * U^(1/a).
+template<typename eT>
+arma_hot
+inline
+void
+arma_rng_philox::randg_fill_block(eT* out, const eT* a_mem, const uword n, const double a, const double b, arma_rng_philox& g)
+  {
+  const uword P = randg_pool_size;
+  
+  double x[P];    // normal candidates
+  double u[P];    // uniform candidates
+  double val[P];  // candidate values for constant shape
+  double tmp[P];  // accepted values for the current chunk of outputs
+  double shp[P];  // shapes for the current chunk of outputs
+  double w[P];    // uniforms for the boost
+  
+  uword pos = P;
+  
+  if(a_mem == 0)
+    {
+    const double aa = (a < double(1)) ? (a + double(1)) : a;
+    const double d  = aa - double(1)/double(3);
+    const double c  = double(1) / std::sqrt(double(9) * d);
+    
+    for(uword i0=0; i0 < n; i0 += P)
+      {
+      const uword m = (std::min)(P, n - i0);
+      
+      uword j = 0;
+      
+      while(j < m)
+        {
+        if(pos >= P)
+          {
+          g.randn_fill(x, P);
+          g.randu_fill(u, P);
+          
+          for(uword k=0; k < P; ++k)
+            {
+            const double t  = double(1) + c*x[k];
+            const double v  = t*t*t;
+            const double vv = (v > double(0)) ? v : double(1);
+            
+            const bool ok = (v > double(0)) && ( std::log(double(1) - u[k]) < (double(0.5)*x[k]*x[k] + d - d*vv + d*std::log(vv)) );
+            
+            val[k] = (ok) ? (d*vv) : double(-1);
+            }
+          
+          pos = 0;
+          }
+        
+        for(; (pos < P) && (j < m); ++pos)
+          {
+          if(val[pos] >= double(0))  { tmp[j] = val[pos]; ++j; }
+          }
+        }
+      
+      if(a < double(1))
+        {
+        g.randu_fill(w, m);
+        
+        const double inv_a = double(1) / a;
+        
+        for(uword k=0; k < m; ++k)  { tmp[k] *= std::pow(double(1) - w[k], inv_a); }
+        }
+      
+      for(uword k=0; k < m; ++k)  { out[i0 + k] = eT(tmp[k] * b); }
+      }
+    }
+  else
+    {
+    for(uword i0=0; i0 < n; i0 += P)
+      {
+      const uword m = (std::min)(P, n - i0);
+      
+      for(uword k=0; k < m; ++k)  { shp[k] = double( access::tmp_real(a_mem[i0 + k]) ); }
+      
+      g.randu_fill(w, m);
+      
+      for(uword k=0; k < m; ++k)
+        {
+        const double s = shp[k];
+        
+        if( ((s > double(0)) == false) || (s > std::numeric_limits<double>::max()) )  { tmp[k] = Datum<double>::nan; continue; }
+        
+        const double aa = (s < double(1)) ? (s + double(1)) : s;
+        const double d  = aa - double(1)/double(3);
+        const double c  = double(1) / std::sqrt(double(9) * d);
+        
+        while(true)
+          {
+          if(pos >= P)
+            {
+            g.randn_fill(x, P);
+            g.randu_fill(u, P);
+            
+            pos = 0;
+            }
+          
+          const double xx = x[pos];
+          const double uu = u[pos];
+          
+          ++pos;
+          
+          const double t = double(1) + c*xx;
+          const double v = t*t*t;
+          
+          if(v <= double(0))  { continue; }
+          
+          if( std::log(double(1) - uu) < (double(0.5)*xx*xx + d - d*v + d*std::log(v)) )  { tmp[k] = d*v; break; }
+          }
+        
+        if(s < double(1))  { tmp[k] *= std::pow(double(1) - w[k], double(1) / s); }
+        }
+      
+      for(uword k=0; k < m; ++k)  { out[i0 + k] = eT(tmp[k] * b); }
+      }
+    }
+  }
+
+
+#endif
+
+
+//! @}
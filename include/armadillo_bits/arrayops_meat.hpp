@@ -931,6 +931,8 @@ inline
 eT
 arrayops::accumulate(const eT* src, const uword n_elem)
   {
+  if(arma_config::compensated_sum)  { return sum_engine::accumulate<eT>(src, n_elem); }
+  
   #if defined(__FINITE_MATH_ONLY__) && (__FINITE_MATH_ONLY__ > 0)
     {
     eT acc = eT(0);
@@ -949,23 +951,37 @@ arrayops::accumulate(const eT* src, const uword n_elem)
     }
   #else
     {
+    // independent accumulators allow the additions to be pipelined and vectorised
+    
     eT acc1 = eT(0);
     eT acc2 = eT(0);
+    eT acc3 = eT(0);
+    eT acc4 = eT(0);
+    eT acc5 = eT(0);
+    eT acc6 = eT(0);
+    eT acc7 = eT(0);
+    eT acc8 = eT(0);
     
-    uword j;
+    uword i = 0;
     
-    for(j=1; j<n_elem; j+=2)
+    for(; (i+8) <= n_elem; i+=8)
       {
-      acc1 += (*src);  src++;
-      acc2 += (*src);  src++;
+      acc1 += src[i  ];
+      acc2 += src[i+1];
+      acc3 += src[i+2];
+      acc4 += src[i+3];
+      acc5 += src[i+4];
+      acc6 += src[i+5];
+      acc7 += src[i+6];
+      acc8 += src[i+7];
       }
     
-    if((j-1) < n_elem)
+    for(; i < n_elem; ++i)
       {
-      acc1 += (*src);
+      acc1 += src[i];
       }
     
-    return acc1 + acc2;
+    return ((acc1 + acc2) + (acc3 + acc4)) + ((acc5 + acc6) + (acc7 + acc8));
     }
   #endif
   }
@@ -232,6 +232,19 @@ class auxlib
   inline static bool svd_dc_econ(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V, const Base< std::complex<T>, T1>& X);
   
   
+  //
+  // randomised decompositions
+  
+  template<typename eT>
+  inline static bool rand_range(Mat<eT>& Q, const Mat<eT>& X, const uword n_vec, const uword n_iter);
+  
+  template<typename eT, typename T1>
+  inline static bool svd_rand(Mat<eT>& U, Col<typename get_pod_type<eT>::result>& S, Mat<eT>& V, const Base<eT,T1>& X, const uword k, const uword n_oversample, const uword n_iter, const bool calc_UV);
+  
+  template<typename eT, typename T1>
+  inline static bool eig_sym_rand(Col<typename get_pod_type<eT>::result>& eigval, Mat<eT>& eigvec, const Base<eT,T1>& X, const uword k, const uword n_oversample, const uword n_iter);
+  
+  
   //
   // solve
   
@@ -244,6 +257,9 @@ class auxlib
   template<typename T1>
   inline static bool solve_square_refine(Mat< std::complex<typename T1::pod_type> >& out, typename T1::pod_type& out_rcond, Mat< std::complex<typename T1::pod_type> >& A, const Base<std::complex<typename T1::pod_type>,T1>& B_expr, const bool equilibrate);
   
+  template<typename T1>
+  inline static bool solve_square_mixed(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, uword& out_n_iter, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const bool allow_sympd);
+  
   template<typename T1>
   inline static bool solve_approx_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
   
@@ -325,10 +341,25 @@ class auxlib
   template<typename T1>
   inline static typename T1::pod_type rcond(const Base<std::complex<typename T1::pod_type>,T1>& A_expr);
   
+  template<typename T>
+  inline static T lu_rcond(Mat<T>& LU, const T norm_val);
+  
+  template<typename T>
+  inline static T lu_rcond(Mat< std::complex<T> >& LU, const T norm_val);
+  
+  template<typename T>
+  inline static T chol_rcond(const Mat<T>& R, const T norm_val);
+  
+  template<typename T>
+  inline static T chol_rcond(const Mat< std::complex<T> >& R, const T norm_val);
+  
   
   //
   // misc
   
+  template<typename eT>
+  inline static bool is_hermitian(const Mat<eT>& A);
+  
   template<typename T1>
   inline static bool crippled_lapack(const Base<typename T1::elem_type, T1>&);
   };
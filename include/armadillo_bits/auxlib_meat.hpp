@@ -3137,6 +3137,149 @@ auxlib::svd_dc_econ(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >
 
 
 
+//! randomised range finder: Q has n_vec orthonormal columns that approximately span the range of X;
+//! each power iteration (with re-orthonormalisation) improves the approximation for slowly decaying singular values
+template<typename eT>
+inline
+bool
+auxlib::rand_range(Mat<eT>& Q, const Mat<eT>& X, const uword n_vec, const uword n_iter)
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> Y = X * randn< Mat<eT> >(X.n_cols, n_vec);
+  Mat<eT> R;
+  Mat<eT> W;
+  
+  if(auxlib::qr_econ(Q, R, Y) == false)  { return false; }
+  
+  for(uword iter=0; iter < n_iter; ++iter)
+    {
+    Y = trans(X) * Q;
+    
+    if(auxlib::qr_econ(W, R, Y) == false)  { return false; }
+    
+    Y = X * W;
+    
+    if(auxlib::qr_econ(Q, R, Y) == false)  { return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! truncated SVD via randomised range finder: the k largest singular values, and optionally the corresponding singular vectors;
+//! the SVD is computed only for the (k + n_oversample) x n_cols projection of X
+template<typename eT, typename T1>
+inline
+bool
+auxlib::svd_rand(Mat<eT>& U, Col<typename get_pod_type<eT>::result>& S, Mat<eT>& V, const Base<eT,T1>& X_expr, const uword k, const uword n_oversample, const uword n_iter, const bool calc_UV)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const quasi_unwrap<T1> UX(X_expr.get_ref());
+  const Mat<eT>& X     = UX.M;
+  
+  const uword n_min = (std::min)(X.n_rows, X.n_cols);
+  const uword k_use = (std::min)(k, n_min);
+  
+  if(k_use == 0)
+    {
+    S.reset();
+    
+    if(calc_UV)  { U.set_size(X.n_rows, 0); V.set_size(X.n_cols, 0); }
+    
+    return true;
+    }
+  
+  const uword n_vec = (std::min)(k_use + n_oversample, n_min);
+  
+  Mat<eT> Q;
+  
+  if(auxlib::rand_range(Q, X, n_vec, n_iter) == false)  { return false; }
+  
+  // B = Q.t() * X is small: n_vec x n_cols
+  Mat<eT> B = trans(Q) * X;
+  
+  Mat<eT> UB;
+  Col<T>  SB;
+  Mat<eT> VB;
+  
+  const bool status = (calc_UV) ? auxlib::svd_dc_econ(UB, SB, VB, B) : auxlib::svd_dc(SB, B);
+  
+  if(status == false)  { return false; }
+  
+  S = SB.head(k_use);
+  
+  if(calc_UV)
+    {
+    U = Q * UB.head_cols(k_use);
+    V = VB.head_cols(k_use);
+    }
+  
+  return true;
+  }
+
+
+
+//! the k eigenvalues with largest magnitude (in ascending order) and corresponding eigenvectors of symmetric/hermitian X, via randomised range finder;
+//! the eigen decomposition is computed only for the (k + n_oversample) x (k + n_oversample) projection of X
+template<typename eT, typename T1>
+inline
+bool
+auxlib::eig_sym_rand(Col<typename get_pod_type<eT>::result>& eigval, Mat<eT>& eigvec, const Base<eT,T1>& X_expr, const uword k, const uword n_oversample, const uword n_iter)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const quasi_unwrap<T1> UX(X_expr.get_ref());
+  const Mat<eT>& X     = UX.M;
+  
+  arma_debug_check( (X.is_square() == false), "eig_sym_rand(): given matrix must be square sized" );
+  
+  const uword k_use = (std::min)(k, X.n_rows);
+  
+  if(k_use == 0)
+    {
+    eigval.reset();
+    eigvec.set_size(X.n_rows, 0);
+    
+    return true;
+    }
+  
+  const uword n_vec = (std::min)(k_use + n_oversample, X.n_rows);
+  
+  Mat<eT> Q;
+  
+  if(auxlib::rand_range(Q, X, n_vec, n_iter) == false)  { return false; }
+  
+  Mat<eT> XQ = X * Q;
+  Mat<eT> B  = trans(Q) * XQ;
+  
+  XQ.reset();
+  
+  Col<T>  eigval_B;
+  Mat<eT> eigvec_B;
+  
+  if(auxlib::eig_sym(eigval_B, eigvec_B, B) == false)  { return false; }
+  
+  // eigval_B is in ascending order; keep the k_use eigenvalues with largest magnitude, preserving the order
+  
+  uvec indices = sort_index( abs(eigval_B), "descend" );
+  
+  indices = sort( indices.head(k_use) );
+  
+  eigval = eigval_B.elem(indices);
+  eigvec = Q * eigvec_B.cols(indices);
+  
+  return true;
+  }
+
+
+
 //! solve a system of linear equations via LU decomposition
 template<typename T1>
 inline
@@ -3428,6 +3571,192 @@ auxlib::solve_square_refine(Mat< std::complex<typename T1::pod_type> >& out, typ
 
 
 
+//! solve a system of linear equations by factorising A in lower precision (via Cholesky decomposition if A is hermitian, or via LU decomposition)
+//! followed by iterative refinement of the solution in the working precision;
+//! false is returned if A can't be factorised in lower precision, or if the refinement stalls,
+//! so that the caller can fall back to a solver that uses only the working precision
+template<typename T1>
+inline
+bool
+auxlib::solve_square_mixed(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, uword& out_n_iter, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const bool allow_sympd)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::pod_type T;
+  
+  out_rcond  = T(0);
+  out_n_iter = 0;
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type                    eT;
+    typedef typename get_lower_prec_type<eT>::result  lT;
+    typedef typename get_pod_type<lT>::result     lpod_T;
+    
+    if(get_lower_prec_type<eT>::value == false)  { return false; }
+    
+    const unwrap_check<T1> UB(B_expr.get_ref(), out);
+    const Mat<eT>& B     = UB.M;
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())
+      {
+      out.zeros(A.n_cols, B.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    const uword N = A.n_rows;
+    
+    Mat<lT> AF(N, N);
+    
+    arrayops::convert_cx(AF.memptr(), A.memptr(), A.n_elem);
+    
+    // some elements of A are outside of the range of the lower precision type
+    if(AF.is_finite() == false)  { return false; }
+    
+    char     norm_id = '1';
+    char     uplo    = 'L';
+    char     trans   = 'N';
+    blas_int n       = blas_int(N);
+    blas_int nrhs    = blas_int(B.n_cols);
+    blas_int info    = blas_int(0);
+    
+    podarray<lpod_T>   junk(1);
+    podarray<blas_int> ipiv;
+    
+    const lpod_T AF_norm = lapack::lange(&norm_id, &n, &n, AF.memptr(), &n, junk.memptr());
+    
+    bool use_chol = (allow_sympd) ? auxlib::is_hermitian(A) : false;
+    
+    if(use_chol)
+      {
+      arma_extra_debug_print("lapack::potrf()");
+      lapack::potrf(&uplo, &n, AF.memptr(), &n, &info);
+      
+      if(info != blas_int(0))
+        {
+        // A is not positive definite
+        use_chol = false;
+        
+        arrayops::convert_cx(AF.memptr(), A.memptr(), A.n_elem);
+        }
+      }
+    
+    if(use_chol == false)
+      {
+      ipiv.set_size(N + 2);  // +2 for paranoia: some versions of Lapack might be trashing memory
+      
+      arma_extra_debug_print("lapack::getrf()");
+      lapack::getrf(&n, &n, AF.memptr(), &n, ipiv.memptr(), &info);
+      
+      if(info != blas_int(0))  { return false; }
+      }
+    
+    const lpod_T rcond = (use_chol) ? auxlib::chol_rcond(AF, AF_norm) : auxlib::lu_rcond(AF, AF_norm);
+    
+    out_rcond = T(rcond);
+    
+    // the refinement can only converge if A is well conditioned relative to the lower precision
+    if( (arma_isnan(rcond)) || (rcond < lpod_T(4) * std::numeric_limits<lpod_T>::epsilon()) )  { return false; }
+    
+    const T tol = std::sqrt(T(N)) * std::numeric_limits<T>::epsilon() * norm(A, "inf");
+    
+    // same maximum number of refinement steps as in LAPACK's dsgesv()
+    const uword max_n_iter = 30;
+    
+    Mat<lT> XF(N, B.n_cols);  // correction in lower precision
+    Mat<eT> R = B;            // residual in working precision
+    Mat<eT> X(N, B.n_cols);   // solution; out is only written on success, as B may be an alias of out
+    
+    X.zeros();
+    
+    T ratio_old = Datum<T>::inf;
+    
+    for(uword iter=0; iter <= max_n_iter; ++iter)
+      {
+      arrayops::convert_cx(XF.memptr(), R.memptr(), R.n_elem);
+      
+      if(use_chol)
+        {
+        lapack::potrs(&uplo, &n, &nrhs, AF.memptr(), &n, XF.memptr(), &n, &info);
+        }
+      else
+        {
+        lapack::getrs(&trans, &n, &nrhs, AF.memptr(), &n, ipiv.memptr(), XF.memptr(), &n, &info);
+        }
+      
+      if(info != blas_int(0))  { return false; }
+      
+      arrayops::convert_cx(R.memptr(), XF.memptr(), XF.n_elem);
+      
+      arrayops::inplace_plus(X.memptr(), R.memptr(), X.n_elem);
+      
+      R = B - A*X;
+      
+      // converged if the residual of each column is small relative to the solution (as in dsgesv)
+      
+      bool converged = true;
+      T    ratio     = T(0);
+      
+      for(uword col=0; col < B.n_cols; ++col)
+        {
+        const eT* R_colptr = R.colptr(col);
+        const eT* X_colptr = X.colptr(col);
+        
+        T R_max = T(0);
+        T X_max = T(0);
+        
+        for(uword row=0; row < N; ++row)
+          {
+          R_max = (std::max)(R_max, T(std::abs(R_colptr[row])));
+          X_max = (std::max)(X_max, T(std::abs(X_colptr[row])));
+          }
+        
+        if(R_max > tol*X_max)  { converged = false; }
+        
+        ratio = (std::max)( ratio, ((R_max > T(0)) ? (R_max / X_max) : T(0)) );
+        }
+      
+      if(converged)
+        {
+        arma_extra_debug_print("auxlib::solve_square_mixed(): converged");
+        
+        out_n_iter = iter;
+        
+        out.steal_mem(X);
+        
+        return true;
+        }
+      
+      // stalled: each refinement step must substantially reduce the residual
+      if( (ratio <= T(0.5)*ratio_old) == false )
+        {
+        arma_extra_debug_print("auxlib::solve_square_mixed(): refinement stalled");
+        
+        return false;
+        }
+      
+      ratio_old = ratio;
+      }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(allow_sympd);
+    return false;
+    }
+  #endif
+  }
+
+
+
 //! solve a non-square full-rank system via QR or LQ decomposition
 template<typename T1>
 inline
@@ -4864,6 +5193,174 @@ auxlib::rcond(const Base<std::complex<typename T1::pod_type>,T1>& A_expr)
   }
 
 
+//! reciprocal condition number of a matrix, given its LU decomposition (as computed by getrf) and its 1-norm
+template<typename T>
+inline
+T
+auxlib::lu_rcond(Mat<T>& LU, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     norm_id  = '1';
+    blas_int n        = blas_int(LU.n_rows);
+    T        norm_tmp = norm_val;
+    T        rcond    = T(0);
+    blas_int info     = blas_int(0);
+    
+    podarray<T>         work(4*LU.n_rows);
+    podarray<blas_int> iwork(  LU.n_rows);
+    
+    arma_extra_debug_print("lapack::gecon()");
+    lapack::gecon(&norm_id, &n, LU.memptr(), &n, &norm_tmp, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    return (info == blas_int(0)) ? rcond : T(0);
+    }
+  #else
+    {
+    arma_ignore(LU);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #endif
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::lu_rcond(Mat< std::complex<T> >& LU, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    char     norm_id  = '1';
+    blas_int n        = blas_int(LU.n_rows);
+    T        norm_tmp = norm_val;
+    T        rcond    = T(0);
+    blas_int info     = blas_int(0);
+    
+    podarray<eT>  work(2*LU.n_rows);
+    podarray< T> rwork(2*LU.n_rows);
+    
+    arma_extra_debug_print("lapack::cx_gecon()");
+    lapack::cx_gecon(&norm_id, &n, LU.memptr(), &n, &norm_tmp, &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    return (info == blas_int(0)) ? rcond : T(0);
+    }
+  #else
+    {
+    arma_ignore(LU);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #endif
+  }
+
+
+
+//! reciprocal condition number of a hermitian positive definite matrix, given its lower Cholesky factor (as computed by potrf) and its 1-norm
+template<typename T>
+inline
+T
+auxlib::chol_rcond(const Mat<T>& R, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     uplo     = 'L';
+    blas_int n        = blas_int(R.n_rows);
+    T        norm_tmp = norm_val;
+    T        rcond    = T(0);
+    blas_int info     = blas_int(0);
+    
+    podarray<T>         work(3*R.n_rows);
+    podarray<blas_int> iwork(  R.n_rows);
+    
+    arma_extra_debug_print("lapack::pocon()");
+    lapack::pocon(&uplo, &n, R.memptr(), &n, &norm_tmp, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    return (info == blas_int(0)) ? rcond : T(0);
+    }
+  #else
+    {
+    arma_ignore(R);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #endif
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::chol_rcond(const Mat< std::complex<T> >& R, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    char     uplo     = 'L';
+    blas_int n        = blas_int(R.n_rows);
+    T        norm_tmp = norm_val;
+    T        rcond    = T(0);
+    blas_int info     = blas_int(0);
+    
+    podarray<eT>  work(2*R.n_rows);
+    podarray< T> rwork(  R.n_rows);
+    
+    arma_extra_debug_print("lapack::cx_pocon()");
+    lapack::cx_pocon(&uplo, &n, R.memptr(), &n, &norm_tmp, &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    return (info == blas_int(0)) ? rcond : T(0);
+    }
+  #else
+    {
+    arma_ignore(R);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #endif
+  }
+
+
+
+//! true if A is square and exactly symmetric (real matrices) or hermitian (complex matrices)
+template<typename eT>
+inline
+bool
+auxlib::is_hermitian(const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(A.n_rows != A.n_cols)  { return false; }
+  
+  const uword N = A.n_rows;
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const eT* A_colptr = A.colptr(col);
+    
+    for(uword row=col; row < N; ++row)
+      {
+      if( A_colptr[row] != access::alt_conj( A.at(col,row) ) )  { return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
 
 template<typename T1>
 inline
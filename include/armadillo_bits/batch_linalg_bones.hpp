@@ -0,0 +1,68 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_linalg
+//! @{
+
+
+//! Linear algebra operations applied independently to each slice of a cube.
+//! Slices up to tiny_max x tiny_max are handled by fixed-size kernels,
+//! avoiding the per-call overhead of BLAS and LAPACK; larger slices are passed to auxlib.
+//! With OpenMP enabled, the slices are processed in parallel.
+//! The fixed-size kernels are also used directly for fixed-size matrices:
+//! by det() and solve() up to 16x16, and by inv() and chol() up to tiny_max x tiny_max.
+class batch_linalg
+  {
+  public:
+  
+  static const uword tiny_max = 8;
+  
+  template<typename eT> inline static bool use_mp(const uword n_slices, const uword n_elem);
+  
+  //
+  
+  template<typename eT, uword N> arma_hot inline static bool lu_tiny(eT* A, uword* piv);
+  template<typename eT, uword N> arma_hot inline static void lu_solve_tiny(eT* x, const eT* LU, const uword* piv);
+  
+  template<typename eT, uword N> arma_hot inline static bool inv_tiny(eT* out, const eT* A);
+  template<typename eT, uword N> arma_hot inline static eT   det_tiny(const eT* A);
+  template<typename eT, uword N> arma_hot inline static bool solve_tiny(eT* out, const eT* A, const eT* B, const uword B_n_cols);
+  template<typename eT, uword N> arma_hot inline static bool chol_tiny(eT* out, const eT* A, const uword layout);
+  template<typename eT, uword K> arma_hot inline static void mul_tiny(eT* out, const eT* A, const eT* B, const uword M, const uword N);
+  
+  template<typename eT> inline static bool inv_slice(eT* out, const eT* A, const uword N);
+  template<typename eT> inline static eT   det_slice(const eT* A, const uword N);
+  template<typename eT> inline static bool solve_slice(eT* out, const eT* A, const eT* B, const uword N, const uword B_n_cols);
+  template<typename eT> inline static bool chol_slice(eT* out, const eT* A, const uword N, const uword layout);
+  template<typename eT> inline static void mul_slice(eT* out, const eT* A, const eT* B, const uword M, const uword K, const uword N);
+  
+  //
+  
+  template<typename eT> inline static bool inv(Cube<eT>& out, const Cube<eT>& A);
+  template<typename eT> inline static void det(Col<eT>& out, const Cube<eT>& A);
+  template<typename eT> inline static bool solve(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B);
+  template<typename eT> inline static bool chol(Cube<eT>& out, const Cube<eT>& A, const uword layout);
+  
+  template<typename eT> inline static void mul(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B);
+  template<typename eT> inline static void mul(Cube<eT>& out, const Mat<eT>&  A, const Cube<eT>& B);
+  template<typename eT> inline static void mul(Cube<eT>& out, const Cube<eT>& A, const Mat<eT>&  B);
+  
+  template<typename eT> inline static void mul_noalias(Cube<eT>& out, const eT* A_mem, const uword A_stride, const eT* B_mem, const uword B_stride, const uword M, const uword K, const uword N, const uword n_slices);
+  };
+
+
+
+//! @}
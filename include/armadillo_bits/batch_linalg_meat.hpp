@@ -0,0 +1,728 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_linalg
+//! @{
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::use_mp(const uword n_slices, const uword n_elem)
+  {
+  return ( arma_config::openmp && (n_slices > 1) && mp_gate<eT>::eval(n_elem) );
+  }
+
+
+
+//! LU decomposition with partial pivoting, in-place; returns false for an exactly singular matrix
+template<typename eT, uword N>
+arma_hot
+inline
+bool
+batch_linalg::lu_tiny(eT* A, uword* piv)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  for(uword k=0; k < N; ++k)
+    {
+    uword p     = k;
+    T     p_abs = std::abs(A[k + k*N]);
+    
+    for(uword r=(k+1); r < N; ++r)
+      {
+      const T r_abs = std::abs(A[r + k*N]);
+      
+      if(r_abs > p_abs)  { p = r; p_abs = r_abs; }
+      }
+    
+    piv[k] = p;
+    
+    if(p_abs == T(0))  { return false; }
+    
+    if(p != k)
+      {
+      for(uword c=0; c < N; ++c)  { std::swap(A[k + c*N], A[p + c*N]); }
+      }
+    
+    const eT inv_pivot = eT(1) / A[k + k*N];
+    
+    for(uword r=(k+1); r < N; ++r)  { A[r + k*N] *= inv_pivot; }
+    
+    for(uword c=(k+1); c < N; ++c)
+      {
+      const eT val = A[k + c*N];
+      
+      for(uword r=(k+1); r < N; ++r)  { A[r + c*N] -= A[r + k*N] * val; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! solve LU*x = P*b in-place, using the output of lu_tiny()
+template<typename eT, uword N>
+arma_hot
+inline
+void
+batch_linalg::lu_solve_tiny(eT* x, const eT* LU, const uword* piv)
+  {
+  for(uword k=0; k < N; ++k)
+    {
+    if(piv[k] != k)  { std::swap(x[k], x[piv[k]]); }
+    }
+  
+  for(uword r=1; r < N; ++r)
+    {
+    eT acc = x[r];
+    
+    for(uword k=0; k < r; ++k)  { acc -= LU[r + k*N] * x[k]; }
+    
+    x[r] = acc;
+    }
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword r = N-1-i;
+    
+    eT acc = x[r];
+    
+    for(uword k=(r+1); k < N; ++k)  { acc -= LU[r + k*N] * x[k]; }
+    
+    x[r] = acc / LU[r + r*N];
+    }
+  }
+
+
+
+template<typename eT, uword N>
+arma_hot
+inline
+bool
+batch_linalg::inv_tiny(eT* out, const eT* A)
+  {
+  eT    LU[N*N];
+  uword piv[N];
+  
+  arrayops::copy(LU, A, N*N);
+  
+  if(batch_linalg::lu_tiny<eT,N>(LU, piv) == false)  { return false; }
+  
+  for(uword c=0; c < N; ++c)
+    {
+    eT* x = &(out[c*N]);
+    
+    for(uword r=0; r < N; ++r)  { x[r] = (r == c) ? eT(1) : eT(0); }
+    
+    batch_linalg::lu_solve_tiny<eT,N>(x, LU, piv);
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT, uword N>
+arma_hot
+inline
+eT
+batch_linalg::det_tiny(const eT* A)
+  {
+  eT    LU[N*N];
+  uword piv[N];
+  
+  arrayops::copy(LU, A, N*N);
+  
+  if(batch_linalg::lu_tiny<eT,N>(LU, piv) == false)  { return eT(0); }
+  
+  eT val = eT(1);
+  
+  for(uword k=0; k < N; ++k)
+    {
+    val *= (piv[k] == k) ? LU[k + k*N] : -(LU[k + k*N]);
+    }
+  
+  return val;
+  }
+
+
+
+template<typename eT, uword N>
+arma_hot
+inline
+bool
+batch_linalg::solve_tiny(eT* out, const eT* A, const eT* B, const uword B_n_cols)
+  {
+  eT    LU[N*N];
+  uword piv[N];
+  
+  arrayops::copy(LU, A, N*N);
+  
+  if(batch_linalg::lu_tiny<eT,N>(LU, piv) == false)  { return false; }
+  
+  for(uword c=0; c < B_n_cols; ++c)
+    {
+    eT x[N];
+    
+    arrayops::copy(x, &(B[c*N]), N);
+    
+    batch_linalg::lu_solve_tiny<eT,N>(x, LU, piv);
+    
+    arrayops::copy(&(out[c*N]), x, N);
+    }
+  
+  return true;
+  }
+
+
+
+//! Cholesky decomposition, using only the upper triangle of A if layout is 0, or the lower triangle otherwise (as per LAPACK)
+template<typename eT, uword N>
+arma_hot
+inline
+bool
+batch_linalg::chol_tiny(eT* out, const eT* A, const uword layout)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  // U starts as zero, so that the sums below can run over the full columns:
+  // entries which have not been computed yet do not contribute
+  
+  eT U[N*N];
+  
+  arrayops::fill_zeros(U, N*N);
+  
+  for(uword j=0; j < N; ++j)
+    {
+    const eT* U_colj = &(U[j*N]);
+    
+    T d = access::tmp_real(A[j + j*N]);
+    
+    for(uword k=0; k < N; ++k)
+      {
+      const T val = std::abs(U_colj[k]);
+      
+      d -= val*val;
+      }
+    
+    if( (d <= T(0)) || arma_isnan(d) )  { return false; }
+    
+    const T U_jj = std::sqrt(d);
+    
+    U[j + j*N] = eT(U_jj);
+    
+    for(uword c=(j+1); c < N; ++c)
+      {
+      const eT* U_colc = &(U[c*N]);
+      
+      // as in potrf(), only the triangle specified by layout is read
+      eT acc = (layout == 0) ? A[j + c*N] : access::alt_conj(A[c + j*N]);
+      
+      for(uword k=0; k < N; ++k)  { acc -= access::alt_conj(U_colj[k]) * U_colc[k]; }
+      
+      U[j + c*N] = acc / U_jj;
+      }
+    }
+  
+  if(layout == 0)
+    {
+    arrayops::copy(out, U, N*N);
+    }
+  else
+    {
+    for(uword c=0; c < N; ++c)
+    for(uword r=0; r < N; ++r)
+      {
+      out[r + c*N] = access::alt_conj(U[c + r*N]);
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! out = A*B, where A has size M x K and B has size K x N
+template<typename eT, uword K>
+arma_hot
+inline
+void
+batch_linalg::mul_tiny(eT* out, const eT* A, const eT* B, const uword M, const uword N)
+  {
+  for(uword c=0; c < N; ++c)
+    {
+    const eT* B_col = &(B[c*K]);
+    
+    for(uword r=0; r < M; ++r)
+      {
+      eT acc = eT(0);
+      
+      for(uword k=0; k < K; ++k)  { acc += A[r + k*M] * B_col[k]; }
+      
+      out[r + c*M] = acc;
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::inv_slice(eT* out, const eT* A, const uword N)
+  {
+  switch(N)
+    {
+    case 0:  return true;
+    case 1:  return batch_linalg::inv_tiny<eT,1>(out, A);
+    case 2:  return batch_linalg::inv_tiny<eT,2>(out, A);
+    case 3:  return batch_linalg::inv_tiny<eT,3>(out, A);
+    case 4:  return batch_linalg::inv_tiny<eT,4>(out, A);
+    case 5:  return batch_linalg::inv_tiny<eT,5>(out, A);
+    case 6:  return batch_linalg::inv_tiny<eT,6>(out, A);
+    case 7:  return batch_linalg::inv_tiny<eT,7>(out, A);
+    case 8:  return batch_linalg::inv_tiny<eT,8>(out, A);
+    default: ;
+    }
+  
+  const Mat<eT> AA('j', A, N, N);
+  
+  Mat<eT> out_mat(out, N, N, false, true);
+  
+  return auxlib::inv(out_mat, AA);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+batch_linalg::det_slice(const eT* A, const uword N)
+  {
+  switch(N)
+    {
+    case 0:  return eT(1);
+    case 1:  return batch_linalg::det_tiny<eT,1>(A);
+    case 2:  return batch_linalg::det_tiny<eT,2>(A);
+    case 3:  return batch_linalg::det_tiny<eT,3>(A);
+    case 4:  return batch_linalg::det_tiny<eT,4>(A);
+    case 5:  return batch_linalg::det_tiny<eT,5>(A);
+    case 6:  return batch_linalg::det_tiny<eT,6>(A);
+    case 7:  return batch_linalg::det_tiny<eT,7>(A);
+    case 8:  return batch_linalg::det_tiny<eT,8>(A);
+    default: ;
+    }
+  
+  const Mat<eT> AA('j', A, N, N);
+  
+  return auxlib::det(AA);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::solve_slice(eT* out, const eT* A, const eT* B, const uword N, const uword B_n_cols)
+  {
+  switch(N)
+    {
+    case 0:  return true;
+    case 1:  return batch_linalg::solve_tiny<eT,1>(out, A, B, B_n_cols);
+    case 2:  return batch_linalg::solve_tiny<eT,2>(out, A, B, B_n_cols);
+    case 3:  return batch_linalg::solve_tiny<eT,3>(out, A, B, B_n_cols);
+    case 4:  return batch_linalg::solve_tiny<eT,4>(out, A, B, B_n_cols);
+    case 5:  return batch_linalg::solve_tiny<eT,5>(out, A, B, B_n_cols);
+    case 6:  return batch_linalg::solve_tiny<eT,6>(out, A, B, B_n_cols);
+    case 7:  return batch_linalg::solve_tiny<eT,7>(out, A, B, B_n_cols);
+    case 8:  return batch_linalg::solve_tiny<eT,8>(out, A, B, B_n_cols);
+    default: ;
+    }
+  
+  Mat<eT> AA(A, N, N);
+  
+  const Mat<eT> BB('j', B, N, B_n_cols);
+  
+  Mat<eT> out_mat(out, N, B_n_cols, false, true);
+  
+  return auxlib::solve_square_fast(out_mat, AA, BB);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::chol_slice(eT* out, const eT* A, const uword N, const uword layout)
+  {
+  switch(N)
+    {
+    case 0:  return true;
+    case 1:  return batch_linalg::chol_tiny<eT,1>(out, A, layout);
+    case 2:  return batch_linalg::chol_tiny<eT,2>(out, A, layout);
+    case 3:  return batch_linalg::chol_tiny<eT,3>(out, A, layout);
+    case 4:  return batch_linalg::chol_tiny<eT,4>(out, A, layout);
+    case 5:  return batch_linalg::chol_tiny<eT,5>(out, A, layout);
+    case 6:  return batch_linalg::chol_tiny<eT,6>(out, A, layout);
+    case 7:  return batch_linalg::chol_tiny<eT,7>(out, A, layout);
+    case 8:  return batch_linalg::chol_tiny<eT,8>(out, A, layout);
+    default: ;
+    }
+  
+  Mat<eT> out_mat(out, N, N, false, true);
+  
+  arrayops::copy(out, A, N*N);
+  
+  return auxlib::chol(out_mat, layout);
+  }
+
+
+
+template<typename eT>
+inline
+void
+batch_linalg::mul_slice(eT* out, const eT* A, const eT* B, const uword M, const uword K, const uword N)
+  {
+  if( (M <= uword(tiny_max)) && (N <= uword(tiny_max)) )
+    {
+    switch(K)
+      {
+      case 1:  batch_linalg::mul_tiny<eT,1>(out, A, B, M, N); return;
+      case 2:  batch_linalg::mul_tiny<eT,2>(out, A, B, M, N); return;
+      case 3:  batch_linalg::mul_tiny<eT,3>(out, A, B, M, N); return;
+      case 4:  batch_linalg::mul_tiny<eT,4>(out, A, B, M, N); return;
+      case 5:  batch_linalg::mul_tiny<eT,5>(out, A, B, M, N); return;
+      case 6:  batch_linalg::mul_tiny<eT,6>(out, A, B, M, N); return;
+      case 7:  batch_linalg::mul_tiny<eT,7>(out, A, B, M, N); return;
+      case 8:  batch_linalg::mul_tiny<eT,8>(out, A, B, M, N); return;
+      default: ;
+      }
+    }
+  
+  const Mat<eT> AA('j', A, M, K);
+  const Mat<eT> BB('j', B, K, N);
+  
+  Mat<eT> out_mat(out, M, N, false, true);
+  
+  glue_times::apply<eT, false, false, false>(out_mat, AA, BB, eT(0));
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::inv(Cube<eT>& out, const Cube<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "inv(): given cube must have square slices" );
+  
+  if(&out == &A)
+    {
+    Cube<eT> tmp;
+    
+    const bool status = batch_linalg::inv(tmp, A);
+    
+    out.steal_mem(tmp);
+    
+    return status;
+    }
+  
+  const uword N        = A.n_rows;
+  const uword n_slices = A.n_slices;
+  
+  out.set_size(N, N, n_slices);
+  
+  const bool use_mp    = batch_linalg::use_mp<eT>(n_slices, A.n_elem);
+  const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  
+  arma_ignore(n_threads);
+  
+  bool status = true;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp) reduction(&&:status)
+  #endif
+  for(uword s=0; s < n_slices; ++s)
+    {
+    if(batch_linalg::inv_slice(out.slice_memptr(s), A.slice_memptr(s), N) == false)  { status = false; }
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+void
+batch_linalg::det(Col<eT>& out, const Cube<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "det(): given cube must have square slices" );
+  
+  const uword N        = A.n_rows;
+  const uword n_slices = A.n_slices;
+  
+  out.set_size(n_slices);
+  
+  eT* out_mem = out.memptr();
+  
+  const bool use_mp    = batch_linalg::use_mp<eT>(n_slices, A.n_elem);
+  const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  
+  arma_ignore(n_threads);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword s=0; s < n_slices; ++s)
+    {
+    out_mem[s] = batch_linalg::det_slice(A.slice_memptr(s), N);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::solve(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "solve(): given cube A must have square slices" );
+  
+  arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the slices of the given cubes must be the same" );
+  
+  arma_debug_check( (A.n_slices != B.n_slices), "solve(): given cubes must have the same number of slices" );
+  
+  if( (&out == &A) || (&out == &B) )
+    {
+    Cube<eT> tmp;
+    
+    const bool status = batch_linalg::solve(tmp, A, B);
+    
+    out.steal_mem(tmp);
+    
+    return status;
+    }
+  
+  const uword N        = A.n_rows;
+  const uword B_n_cols = B.n_cols;
+  const uword n_slices = A.n_slices;
+  
+  out.set_size(N, B_n_cols, n_slices);
+  
+  const bool use_mp    = batch_linalg::use_mp<eT>(n_slices, A.n_elem + B.n_elem);
+  const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  
+  arma_ignore(n_threads);
+  
+  bool status = true;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp) reduction(&&:status)
+  #endif
+  for(uword s=0; s < n_slices; ++s)
+    {
+    if(batch_linalg::solve_slice(out.slice_memptr(s), A.slice_memptr(s), B.slice_memptr(s), N, B_n_cols) == false)  { status = false; }
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::chol(Cube<eT>& out, const Cube<eT>& A, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "chol(): given cube must have square slices" );
+  
+  if(&out == &A)
+    {
+    Cube<eT> tmp;
+    
+    const bool status = batch_linalg::chol(tmp, A, layout);
+    
+    out.steal_mem(tmp);
+    
+    return status;
+    }
+  
+  const uword N        = A.n_rows;
+  const uword n_slices = A.n_slices;
+  
+  out.set_size(N, N, n_slices);
+  
+  const bool use_mp    = batch_linalg::use_mp<eT>(n_slices, A.n_elem);
+  const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  
+  arma_ignore(n_threads);
+  
+  bool status = true;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp) reduction(&&:status)
+  #endif
+  for(uword s=0; s < n_slices; ++s)
+    {
+    if(batch_linalg::chol_slice(out.slice_memptr(s), A.slice_memptr(s), N, layout) == false)  { status = false; }
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+void
+batch_linalg::mul(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "mul_slices()");
+  
+  arma_debug_check( (A.n_slices != B.n_slices), "mul_slices(): given cubes must have the same number of slices" );
+  
+  if( (&out == &A) || (&out == &B) )
+    {
+    Cube<eT> tmp;
+    
+    batch_linalg::mul(tmp, A, B);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(A.n_rows, B.n_cols, A.n_slices);
+  
+  batch_linalg::mul_noalias(out, A.memptr(), A.n_elem_slice, B.memptr(), B.n_elem_slice, A.n_rows, A.n_cols, B.n_cols, A.n_slices);
+  }
+
+
+
+//! the same matrix A is applied to all slices of B;
+//! as the slices of B are stored contiguously, this is a single matrix multiplication
+template<typename eT>
+inline
+void
+batch_linalg::mul(Cube<eT>& out, const Mat<eT>& A, const Cube<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "mul_slices()");
+  
+  if(&out == &B)
+    {
+    Cube<eT> tmp;
+    
+    batch_linalg::mul(tmp, A, B);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(A.n_rows, B.n_cols, B.n_slices);
+  
+  if( (A.n_rows <= uword(tiny_max)) && (B.n_cols <= uword(tiny_max)) && (A.n_cols <= uword(tiny_max)) )
+    {
+    batch_linalg::mul_noalias(out, A.memptr(), uword(0), B.memptr(), B.n_elem_slice, A.n_rows, A.n_cols, B.n_cols, B.n_slices);
+    
+    return;
+    }
+  
+  const Mat<eT> BB('j', B.memptr(), B.n_rows, B.n_cols * B.n_slices);
+  
+  Mat<eT> out_mat(out.memptr(), A.n_rows, B.n_cols * B.n_slices, false, true);
+  
+  glue_times::apply<eT, false, false, false>(out_mat, A, BB, eT(0));
+  }
+
+
+
+//! the same matrix B is applied to all slices of A
+template<typename eT>
+inline
+void
+batch_linalg::mul(Cube<eT>& out, const Cube<eT>& A, const Mat<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "mul_slices()");
+  
+  if(&out == &A)
+    {
+    Cube<eT> tmp;
+    
+    batch_linalg::mul(tmp, A, B);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(A.n_rows, B.n_cols, A.n_slices);
+  
+  batch_linalg::mul_noalias(out, A.memptr(), A.n_elem_slice, B.memptr(), uword(0), A.n_rows, A.n_cols, B.n_cols, A.n_slices);
+  }
+
+
+
+template<typename eT>
+inline
+void
+batch_linalg::mul_noalias(Cube<eT>& out, const eT* A_mem, const uword A_stride, const eT* B_mem, const uword B_stride, const uword M, const uword K, const uword N, const uword n_slices)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(out.n_elem == 0)  { return; }
+  
+  if(K == 0)  { out.zeros(); return; }
+  
+  const uword out_stride = out.n_elem_slice;
+  
+  eT* out_mem = out.memptr();
+  
+  const bool use_mp    = batch_linalg::use_mp<eT>(n_slices, out.n_elem * K);
+  const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  
+  arma_ignore(n_threads);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword s=0; s < n_slices; ++s)
+    {
+    batch_linalg::mul_slice(&(out_mem[s*out_stride]), &(A_mem[s*A_stride]), &(B_mem[s*B_stride]), M, K, N);
+    }
+  }
+
+
+
+//! @}
@@ -0,0 +1,384 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup chol_factor
+//! @{
+
+
+
+template<typename eT>
+inline
+chol_factor<eT>::~chol_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+chol_factor<eT>::chol_factor()
+  : norm_val(pod_type(0))
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+chol_factor<eT>::chol_factor(const Base<eT,T1>& X)
+  : norm_val(pod_type(0))
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = (*this).compute(X);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("chol_factor(): decomposition failed");
+    }
+  }
+
+
+
+//! factorise X, which must be symmetric/hermitian;
+//! false is returned (and the object is reset) if X is not positive definite
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::compute(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  L = X.get_ref();
+  
+  arma_debug_check( (L.is_square() == false), "chol_factor::compute(): given matrix must be square sized" );
+  
+  norm_val = pod_type(0);
+  
+  if(L.is_empty())  { return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(L);
+    
+    char     norm_id = '1';
+    char     uplo    = 'L';
+    blas_int n       = blas_int(L.n_rows);
+    blas_int info    = blas_int(0);
+    
+    podarray<pod_type> junk(1);
+    
+    norm_val = lapack::lange(&norm_id, &n, &n, L.memptr(), &n, junk.memptr());
+    
+    arma_extra_debug_print("lapack::potrf()");
+    lapack::potrf(&uplo, &n, L.memptr(), &n, &info);
+    
+    if(info != blas_int(0))  { (*this).reset(); return false; }
+    
+    return true;
+    }
+  #else
+    {
+    (*this).reset();
+    arma_stop_logic_error("chol_factor::compute(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! modify the decomposition to be the decomposition of A + x*x.t(), where A is the currently factorised matrix;
+//! false is returned (and the decomposition is unchanged) if x has non-finite elements
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::update(const Base<eT,T1>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(x.get_ref());
+  
+  arma_debug_check( (U.M.n_elem != L.n_rows) || ((U.M.n_rows != 1) && (U.M.n_cols != 1)), "chol_factor::update(): given object must be a vector with the same number of elements as the size of the factorised matrix" );
+  
+  if(U.M.is_finite() == false)  { return false; }
+  
+  if(L.is_empty())  { return true; }
+  
+  podarray<eT> w(U.M.memptr(), U.M.n_elem);
+  
+  norm_val += norm(U.M, 1) * norm(U.M, "inf");
+  
+  // as the diagonal of L is positive, an update can't fail
+  return chol_factor<eT>::rank_one_modify(L, w.memptr(), false);
+  }
+
+
+
+//! modify the decomposition to be the decomposition of A - x*x.t(), where A is the currently factorised matrix;
+//! false is returned (and the decomposition is unchanged) if A - x*x.t() is not positive definite
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::downdate(const Base<eT,T1>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(x.get_ref());
+  
+  arma_debug_check( (U.M.n_elem != L.n_rows) || ((U.M.n_rows != 1) && (U.M.n_cols != 1)), "chol_factor::downdate(): given object must be a vector with the same number of elements as the size of the factorised matrix" );
+  
+  if(U.M.is_finite() == false)  { return false; }
+  
+  if(L.is_empty())  { return true; }
+  
+  podarray<eT> w(U.M.memptr(), U.M.n_elem);
+  
+  Mat<eT> tmp(L);
+  
+  const bool status = chol_factor<eT>::rank_one_modify(tmp, w.memptr(), true);
+  
+  if(status)
+    {
+    L.steal_mem(tmp);
+    
+    norm_val += norm(U.M, 1) * norm(U.M, "inf");
+    }
+  
+  return status;
+  }
+
+
+
+//! rank-1 modification of a lower triangular Cholesky factor via a sequence of rotations, in O(n^2) operations;
+//! for downdates hyperbolic rotations are used; w is overwritten
+template<typename eT>
+inline
+bool
+chol_factor<eT>::rank_one_modify(Mat<eT>& L, eT* w, const bool is_downdate)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef pod_type T;
+  
+  const uword N = L.n_rows;
+  
+  for(uword k=0; k < N; ++k)
+    {
+    eT* L_colptr = L.colptr(k);
+    
+    const T  L_kk   = access::tmp_real(L_colptr[k]);
+    const eT w_k    = w[k];
+    const T  w_k_sq = std::abs(w_k) * std::abs(w_k);
+    
+    const T r_sq = (is_downdate) ? (L_kk*L_kk - w_k_sq) : (L_kk*L_kk + w_k_sq);
+    
+    if( (r_sq > T(0)) == false )  { return false; }
+    
+    const T  r = std::sqrt(r_sq);
+    const T  c = r   / L_kk;
+    const eT t = w_k / L_kk;
+    
+    const eT t_conj = access::alt_conj(t);
+    
+    L_colptr[k] = eT(r);
+    
+    if(is_downdate)
+      {
+      for(uword j=k+1; j < N; ++j)
+        {
+        L_colptr[j] = (L_colptr[j] - t_conj * w[j]) / c;
+        w[j]        = c * w[j] - t * L_colptr[j];
+        }
+      }
+    else
+      {
+      for(uword j=k+1; j < N; ++j)
+        {
+        L_colptr[j] = (L_colptr[j] + t_conj * w[j]) / c;
+        w[j]        = c * w[j] - t * L_colptr[j];
+        }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! solve A*X = B, where A is the factorised matrix
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::solve(Mat<eT>& out, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  out = B.get_ref();
+  
+  arma_debug_check( (out.n_rows != L.n_rows), "chol_factor::solve(): number of rows in given matrix must match the size of the factorised matrix" );
+  
+  if(out.is_empty())  { return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(out);
+    
+    char     uplo = 'L';
+    blas_int n    = blas_int(L.n_rows);
+    blas_int nrhs = blas_int(out.n_cols);
+    blas_int info = blas_int(0);
+    
+    arma_extra_debug_print("lapack::potrs()");
+    lapack::potrs(&uplo, &n, &nrhs, L.memptr(), &n, out.memptr(), &n, &info);
+    
+    if(info != blas_int(0))  { out.soft_reset(); return false; }
+    
+    return true;
+    }
+  #else
+    {
+    out.soft_reset();
+    arma_stop_logic_error("chol_factor::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+chol_factor<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = (*this).solve(out, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("chol_factor::solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+eT
+chol_factor<eT>::det() const
+  {
+  arma_extra_debug_sigprint();
+  
+  pod_type val = pod_type(1);
+  
+  for(uword i=0; i < L.n_rows; ++i)
+    {
+    const pod_type L_ii = access::tmp_real( L.at(i,i) );
+    
+    val *= L_ii * L_ii;
+    }
+  
+  return eT(val);
+  }
+
+
+
+//! log(det); as the factorised matrix is positive definite, the sign is always +1
+template<typename eT>
+inline
+void
+chol_factor<eT>::log_det(eT& out_val, pod_type& out_sign) const
+  {
+  arma_extra_debug_sigprint();
+  
+  pod_type val = pod_type(0);
+  
+  for(uword i=0; i < L.n_rows; ++i)
+    {
+    val += std::log( access::tmp_real( L.at(i,i) ) );
+    }
+  
+  out_val  = eT(pod_type(2) * val);
+  out_sign = pod_type(1);
+  }
+
+
+
+//! reciprocal condition number of the factorised matrix (estimate in the 1-norm);
+//! after update() or downdate() the 1-norm of the matrix is bounded from above, so the estimate is conservative
+template<typename eT>
+inline
+typename chol_factor<eT>::pod_type
+chol_factor<eT>::rcond() const
+  {
+  arma_extra_debug_sigprint();
+  
+  if(L.is_empty())  { return Datum<pod_type>::inf; }
+  
+  return auxlib::chol_rcond(L, norm_val);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+chol_factor<eT>::n_rows() const
+  {
+  return L.n_rows;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+chol_factor<eT>::is_empty() const
+  {
+  return L.is_empty();
+  }
+
+
+
+template<typename eT>
+inline
+void
+chol_factor<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  L.reset();
+  
+  norm_val = pod_type(0);
+  }
+
+
+
+//! @}
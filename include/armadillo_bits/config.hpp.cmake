@@ -105,6 +105,20 @@
 //// Note that ARMA_64BIT_WORD is automatically enabled when a C++11 compiler is detected.
 #endif
 
+#if !defined(ARMA_USE_PHILOX_RNG)
+// #define ARMA_USE_PHILOX_RNG
+//// Uncomment the above line to use the counter-based Philox4x32-10 random number generator for randu(), randn() and randi().
+//// Large fills are generated in parallel, and the results do not depend on the number of threads.
+//// Independent streams can be selected via arma_rng::set_stream(). Requires a C++11 compiler.
+#endif
+
+#if !defined(ARMA_USE_COMPENSATED_SUM)
+// #define ARMA_USE_COMPENSATED_SUM
+//// Uncomment the above line to use compensated summation in accu(), sum(), mean() and dot().
+//// This reduces rounding errors (particularly for float elements), at the cost of extra operations per element.
+//// The results do not depend on the number of OpenMP threads. Dot products are then not computed by BLAS.
+#endif
+
 #if !defined(ARMA_USE_HDF5)
 // #define ARMA_USE_HDF5
 //// Uncomment the above line to allow the ability to save and load matrices stored in HDF5 format;
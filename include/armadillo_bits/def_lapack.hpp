@@ -76,6 +76,11 @@
   #define arma_cpotri cpotri
   #define arma_zpotri zpotri
   
+  #define arma_spotrs spotrs
+  #define arma_dpotrs dpotrs
+  #define arma_cpotrs cpotrs
+  #define arma_zpotrs zpotrs
+  
   #define arma_sgeqrf sgeqrf
   #define arma_dgeqrf dgeqrf
   #define arma_cgeqrf cgeqrf
@@ -178,6 +183,11 @@
   #define arma_cgecon cgecon
   #define arma_zgecon zgecon
   
+  #define arma_spocon spocon
+  #define arma_dpocon dpocon
+  #define arma_cpocon cpocon
+  #define arma_zpocon zpocon
+  
   #define arma_ilaenv ilaenv
   
   #define arma_ssytrs ssytrs
@@ -262,6 +272,11 @@
   #define arma_cpotri CPOTRI
   #define arma_zpotri ZPOTRI
   
+  #define arma_spotrs SPOTRS
+  #define arma_dpotrs DPOTRS
+  #define arma_cpotrs CPOTRS
+  #define arma_zpotrs ZPOTRS
+  
   #define arma_sgeqrf SGEQRF
   #define arma_dgeqrf DGEQRF
   #define arma_cgeqrf CGEQRF
@@ -364,6 +379,11 @@
   #define arma_cgecon CGECON
   #define arma_zgecon ZGECON
   
+  #define arma_spocon SPOCON
+  #define arma_dpocon DPOCON
+  #define arma_cpocon CPOCON
+  #define arma_zpocon ZPOCON
+  
   #define arma_ilaenv ILAENV
   
   #define arma_ssytrs SSYTRS
@@ -467,6 +487,12 @@ extern "C"
   void arma_fortran(arma_cpotri)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* info);
   void arma_fortran(arma_zpotri)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* info);
   
+  // solve linear equations using Cholesky decomposition result
+  void arma_fortran(arma_spotrs)(char* uplo, blas_int* n, blas_int* nrhs, const  float* a, blas_int* lda,  float* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dpotrs)(char* uplo, blas_int* n, blas_int* nrhs, const double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cpotrs)(char* uplo, blas_int* n, blas_int* nrhs, const   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zpotrs)(char* uplo, blas_int* n, blas_int* nrhs, const   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info);
+  
   // QR decomposition
   void arma_fortran(arma_sgeqrf)(blas_int* m, blas_int* n,  float* a, blas_int* lda,  float* tau,  float* work, blas_int* lwork, blas_int* info);
   void arma_fortran(arma_dgeqrf)(blas_int* m, blas_int* n, double* a, blas_int* lda, double* tau, double* work, blas_int* lwork, blas_int* info);
@@ -605,6 +631,14 @@ extern "C"
   void arma_fortran(arma_cgecon)(char* norm, blas_int* n, void* a, blas_int* lda,  float* anorm,  float* rcond, void* work,  float* rwork, blas_int* info);
   void arma_fortran(arma_zgecon)(char* norm, blas_int* n, void* a, blas_int* lda, double* anorm, double* rcond, void* work, double* rwork, blas_int* info);
   
+  // reciprocal of condition number via Cholesky decomposition result (real)
+  void arma_fortran(arma_spocon)(char* uplo, blas_int* n,  float* a, blas_int* lda,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dpocon)(char* uplo, blas_int* n, double* a, blas_int* lda, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // reciprocal of condition number via Cholesky decomposition result (complex)
+  void arma_fortran(arma_cpocon)(char* uplo, blas_int* n, void* a, blas_int* lda,  float* anorm,  float* rcond, void* work,  float* rwork, blas_int* info);
+  void arma_fortran(arma_zpocon)(char* uplo, blas_int* n, void* a, blas_int* lda, double* anorm, double* rcond, void* work, double* rwork, blas_int* info);
+  
   // obtain parameters according to the local configuration of lapack
   blas_int arma_fortran(arma_ilaenv)(blas_int* ispec, char* name, char* opts, blas_int* n1, blas_int* n2, blas_int* n3, blas_int* n4);
   
@@ -0,0 +1,44 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup each_engine
+//! @{
+
+
+//! Element-wise kernels for the arithmetic forms of each_col(), each_row() and each_slice().
+//! The operation is given by eglue_plus, eglue_minus, eglue_schur or eglue_div.
+//! Each column (or slice) is processed by a contiguous loop which can be vectorised;
+//! with OpenMP enabled, the columns (or slices) of large objects are processed in parallel.
+class each_engine
+  {
+  public:
+  
+  template<typename eT> inline static bool use_mp(const uword n_elem, const uword n_parts);
+  
+  template<typename eglue_type, typename eT> arma_hot inline static void apply(eT* out, const eT* A, const eT* B, const uword N);
+  template<typename eglue_type, typename eT> arma_hot inline static void apply(eT* out, const eT* A, const eT  B, const uword N);
+  template<typename eglue_type, typename eT> arma_hot inline static void apply(eT* out, const eT  A, const eT* B, const uword N);
+  
+  template<typename eglue_type, typename out_type, typename parent>
+  inline static void apply_mat(out_type& out, const parent& P, const typename parent::elem_type* A_mem, const unsigned int mode, const bool reverse = false);
+  
+  template<typename eglue_type, typename eT>
+  inline static void apply_cube(Cube<eT>& out, const Cube<eT>& P, const eT* A_mem, const bool reverse = false);
+  };
+
+
+
+//! @}
@@ -0,0 +1,151 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup each_engine
+//! @{
+
+
+
+template<typename eT>
+inline
+bool
+each_engine::use_mp(const uword n_elem, const uword n_parts)
+  {
+  return ( arma_config::openmp && (n_parts > 1) && mp_gate<eT>::eval(n_elem) );
+  }
+
+
+
+//! out[i] = A[i] (op) B[i];  out may be equal to A or B
+template<typename eglue_type, typename eT>
+arma_hot
+inline
+void
+each_engine::apply(eT* out, const eT* A, const eT* B, const uword N)
+  {
+       if(is_same_type<eglue_type, eglue_plus >::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] + B[i]; } }
+  else if(is_same_type<eglue_type, eglue_minus>::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] - B[i]; } }
+  else if(is_same_type<eglue_type, eglue_schur>::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] * B[i]; } }
+  else if(is_same_type<eglue_type, eglue_div  >::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] / B[i]; } }
+  }
+
+
+
+//! out[i] = A[i] (op) B;  out may be equal to A
+template<typename eglue_type, typename eT>
+arma_hot
+inline
+void
+each_engine::apply(eT* out, const eT* A, const eT B, const uword N)
+  {
+       if(is_same_type<eglue_type, eglue_plus >::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] + B; } }
+  else if(is_same_type<eglue_type, eglue_minus>::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] - B; } }
+  else if(is_same_type<eglue_type, eglue_schur>::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] * B; } }
+  else if(is_same_type<eglue_type, eglue_div  >::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A[i] / B; } }
+  }
+
+
+
+//! out[i] = A (op) B[i];  out may be equal to B
+template<typename eglue_type, typename eT>
+arma_hot
+inline
+void
+each_engine::apply(eT* out, const eT A, const eT* B, const uword N)
+  {
+       if(is_same_type<eglue_type, eglue_plus >::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A + B[i]; } }
+  else if(is_same_type<eglue_type, eglue_minus>::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A - B[i]; } }
+  else if(is_same_type<eglue_type, eglue_schur>::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A * B[i]; } }
+  else if(is_same_type<eglue_type, eglue_div  >::yes)  { for(uword i=0; i < N; ++i)  { out[i] = A / B[i]; } }
+  }
+
+
+
+//! out = P (op) A, where A is a column vector (mode 0) or a row vector (mode 1) which is broadcast;
+//! if reverse is true, out = A (op) P instead;
+//! out must have the same size as P, and may be P itself
+template<typename eglue_type, typename out_type, typename parent>
+inline
+void
+each_engine::apply_mat(out_type& out, const parent& P, const typename parent::elem_type* A_mem, const unsigned int mode, const bool reverse)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename parent::elem_type eT;
+  
+  const uword P_n_rows = P.n_rows;
+  const uword P_n_cols = P.n_cols;
+  
+  const bool use_mp = each_engine::use_mp<eT>(P.n_elem, P_n_cols);
+  
+  arma_ignore(use_mp);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(mp_thread_limit::get()) if(use_mp)
+  #endif
+  for(uword col=0; col < P_n_cols; ++col)
+    {
+          eT* out_mem = out.colptr(col);
+    const eT*   P_mem =   P.colptr(col);
+    
+    if(mode == 0)
+      {
+      if(reverse)  { each_engine::apply<eglue_type>(out_mem, A_mem, P_mem, P_n_rows); }
+      else         { each_engine::apply<eglue_type>(out_mem, P_mem, A_mem, P_n_rows); }
+      }
+    else
+      {
+      const eT A_val = A_mem[col];
+      
+      if(reverse)  { each_engine::apply<eglue_type>(out_mem, A_val, P_mem, P_n_rows); }
+      else         { each_engine::apply<eglue_type>(out_mem, P_mem, A_val, P_n_rows); }
+      }
+    }
+  }
+
+
+
+//! out = P (op) A for each slice of P, or A (op) P if reverse is true; out may be P itself
+template<typename eglue_type, typename eT>
+inline
+void
+each_engine::apply_cube(Cube<eT>& out, const Cube<eT>& P, const eT* A_mem, const bool reverse)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword P_n_slices     = P.n_slices;
+  const uword P_n_elem_slice = P.n_elem_slice;
+  
+  const bool use_mp = each_engine::use_mp<eT>(P.n_elem, P_n_slices);
+  
+  arma_ignore(use_mp);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(mp_thread_limit::get()) if(use_mp)
+  #endif
+  for(uword slice=0; slice < P_n_slices; ++slice)
+    {
+          eT* out_mem = out.slice_memptr(slice);
+    const eT*   P_mem =   P.slice_memptr(slice);
+    
+    if(reverse)  { each_engine::apply<eglue_type>(out_mem, A_mem, P_mem, P_n_elem_slice); }
+    else         { each_engine::apply<eglue_type>(out_mem, P_mem, A_mem, P_n_elem_slice); }
+    }
+  }
+
+
+
+//! @}
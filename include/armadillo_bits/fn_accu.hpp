@@ -29,12 +29,14 @@ accu_proxy_linear(const Proxy<T1>& P)
   
   typedef typename T1::elem_type eT;
   
-  eT val = eT(0);
-  
   typename Proxy<T1>::ea_type Pea = P.get_ea();
   
   const uword n_elem = P.get_n_elem();
   
+  if(arma_config::compensated_sum)  { return sum_engine::accumulate<eT>(Pea, n_elem, Proxy<T1>::use_mp); }
+  
+  eT val = eT(0);
+  
   if( arma_config::openmp && Proxy<T1>::use_mp && mp_gate<eT>::eval(n_elem) )
     {
     #if defined(ARMA_USE_OPENMP)
@@ -211,6 +213,8 @@ accu_proxy_at(const Proxy<T1>& P)
   
   typedef typename T1::elem_type eT;
   
+  if(arma_config::compensated_sum)  { return sum_engine::accumulate_at(P); }
+  
   if(arma_config::openmp && Proxy<T1>::use_mp && mp_gate<eT>::eval(P.get_n_elem()))
     {
     return accu_proxy_at_mp(P);
@@ -302,113 +306,58 @@ accu(const eGlue<T1,T2,eglue_schur>& expr)
 
 
 
-//! explicit handling of Hamming norm (also known as zero norm)
+//! explicit handling of repmat(): each element of the operand appears copies_per_row*copies_per_col times
 template<typename T1>
 arma_warn_unused
 inline
-uword
-accu(const mtOp<uword,T1,op_rel_noteq>& X)
+typename T1::elem_type
+accu(const Op<T1,op_repmat>& in)
   {
   arma_extra_debug_sigprint();
   
   typedef typename T1::elem_type eT;
   
-  const eT val = X.aux;
+  const uword n_copies = in.aux_uword_a * in.aux_uword_b;
   
-  const Proxy<T1> P(X.m);
+  if(n_copies == 0)  { return eT(0); }
   
-  uword n_nonzero = 0;
-  
-  if(Proxy<T1>::use_at == false)
-    {
-    typedef typename Proxy<T1>::ea_type ea_type;
-    
-          ea_type A      = P.get_ea();
-    const uword   n_elem = P.get_n_elem();
-    
-    for(uword i=0; i<n_elem; ++i)
-      {
-      n_nonzero += (A[i] != val) ? uword(1) : uword(0);
-      }
-    }
-  else
-    {
-    const uword P_n_cols = P.get_n_cols();
-    const uword P_n_rows = P.get_n_rows();
-    
-    if(P_n_rows == 1)
-      {
-      for(uword col=0; col < P_n_cols; ++col)
-        {
-        n_nonzero += (P.at(0,col) != val) ? uword(1) : uword(0);
-        }
-      }
-    else
-      {
-      for(uword col=0; col < P_n_cols; ++col)
-      for(uword row=0; row < P_n_rows; ++row)
-        {
-        n_nonzero += (P.at(row,col) != val) ? uword(1) : uword(0);
-        }
-      }
-    }
+  const quasi_unwrap<T1> U(in.m);
   
-  return n_nonzero;
+  return arrayops::accumulate(U.M.memptr(), U.M.n_elem) * eT(n_copies);
   }
 
 
 
-template<typename T1>
+//! count the elements satisfying a relational expression, without evaluating it into a Mat<uword>;
+//! this includes the Hamming norm (also known as zero norm), ie. accu(X != 0)
+template<typename T1, typename op_type>
 arma_warn_unused
 inline
 uword
-accu(const mtOp<uword,T1,op_rel_eq>& X)
+accu(const mtOp<uword,T1,op_type>& X, const typename arma_op_rel_only<op_type>::result* junk = 0)
   {
   arma_extra_debug_sigprint();
+  arma_ignore(junk);
   
-  typedef typename T1::elem_type eT;
-  
-  const eT val = X.aux;
-  
-  const Proxy<T1> P(X.m);
+  const rel_mask_op<T1, op_type> F(X);
   
-  uword n_nonzero = 0;
+  return rel_mask::count(F);
+  }
+
+
+
+template<typename T1, typename T2, typename glue_type>
+arma_warn_unused
+inline
+uword
+accu(const mtGlue<uword,T1,T2,glue_type>& X, const typename arma_glue_rel_only<glue_type>::result* junk = 0)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
   
-  if(Proxy<T1>::use_at == false)
-    {
-    typedef typename Proxy<T1>::ea_type ea_type;
-    
-          ea_type A      = P.get_ea();
-    const uword   n_elem = P.get_n_elem();
-    
-    for(uword i=0; i<n_elem; ++i)
-      {
-      n_nonzero += (A[i] == val) ? uword(1) : uword(0);
-      }
-    }
-  else
-    {
-    const uword P_n_cols = P.get_n_cols();
-    const uword P_n_rows = P.get_n_rows();
-    
-    if(P_n_rows == 1)
-      {
-      for(uword col=0; col < P_n_cols; ++col)
-        {
-        n_nonzero += (P.at(0,col) == val) ? uword(1) : uword(0);
-        }
-      }
-    else
-      {
-      for(uword col=0; col < P_n_cols; ++col)
-      for(uword row=0; row < P_n_rows; ++row)
-        {
-        n_nonzero += (P.at(row,col) == val) ? uword(1) : uword(0);
-        }
-      }
-    }
+  const rel_mask_glue<T1, T2, glue_type> F(X);
   
-  return n_nonzero;
+  return rel_mask::count(F);
   }
 
 
@@ -426,6 +375,13 @@ accu(const subview<eT>& X)
   const uword X_n_rows = X.n_rows;
   const uword X_n_cols = X.n_cols;
   
+  if(arma_config::compensated_sum && (X_n_rows > 1) && (X_n_cols > 1))
+    {
+    const Proxy< subview<eT> > P(X);
+    
+    return sum_engine::accumulate_at(P);
+    }
+  
   eT val = eT(0);
   
   if(X_n_rows == 1)
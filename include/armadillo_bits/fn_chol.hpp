@@ -40,6 +40,28 @@ chol
 
 
 
+//! fixed-size matrices: the type is kept, so that a kernel for the size can be selected at compile time
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< (is_Mat_fixed<T1>::value && is_supported_blas_type<typename T1::elem_type>::value), const Op<T1, op_chol> >::result
+chol
+  (
+  const T1&   X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != NULL) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  return Op<T1, op_chol>(X, ((sig == 'u') ? 0 : 1), 0 );
+  }
+
+
+
 template<typename T1>
 inline
 typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
@@ -69,4 +91,70 @@ chol
 
 
 
+//! Cholesky decomposition of each slice of a cube
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Cube<typename T1::elem_type> >::result
+chol
+  (
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const char sig = (layout != NULL) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  const unwrap_cube<T1> tmp(X.get_ref());
+  
+  Cube<eT> out;
+  
+  const bool status = batch_linalg::chol(out, tmp.M, ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("chol(): decomposition failed");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+chol
+  (
+            Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != NULL) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  const unwrap_cube<T1> tmp(X.get_ref());
+  
+  const bool status = batch_linalg::chol(out, tmp.M, ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn("chol(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
 //! @}
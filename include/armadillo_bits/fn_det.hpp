@@ -35,6 +35,31 @@ det
 
 
 
+//! fixed-size matrices: sizes from 5x5 to 16x16 use a kernel selected at compile time;
+//! smaller sizes are handled by auxlib::det() via closed forms
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< (is_Mat_fixed<T1>::value && is_supported_blas_type<typename T1::elem_type>::value), typename T1::elem_type >::result
+det
+  (
+  const T1& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  if( (fixed_dims<T1>::is_small_sq) && (fixed_dims<T1>::n_rows > 4) )
+    {
+    return batch_linalg::det_tiny<eT, fixed_dims<T1>::small_sq_N>(X.memptr());
+    }
+  
+  return auxlib::det(X);
+  }
+
+
+
 template<typename T1>
 arma_warn_unused
 inline
@@ -188,4 +213,28 @@ det(const T& x)
 
 
 
+//! determinant of each slice of a cube
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Col<typename T1::elem_type> >::result
+det
+  (
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> tmp(X.get_ref());
+  
+  Col<eT> out;
+  
+  batch_linalg::det(out, tmp.M);
+  
+  return out;
+  }
+
+
 //! @}
@@ -0,0 +1,121 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_eig_sym_rand
+//! @{
+
+
+
+//! k eigenvalues with largest magnitude of dense symmetric/hermitian matrix X, via randomised range finder
+template<typename T1>
+inline
+bool
+eig_sym_rand
+  (
+         Col<typename T1::pod_type>&     eigval,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const uword                            n_oversample = 10,
+  const uword                            n_iter       = 2,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  Mat<typename T1::elem_type> eigvec;
+  
+  const bool status = auxlib::eig_sym_rand(eigval, eigvec, X, k, n_oversample, n_iter);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_debug_warn("eig_sym_rand(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! k eigenvalues with largest magnitude of dense symmetric/hermitian matrix X, via randomised range finder
+template<typename T1>
+arma_warn_unused
+inline
+Col<typename T1::pod_type>
+eig_sym_rand
+  (
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const uword                            n_oversample = 10,
+  const uword                            n_iter       = 2,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  Col<typename T1::pod_type>  out;
+  Mat<typename T1::elem_type> eigvec;
+  
+  const bool status = auxlib::eig_sym_rand(out, eigvec, X, k, n_oversample, n_iter);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("eig_sym_rand(): decomposition failed");
+    }
+  
+  return out;
+  }
+
+
+
+//! k eigenvalues with largest magnitude and corresponding eigenvectors of dense symmetric/hermitian matrix X, via randomised range finder
+template<typename T1>
+inline
+bool
+eig_sym_rand
+  (
+         Col<typename T1::pod_type>&     eigval,
+         Mat<typename T1::elem_type>&    eigvec,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const uword                            n_oversample = 10,
+  const uword                            n_iter       = 2,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eig_sym_rand(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = auxlib::eig_sym_rand(eigval, eigvec, X, k, n_oversample, n_iter);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eig_sym_rand(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! @}
@@ -35,6 +35,23 @@ inv
 
 
 
+//! fixed-size matrices: the type is kept, so that a kernel for the size can be selected at compile time
+template<typename T1>
+arma_warn_unused
+arma_inline
+typename enable_if2< (is_Mat_fixed<T1>::value && is_supported_blas_type<typename T1::elem_type>::value), const Op<T1, op_inv> >::result
+inv
+  (
+  const T1& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  return Op<T1, op_inv>(X);
+  }
+
+
+
 //! NOTE: don't use this form: it will be removed
 template<typename T1>
 arma_deprecated
@@ -321,4 +338,56 @@ inv_sympd
 
 
 
+//! invert each slice of a cube
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Cube<typename T1::elem_type> >::result
+inv
+  (
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> tmp(X.get_ref());
+  
+  Cube<eT> out;
+  
+  const bool status = batch_linalg::inv(out, tmp.M);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("inv(): matrix seems singular");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+inv
+  (
+            Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube<T1> tmp(X.get_ref());
+  
+  const bool status = batch_linalg::inv(out, tmp.M);
+  
+  if(status == false)  { out.soft_reset(); }
+  
+  return status;
+  }
+
+
 //! @}
@@ -0,0 +1,103 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_mul_slices
+//! @{
+
+
+
+//! matrix multiplication of corresponding slices: out.slice(i) = A.slice(i) * B.slice(i)
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+Cube<typename T1::elem_type>
+mul_slices
+  (
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> UA(A.get_ref());
+  const unwrap_cube<T2> UB(B.get_ref());
+  
+  Cube<eT> out;
+  
+  batch_linalg::mul(out, UA.M, UB.M);
+  
+  return out;
+  }
+
+
+
+//! out.slice(i) = A * B.slice(i)
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+Cube<typename T1::elem_type>
+mul_slices
+  (
+  const     Base<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> UA(A.get_ref());
+  const unwrap_cube<T2>  UB(B.get_ref());
+  
+  Cube<eT> out;
+  
+  batch_linalg::mul(out, UA.M, UB.M);
+  
+  return out;
+  }
+
+
+
+//! out.slice(i) = A.slice(i) * B
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+Cube<typename T1::elem_type>
+mul_slices
+  (
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const     Base<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1>  UA(A.get_ref());
+  const quasi_unwrap<T2> UB(B.get_ref());
+  
+  Cube<eT> out;
+  
+  batch_linalg::mul(out, UA.M, UB.M);
+  
+  return out;
+  }
+
+
+
+//! @}
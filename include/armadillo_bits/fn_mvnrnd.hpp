@@ -107,4 +107,49 @@ mvnrnd(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_type, T1>&
 
 
 
+
+
+template<typename T1, typename T2, typename T3>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_real<typename T1::elem_type>::value,
+  Mat<typename T1::elem_type>
+  >::result
+mvnrnd(const Base<typename T1::elem_type, T1>& M, const Base<typename T1::elem_type, T2>& C, const uword N, const Base<typename T1::elem_type, T3>& D)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(C);
+  
+  Mat<typename T1::elem_type> out;
+  
+  glue_mvnrnd::apply_direct_chol(out, M.get_ref(), D.get_ref(), N);
+  
+  return out;
+  }
+
+
+
+template<typename T1, typename T2, typename T3>
+inline
+typename
+enable_if2
+  <
+  is_real<typename T1::elem_type>::value,
+  bool
+  >::result
+mvnrnd(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_type, T1>& M, const Base<typename T1::elem_type, T2>& C, const uword N, const Base<typename T1::elem_type, T3>& D)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(C);
+  
+  glue_mvnrnd::apply_direct_chol(out, M.get_ref(), D.get_ref(), N);
+  
+  return true;
+  }
+
+
+
 //! @}
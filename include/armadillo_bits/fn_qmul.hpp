@@ -0,0 +1,115 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_qmul
+//! @{
+
+
+//! product of low-precision integer matrices (s8, u8, s16), with each element of the result accumulated in s32;
+//! products involving s16, or with more than 33025 terms, are accumulated in 64 bits and saturated to the range of s32
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  glue_qmul::is_supported<typename T1::elem_type>::value && glue_qmul::is_supported<typename T2::elem_type>::value,
+  Mat<s32>
+  >::result
+qmul(const Base<typename T1::elem_type,T1>& A, const Base<typename T2::elem_type,T2>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> UA(A.get_ref());
+  const quasi_unwrap<T2> UB(B.get_ref());
+  
+  Mat<s32> out;
+  
+  glue_qmul::apply_noalias(out, UA.M, UB.M);
+  
+  return out;
+  }
+
+
+
+//! dequantised product of symmetrically quantised matrices;
+//! A_scales has one scale for A, or one scale per row of A;
+//! B_scales has one scale for B, or one scale per column of B
+template<typename T1, typename T2, typename eT>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_real<eT>::value && glue_qmul::is_supported<typename T1::elem_type>::value && glue_qmul::is_supported<typename T2::elem_type>::value,
+  Mat<eT>
+  >::result
+qmul
+  (
+  const Base<typename T1::elem_type,T1>& A,
+  const Mat<eT>&                         A_scales,
+  const Base<typename T2::elem_type,T2>& B,
+  const Mat<eT>&                         B_scales
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> UA(A.get_ref());
+  const quasi_unwrap<T2> UB(B.get_ref());
+  
+  Mat<eT> out;
+  
+  glue_qmul::apply_dequant(out, UA.M, A_scales, Mat<s32>(), UB.M, B_scales, Mat<s32>());
+  
+  return out;
+  }
+
+
+
+//! dequantised product of asymmetrically quantised matrices, with zero points matching the given scales
+template<typename T1, typename T2, typename eT>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_real<eT>::value && glue_qmul::is_supported<typename T1::elem_type>::value && glue_qmul::is_supported<typename T2::elem_type>::value,
+  Mat<eT>
+  >::result
+qmul
+  (
+  const Base<typename T1::elem_type,T1>& A,
+  const Mat<eT>&                         A_scales,
+  const Mat<s32>&                        A_zero_points,
+  const Base<typename T2::elem_type,T2>& B,
+  const Mat<eT>&                         B_scales,
+  const Mat<s32>&                        B_zero_points
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> UA(A.get_ref());
+  const quasi_unwrap<T2> UB(B.get_ref());
+  
+  Mat<eT> out;
+  
+  glue_qmul::apply_dequant(out, UA.M, A_scales, A_zero_points, UB.M, B_scales, B_zero_points);
+  
+  return out;
+  }
+
+
+//! @}
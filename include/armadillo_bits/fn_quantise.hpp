@@ -0,0 +1,126 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_quantise
+//! @{
+
+
+//! symmetric quantisation of each column (dim = 0) or each row (dim = 1) of X into a signed integer matrix
+template<typename qT, typename T1>
+inline
+bool
+quantise
+  (
+         Mat<qT>&                        Q,
+         Mat<typename T1::elem_type>&    scales,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            dim = 0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  Mat<s32> zero_points;
+  
+  const bool status = op_quantise::apply(Q, scales, zero_points, U.M, dim, true);
+  
+  if(status == false)
+    {
+    Q.soft_reset();
+    scales.soft_reset();
+    arma_debug_warn("quantise(): given matrix has non-finite elements");
+    }
+  
+  return status;
+  }
+
+
+
+//! asymmetric quantisation of each column (dim = 0) or each row (dim = 1) of X, with a zero point for each column or row
+template<typename qT, typename T1>
+inline
+bool
+quantise
+  (
+         Mat<qT>&                        Q,
+         Mat<typename T1::elem_type>&    scales,
+         Mat<s32>&                       zero_points,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            dim = 0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const bool status = op_quantise::apply(Q, scales, zero_points, U.M, dim, false);
+  
+  if(status == false)
+    {
+    Q.soft_reset();
+    scales.soft_reset();
+    zero_points.soft_reset();
+    arma_debug_warn("quantise(): given matrix has non-finite elements");
+    }
+  
+  return status;
+  }
+
+
+
+template<typename T1, typename eT>
+arma_warn_unused
+inline
+typename enable_if2< is_real<eT>::value && glue_qmul::is_supported<typename T1::elem_type>::value, Mat<eT> >::result
+dequantise(const Base<typename T1::elem_type,T1>& Q, const Mat<eT>& scales, const uword dim = 0)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(Q.get_ref());
+  
+  Mat<eT> out;
+  
+  op_quantise::dequantise(out, U.M, scales, Mat<s32>(), dim);
+  
+  return out;
+  }
+
+
+
+template<typename T1, typename eT>
+arma_warn_unused
+inline
+typename enable_if2< is_real<eT>::value && glue_qmul::is_supported<typename T1::elem_type>::value, Mat<eT> >::result
+dequantise(const Base<typename T1::elem_type,T1>& Q, const Mat<eT>& scales, const Mat<s32>& zero_points, const uword dim = 0)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(Q.get_ref());
+  
+  Mat<eT> out;
+  
+  op_quantise::dequantise(out, U.M, scales, zero_points, dim);
+  
+  return out;
+  }
+
+
+//! @}
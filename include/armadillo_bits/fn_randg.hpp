@@ -64,21 +64,7 @@ randg(const uword n_rows, const uword n_cols, const distr_param& param = distr_p
     
     arma_debug_check( ((a <= double(0)) || (b <= double(0))), "randg(): a and b must be greater than zero" );
     
-    #if defined(ARMA_USE_EXTERN_CXX11_RNG)
-      {
-      arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #else
-      {
-      arma_rng_cxx11 local_arma_rng_cxx11_instance;
-      
-      typedef typename arma_rng_cxx11::seed_type seed_type;
-      
-      local_arma_rng_cxx11_instance.set_seed( seed_type(arma_rng::randi<seed_type>()) );
-      
-      local_arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #endif
+    arma_rng::randg<typename obj_type::elem_type>::fill(out.memptr(), out.n_elem, a, b);
     
     return out;
     }
@@ -227,21 +213,7 @@ randg(const uword n_rows, const uword n_cols, const uword n_slices, const distr_
     
     arma_debug_check( ((a <= double(0)) || (b <= double(0))), "randg(): a and b must be greater than zero" );
     
-    #if defined(ARMA_USE_EXTERN_CXX11_RNG)
-      {
-      arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #else
-      {
-      arma_rng_cxx11 local_arma_rng_cxx11_instance;
-      
-      typedef typename arma_rng_cxx11::seed_type seed_type;
-      
-      local_arma_rng_cxx11_instance.set_seed( seed_type(arma_rng::randi<seed_type>()) );
-      
-      local_arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #endif
+    arma_rng::randg<typename cube_type::elem_type>::fill(out.memptr(), out.n_elem, a, b);
     
     return out;
     }
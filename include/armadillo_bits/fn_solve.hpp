@@ -41,6 +41,25 @@ solve
 
 
 
+//! fixed-size A: the type is kept, so that with solve_opts::fast a kernel for the size can be selected at compile time
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< (is_Mat_fixed<T1>::value && is_supported_blas_type<typename T1::elem_type>::value), const Glue<T1, T2, glue_solve_gen> >::result
+solve
+  (
+  const T1&                              A,
+  const Base<typename T1::elem_type,T2>& B,
+  const solve_opts::opts&                opts = solve_opts::none
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  return Glue<T1, T2, glue_solve_gen>(A, B.get_ref(), opts.flags);
+  }
+
+
+
 //! NOTE: don't use this form: it will be removed
 template<typename T1, typename T2>
 arma_deprecated
@@ -101,6 +120,28 @@ solve
 
 
 
+//! also provides the reciprocal condition number estimated by the solver,
+//! and the number of refinement steps taken when solve_opts::mixed is used
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+solve
+  (
+         Mat<typename T1::elem_type>&    out,
+         typename T1::pod_type&          out_rcond,
+         uword&                          out_n_iter,
+  const Base<typename T1::elem_type,T1>& A,
+  const Base<typename T1::elem_type,T2>& B,
+  const solve_opts::opts&                opts = solve_opts::none
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  return glue_solve_gen::apply(out, out_rcond, out_n_iter, A.get_ref(), B.get_ref(), opts.flags);
+  }
+
+
+
 //! NOTE: don't use this form: it will be removed
 template<typename T1, typename T2>
 arma_deprecated
@@ -301,4 +342,63 @@ solve
 
 
 
+//
+// solve for each slice of a cube
+
+
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Cube<typename T1::elem_type> >::result
+solve
+  (
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> UA(A.get_ref());
+  const unwrap_cube<T2> UB(B.get_ref());
+  
+  Cube<eT> out;
+  
+  const bool status = batch_linalg::solve(out, UA.M, UB.M);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+solve
+  (
+            Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube<T1> UA(A.get_ref());
+  const unwrap_cube<T2> UB(B.get_ref());
+  
+  const bool status = batch_linalg::solve(out, UA.M, UB.M);
+  
+  if(status == false)  { out.soft_reset(); }
+  
+  return status;
+  }
+
+
 //! @}
@@ -0,0 +1,134 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_svd_rand
+//! @{
+
+
+
+//! k largest singular values of dense matrix X, via randomised range finder
+template<typename T1>
+inline
+bool
+svd_rand
+  (
+         Col<typename T1::pod_type>&     S,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const uword                            n_oversample = 10,
+  const uword                            n_iter       = 2,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  Mat<eT> U;
+  Mat<eT> V;
+  
+  const bool status = auxlib::svd_rand(U, S, V, X, k, n_oversample, n_iter, false);
+  
+  if(status == false)
+    {
+    S.soft_reset();
+    arma_debug_warn("svd_rand(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! k largest singular values of dense matrix X, via randomised range finder
+template<typename T1>
+arma_warn_unused
+inline
+Col<typename T1::pod_type>
+svd_rand
+  (
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const uword                            n_oversample = 10,
+  const uword                            n_iter       = 2,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  Mat<eT> U;
+  Mat<eT> V;
+  
+  Col<typename T1::pod_type> out;
+  
+  const bool status = auxlib::svd_rand(U, out, V, X, k, n_oversample, n_iter, false);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("svd_rand(): decomposition failed");
+    }
+  
+  return out;
+  }
+
+
+
+//! k largest singular values and corresponding singular vectors of dense matrix X, via randomised range finder
+template<typename T1>
+inline
+bool
+svd_rand
+  (
+         Mat<typename T1::elem_type>&    U,
+         Col<typename T1::pod_type >&    S,
+         Mat<typename T1::elem_type>&    V,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const uword                            n_oversample = 10,
+  const uword                            n_iter       = 2,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check
+    (
+    ( ((void*)(&U) == (void*)(&S)) || (&U == &V) || ((void*)(&S) == (void*)(&V)) ),
+    "svd_rand(): two or more output objects are the same object"
+    );
+  
+  const bool status = auxlib::svd_rand(U, S, V, X, k, n_oversample, n_iter, true);
+  
+  if(status == false)
+    {
+    U.soft_reset();
+    S.soft_reset();
+    V.soft_reset();
+    arma_debug_warn("svd_rand(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! @}
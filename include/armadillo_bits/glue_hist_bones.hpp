@@ -22,6 +22,18 @@ class glue_hist
    {
    public:
    
+   template<typename eT>
+   inline static uword get_layout(double& c0, double& inv_step, const eT* C_mem, const uword C_n_elem);
+   
+   template<typename eT>
+   arma_inline static uword nearest_center(const eT val, const eT* C_mem, const uword C_n_elem, const uword layout, const double c0, const double inv_step);
+   
+   template<typename eT>
+   inline static void apply_vec(uword* out_mem, const eT* X_mem, const uword X_n_elem, const eT* C_mem, const uword C_n_elem, const uword layout, const double c0, const double inv_step);
+   
+   template<typename eT>
+   inline static void count_vec(uword* out_mem, const eT* X_mem, const uword X_n_elem, const eT* C_mem, const uword C_n_elem, const uword layout, const double c0, const double inv_step);
+   
    template<typename eT>
    inline static void apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, const uword dim);
    
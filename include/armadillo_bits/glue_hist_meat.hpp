@@ -18,6 +18,196 @@
 //! @{
 
 
+//! determine the layout of the centers:
+//! 0 = unsorted, 1 = strictly increasing, 2 = strictly increasing and (approximately) equally spaced
+template<typename eT>
+inline
+uword
+glue_hist::get_layout(double& c0, double& inv_step, const eT* C_mem, const uword C_n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  c0       = double(0);
+  inv_step = double(0);
+  
+  if(C_n_elem < 2)  { return 0; }
+  
+  for(uword i=1; i < C_n_elem; ++i)
+    {
+    if( (C_mem[i-1] < C_mem[i]) == false )  { return 0; }
+    }
+  
+  c0 = double(C_mem[0]);
+  
+  const double step = (double(C_mem[C_n_elem-1]) - c0) / double(C_n_elem-1);
+  
+  // the computed index of the nearest center is subsequently refined,
+  // so the centers only need to be roughly equally spaced
+  
+  for(uword i=1; i < C_n_elem; ++i)
+    {
+    const double expected = c0 + double(i)*step;
+    
+    if( std::abs(double(C_mem[i]) - expected) > (double(0.25) * step) )  { return 1; }
+    }
+  
+  inv_step = double(1) / step;
+  
+  return 2;
+  }
+
+
+
+//! index of the center nearest to val, which must be finite;
+//! if two centers are equally near, the center with the lower index is used
+template<typename eT>
+arma_inline
+uword
+glue_hist::nearest_center(const eT val, const eT* C_mem, const uword C_n_elem, const uword layout, const double c0, const double inv_step)
+  {
+  const eT center_0 = C_mem[0];
+  
+  eT    opt_dist  = (center_0 >= val) ? (center_0 - val) : (val - center_0);
+  uword opt_index = 0;
+  
+  if(layout == 0)
+    {
+    for(uword j=1; j < C_n_elem; ++j)
+      {
+      const eT center = C_mem[j];
+      const eT dist   = (center >= val) ? (center - val) : (val - center);
+      
+      if(dist < opt_dist)
+        {
+        opt_dist  = dist;
+        opt_index = j;
+        }
+      else
+        {
+        break;
+        }
+      }
+    
+    return opt_index;
+    }
+  
+  if(layout == 2)
+    {
+    const double pos = (double(val) - c0) * inv_step + double(0.5);
+    
+    opt_index = (pos <= double(0)) ? uword(0) : ( (pos >= double(C_n_elem-1)) ? uword(C_n_elem-1) : uword(pos) );
+    }
+  else
+    {
+    opt_index = uword( std::lower_bound(C_mem, C_mem + C_n_elem, val) - C_mem );
+    
+    if(opt_index >= C_n_elem)  { opt_index = C_n_elem-1; }
+    }
+  
+  // the distances to strictly increasing centers first decrease and then increase,
+  // so the nearest center is found by walking downhill from the initial index
+  
+  const eT center = C_mem[opt_index];
+  
+  opt_dist = (center >= val) ? (center - val) : (val - center);
+  
+  while(opt_index > 0)
+    {
+    const eT prev = C_mem[opt_index-1];
+    const eT dist = (prev >= val) ? (prev - val) : (val - prev);
+    
+    if(dist <= opt_dist)  { opt_dist = dist; --opt_index; }  else  { break; }
+    }
+  
+  while( (opt_index+1) < C_n_elem )
+    {
+    const eT next = C_mem[opt_index+1];
+    const eT dist = (next >= val) ? (next - val) : (val - next);
+    
+    if(dist < opt_dist)  { opt_dist = dist; ++opt_index; }  else  { break; }
+    }
+  
+  return opt_index;
+  }
+
+
+
+//! accumulate the histogram of a contiguous array into out_mem;
+//! if OpenMP is enabled, large arrays are split into chunks which are histogrammed separately
+template<typename eT>
+inline
+void
+glue_hist::apply_vec(uword* out_mem, const eT* X_mem, const uword X_n_elem, const eT* C_mem, const uword C_n_elem, const uword layout, const double c0, const double inv_step)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(X_n_elem) && (X_n_elem >= 2*C_n_elem) && (mp_thread_limit::get() > 1) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const uword n_threads_max = uword(mp_thread_limit::get());
+      const uword n_threads     = (std::min)(n_threads_max, X_n_elem / C_n_elem);
+      const uword chunk_size    = X_n_elem / n_threads;
+      
+      podarray<uword> thread_counts(n_threads * C_n_elem);
+      
+      thread_counts.zeros();
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = t*chunk_size;
+        const uword endp1 = ((t+1) < n_threads) ? (start + chunk_size) : X_n_elem;
+        
+        glue_hist::count_vec(thread_counts.memptr() + t*C_n_elem, X_mem + start, endp1 - start, C_mem, C_n_elem, layout, c0, inv_step);
+        }
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        arrayops::inplace_plus(out_mem, thread_counts.memptr() + t*C_n_elem, C_n_elem);
+        }
+      }
+    #endif
+    
+    return;
+    }
+  
+  glue_hist::count_vec(out_mem, X_mem, X_n_elem, C_mem, C_n_elem, layout, c0, inv_step);
+  }
+
+
+
+//! accumulate the histogram of a contiguous array into out_mem, without splitting it into chunks
+template<typename eT>
+inline
+void
+glue_hist::count_vec(uword* out_mem, const eT* X_mem, const uword X_n_elem, const eT* C_mem, const uword C_n_elem, const uword layout, const double c0, const double inv_step)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword i=0; i < X_n_elem; ++i)
+    {
+    const eT val = X_mem[i];
+    
+    if(arma_isfinite(val))
+      {
+      out_mem[ glue_hist::nearest_center(val, C_mem, C_n_elem, layout, c0, inv_step) ]++;
+      }
+    else
+      {
+      // -inf
+      if(val < eT(0)) { out_mem[0]++; }
+      
+      // +inf
+      if(val > eT(0)) { out_mem[C_n_elem-1]++; }
+      
+      // ignore NaN
+      }
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -34,151 +224,65 @@ glue_hist::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, co
   
   if( C_n_elem == 0 )  { out.reset(); return; }
   
-  const eT* C_mem    = C.memptr();
-  const eT  center_0 = C_mem[0];
+  const eT* C_mem = C.memptr();
+  
+  double c0       = double(0);
+  double inv_step = double(0);
+  
+  const uword layout = glue_hist::get_layout(c0, inv_step, C_mem, C_n_elem);
   
   if(dim == 0)
     {
     out.zeros(C_n_elem, X_n_cols);
     
-    for(uword col=0; col < X_n_cols; ++col)
+    // process the columns in parallel if there are enough columns, or if the columns are too short to be split
+    
+    const bool use_mp = arma_config::openmp && (X_n_cols > 1) && mp_gate<eT>::eval(X.n_elem) && ( (X_n_cols >= uword(mp_thread_limit::get())) || (mp_gate<eT>::eval(X_n_rows) == false) );
+    
+    if(use_mp)
       {
-      const eT*    X_coldata   = X.colptr(col);
-            uword* out_coldata = out.colptr(col);
-      
-      for(uword row=0; row < X_n_rows; ++row)
+      #if defined(ARMA_USE_OPENMP)
         {
-        const eT val = X_coldata[row];
+        const int n_threads = mp_thread_limit::get();
         
-        if(arma_isfinite(val))
-          {
-          eT    opt_dist  = (center_0 >= val) ? (center_0 - val) : (val - center_0);
-          uword opt_index = 0;
-          
-          for(uword j=1; j < C_n_elem; ++j)
-            {
-            const eT center = C_mem[j];
-            const eT dist   = (center >= val) ? (center - val) : (val - center);
-            
-            if(dist < opt_dist)
-              {
-              opt_dist  = dist;
-              opt_index = j;
-              }
-            else
-              {
-              break;
-              }
-            }
-          
-          out_coldata[opt_index]++;
-          }
-        else
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < X_n_cols; ++col)
           {
-          // -inf
-          if(val < eT(0)) { out_coldata[0]++; }
-          
-          // +inf
-          if(val > eT(0)) { out_coldata[C_n_elem-1]++; }
-          
-          // ignore NaN
+          glue_hist::count_vec(out.colptr(col), X.colptr(col), X_n_rows, C_mem, C_n_elem, layout, c0, inv_step);
           }
         }
+      #endif
+      }
+    else
+      {
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        glue_hist::apply_vec(out.colptr(col), X.colptr(col), X_n_rows, C_mem, C_n_elem, layout, c0, inv_step);
+        }
       }
     }
   else
   if(dim == 1)
     {
-    out.zeros(X_n_rows, C_n_elem);
-    
     if(X_n_rows == 1)
       {
-      const uword  X_n_elem = X.n_elem;
-      const eT*    X_mem    = X.memptr();
-            uword* out_mem  = out.memptr();
+      out.zeros(1, C_n_elem);
       
-      for(uword i=0; i < X_n_elem; ++i)
-        {
-        const eT val = X_mem[i];
-        
-        if(is_finite(val))
-          {
-          eT    opt_dist  = (val >= center_0) ? (val - center_0) : (center_0 - val);
-          uword opt_index = 0;
-          
-          for(uword j=1; j < C_n_elem; ++j)
-            {
-            const eT center = C_mem[j];
-            const eT dist   = (val >= center) ? (val - center) : (center - val);
-            
-            if(dist < opt_dist)
-              {
-              opt_dist  = dist;
-              opt_index = j;
-              }
-            else
-              {
-              break;
-              }
-            }
-          
-          out_mem[opt_index]++;
-          }
-        else
-          {
-          // -inf
-          if(val < eT(0)) { out_mem[0]++; }
-          
-          // +inf
-          if(val > eT(0)) { out_mem[C_n_elem-1]++; }
-          
-          // ignore NaN
-          }
-        }
+      glue_hist::apply_vec(out.memptr(), X.memptr(), X.n_elem, C_mem, C_n_elem, layout, c0, inv_step);
       }
     else
       {
-      for(uword row=0; row < X_n_rows; ++row)
-        {
-        for(uword col=0; col < X_n_cols; ++col)
-          {
-          const eT val = X.at(row,col);
-          
-          if(arma_isfinite(val))
-            {
-            eT    opt_dist  = (center_0 >= val) ? (center_0 - val) : (val - center_0);
-            uword opt_index = 0;
-            
-            for(uword j=1; j < C_n_elem; ++j)
-              {
-              const eT center = C_mem[j];
-              const eT dist   = (center >= val) ? (center - val) : (val - center);
-              
-              if(dist < opt_dist)
-                {
-                opt_dist  = dist;
-                opt_index = j;
-                }
-              else
-                {
-                break;
-                }
-              }
-            
-            out.at(row,opt_index)++;
-            }
-          else
-            {
-            // -inf
-            if(val < eT(0)) { out.at(row,0)++; }
-            
-            // +inf
-            if(val > eT(0)) { out.at(row,C_n_elem-1)++; }
-            
-            // ignore NaN
-            }
-          }
-        }
+      // process the rows as contiguous columns of the transposed matrix
+      
+      Mat<eT> Xt;
+      
+      op_strans::apply_mat_noalias(Xt, X);
+      
+      Mat<uword> tmp;
+      
+      glue_hist::apply_noalias(tmp, Xt, C, uword(0));
+      
+      op_strans::apply_mat_noalias(out, tmp);
       }
     }
   }
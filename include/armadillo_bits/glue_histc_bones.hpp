@@ -22,6 +22,18 @@ class glue_histc
    {
    public:
    
+   template<typename eT>
+   inline static uword get_layout(double& b0, double& inv_step, const eT* B_mem, const uword B_n_elem);
+   
+   template<typename eT>
+   arma_inline static uword find_bin(const eT x, const eT* B_mem, const uword B_n_elem, const uword layout, const double b0, const double inv_step);
+   
+   template<typename eT>
+   inline static void apply_vec(uword* C_mem, const eT* A_mem, const uword A_n_elem, const eT* B_mem, const uword B_n_elem, const uword layout, const double b0, const double inv_step);
+   
+   template<typename eT>
+   inline static void count_vec(uword* C_mem, const eT* A_mem, const uword A_n_elem, const eT* B_mem, const uword B_n_elem, const uword layout, const double b0, const double inv_step);
+   
    template<typename eT>
    inline static void apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, const uword dim);
    
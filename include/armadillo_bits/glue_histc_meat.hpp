@@ -18,6 +18,156 @@
 //! @{
 
 
+//! determine the layout of the edges:
+//! 0 = unsorted, 1 = non-decreasing, 2 = strictly increasing and (approximately) equally spaced
+template<typename eT>
+inline
+uword
+glue_histc::get_layout(double& b0, double& inv_step, const eT* B_mem, const uword B_n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  b0       = double(0);
+  inv_step = double(0);
+  
+  if(B_n_elem < 2)  { return 0; }
+  
+  bool strictly_increasing = true;
+  
+  for(uword i=1; i < B_n_elem; ++i)
+    {
+    if( (B_mem[i-1] <= B_mem[i]) == false )  { return 0; }
+    
+    if(B_mem[i-1] == B_mem[i])  { strictly_increasing = false; }
+    }
+  
+  if(strictly_increasing == false)  { return 1; }
+  
+  b0 = double(B_mem[0]);
+  
+  const double step = (double(B_mem[B_n_elem-1]) - b0) / double(B_n_elem-1);
+  
+  for(uword i=1; i < B_n_elem; ++i)
+    {
+    const double expected = b0 + double(i)*step;
+    
+    if( std::abs(double(B_mem[i]) - expected) > (double(0.25) * step) )  { return 1; }
+    }
+  
+  inv_step = double(1) / step;
+  
+  return 2;
+  }
+
+
+
+//! index of the bin containing x, or B_n_elem if x is not within any bin
+template<typename eT>
+arma_inline
+uword
+glue_histc::find_bin(const eT x, const eT* B_mem, const uword B_n_elem, const uword layout, const double b0, const double inv_step)
+  {
+  const uword B_n_elem_m1 = B_n_elem - 1;
+  
+  if(layout == 0)
+    {
+    for(uword i=0; i < B_n_elem_m1; ++i)
+      {
+           if( (B_mem[i]           <= x) && (x < B_mem[i+1]) )  { return i;           }
+      else if(  B_mem[B_n_elem_m1] == x                      )  { return B_n_elem_m1; }    // for compatibility with Matlab
+      }
+    
+    return B_n_elem;
+    }
+  
+  // also rejects NaN
+  if( ((B_mem[0] <= x) && (x <= B_mem[B_n_elem_m1])) == false )  { return B_n_elem; }
+  
+  if(x == B_mem[B_n_elem_m1])  { return B_n_elem_m1; }    // for compatibility with Matlab
+  
+  if(layout == 1)
+    {
+    return uword( std::upper_bound(B_mem, B_mem + B_n_elem, x) - B_mem ) - 1;
+    }
+  
+  const double pos = (double(x) - b0) * inv_step;
+  
+  uword i = (pos <= double(0)) ? uword(0) : ( (pos >= double(B_n_elem_m1 - 1)) ? uword(B_n_elem_m1 - 1) : uword(pos) );
+  
+  // refine the computed index, as the edges may not be exactly equally spaced
+  
+  while( (i > 0) && (x < B_mem[i]) )  { --i; }
+  
+  while( ((i+1) < B_n_elem_m1) && (B_mem[i+1] <= x) )  { ++i; }
+  
+  return i;
+  }
+
+
+
+//! accumulate the histogram of a contiguous array into C_mem;
+//! if OpenMP is enabled, large arrays are split into chunks which are histogrammed separately
+template<typename eT>
+inline
+void
+glue_histc::apply_vec(uword* C_mem, const eT* A_mem, const uword A_n_elem, const eT* B_mem, const uword B_n_elem, const uword layout, const double b0, const double inv_step)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(A_n_elem) && (A_n_elem >= 2*B_n_elem) && (mp_thread_limit::get() > 1) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const uword n_threads_max = uword(mp_thread_limit::get());
+      const uword n_threads     = (std::min)(n_threads_max, A_n_elem / B_n_elem);
+      const uword chunk_size    = A_n_elem / n_threads;
+      
+      podarray<uword> thread_counts(n_threads * B_n_elem);
+      
+      thread_counts.zeros();
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = t*chunk_size;
+        const uword endp1 = ((t+1) < n_threads) ? (start + chunk_size) : A_n_elem;
+        
+        glue_histc::count_vec(thread_counts.memptr() + t*B_n_elem, A_mem + start, endp1 - start, B_mem, B_n_elem, layout, b0, inv_step);
+        }
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        arrayops::inplace_plus(C_mem, thread_counts.memptr() + t*B_n_elem, B_n_elem);
+        }
+      }
+    #endif
+    
+    return;
+    }
+  
+  glue_histc::count_vec(C_mem, A_mem, A_n_elem, B_mem, B_n_elem, layout, b0, inv_step);
+  }
+
+
+
+//! accumulate the histogram of a contiguous array into C_mem, without splitting it into chunks
+template<typename eT>
+inline
+void
+glue_histc::count_vec(uword* C_mem, const eT* A_mem, const uword A_n_elem, const eT* B_mem, const uword B_n_elem, const uword layout, const double b0, const double inv_step)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword j=0; j < A_n_elem; ++j)
+    {
+    const uword i = glue_histc::find_bin(A_mem[j], B_mem, B_n_elem, layout, b0, inv_step);
+    
+    if(i < B_n_elem)  { C_mem[i]++; }
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -34,65 +184,65 @@ glue_histc::apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, con
   
   if( B_n_elem == uword(0) )  { C.reset(); return; }
   
-  const eT*   B_mem       = B.memptr();
-  const uword B_n_elem_m1 = B_n_elem - 1;
+  const eT* B_mem = B.memptr();
+  
+  double b0       = double(0);
+  double inv_step = double(0);
+  
+  const uword layout = glue_histc::get_layout(b0, inv_step, B_mem, B_n_elem);
   
   if(dim == uword(0))
     {
     C.zeros(B_n_elem, A_n_cols);
     
-    for(uword col=0; col < A_n_cols; ++col)
+    // process the columns in parallel if there are enough columns, or if the columns are too short to be split
+    
+    const bool use_mp = arma_config::openmp && (A_n_cols > 1) && mp_gate<eT>::eval(A.n_elem) && ( (A_n_cols >= uword(mp_thread_limit::get())) || (mp_gate<eT>::eval(A_n_rows) == false) );
+    
+    if(use_mp)
       {
-      const eT*    A_coldata = A.colptr(col);
-            uword* C_coldata = C.colptr(col);
-      
-      for(uword row=0; row < A_n_rows; ++row)
+      #if defined(ARMA_USE_OPENMP)
         {
-        const eT x = A_coldata[row];
+        const int n_threads = mp_thread_limit::get();
         
-        for(uword i=0; i < B_n_elem_m1; ++i)
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < A_n_cols; ++col)
           {
-               if( (B_mem[i]           <= x) && (x < B_mem[i+1]) )  { C_coldata[i]++;           break; }
-          else if(  B_mem[B_n_elem_m1] == x                      )  { C_coldata[B_n_elem_m1]++; break; }    // for compatibility with Matlab
+          glue_histc::count_vec(C.colptr(col), A.colptr(col), A_n_rows, B_mem, B_n_elem, layout, b0, inv_step);
           }
         }
+      #endif
+      }
+    else
+      {
+      for(uword col=0; col < A_n_cols; ++col)
+        {
+        glue_histc::apply_vec(C.colptr(col), A.colptr(col), A_n_rows, B_mem, B_n_elem, layout, b0, inv_step);
+        }
       }
     }
   else
   if(dim == uword(1))
     {
-    C.zeros(A_n_rows, B_n_elem);
-    
-    if(A.n_rows == 1)
+    if(A_n_rows == 1)
       {
-      const uword  A_n_elem = A.n_elem;
-      const eT*    A_mem    = A.memptr();
-            uword* C_mem    = C.memptr();
+      C.zeros(1, B_n_elem);
       
-      for(uword j=0; j < A_n_elem; ++j)
-        {
-        const eT x = A_mem[j];
-        
-        for(uword i=0; i < B_n_elem_m1; ++i)
-          {
-               if( (B_mem[i]           <= x) && (x < B_mem[i+1]) )  { C_mem[i]++;           break; }
-          else if(  B_mem[B_n_elem_m1] == x                      )  { C_mem[B_n_elem_m1]++; break; }    // for compatibility with Matlab
-          }
-        }
+      glue_histc::apply_vec(C.memptr(), A.memptr(), A.n_elem, B_mem, B_n_elem, layout, b0, inv_step);
       }
     else
       {
-      for(uword row=0; row < A_n_rows; ++row)
-      for(uword col=0; col < A_n_cols; ++col)
-        {
-        const eT x = A.at(row,col);
-        
-        for(uword i=0; i < B_n_elem_m1; ++i)
-          {
-               if( (B_mem[i]            <= x) && (x < B_mem[i+1]) )  { C.at(row,i)++;           break; }
-          else if(  B_mem[B_n_elem_m1]  == x                      )  { C.at(row,B_n_elem_m1)++; break; }   // for compatibility with Matlab
-          }
-        }
+      // process the rows as contiguous columns of the transposed matrix
+      
+      Mat<eT> At;
+      
+      op_strans::apply_mat_noalias(At, A);
+      
+      Mat<uword> tmp;
+      
+      glue_histc::apply_noalias(tmp, At, B, uword(0));
+      
+      op_strans::apply_mat_noalias(C, tmp);
       }
     }
   }
@@ -30,6 +30,12 @@ class glue_mvnrnd
    
    template<typename eT>
    inline static bool apply_noalias(Mat<eT>& out, const Mat<eT>& M, const Mat<eT>& C, const uword N);
+   
+   template<typename T1, typename T2>
+   inline static void apply_direct_chol(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_type,T1>& M, const Base<typename T1::elem_type,T2>& D, const uword N);
+   
+   template<typename eT>
+   inline static void generate(Mat<eT>& out, const Mat<eT>& M, const Mat<eT>& D, const uword N, const bool trans_D);
    };
 
 
@@ -131,8 +131,70 @@ glue_mvnrnd::apply_noalias(Mat<eT>& out, const Mat<eT>& M, const Mat<eT>& C, con
     D.steal_mem(DD);
     }
   
-  out = D * randn< Mat<eT> >(M.n_rows, N);
+  glue_mvnrnd::generate(out, M, D, N, false);
+  
+  return true;
+  }
+
+
+
+//! use a precomputed upper triangular Cholesky factor D of the covariance matrix, ie. C = D.t() * D
+template<typename T1, typename T2>
+inline
+void
+glue_mvnrnd::apply_direct_chol(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_type,T1>& M, const Base<typename T1::elem_type,T2>& D, const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> UM(M.get_ref());
+  const quasi_unwrap<T2> UD(D.get_ref());
+  
+  arma_debug_check( (UM.M.is_colvec() == false) && (UM.M.is_empty() == false),  "mvnrnd(): given mean must be a column vector"                  );
+  arma_debug_check( (UD.M.is_square() == false),  "mvnrnd(): given Cholesky factor must be square sized"                          );
+  arma_debug_check( (UM.M.n_rows != UD.M.n_rows), "mvnrnd(): number of rows in given mean vector and Cholesky factor must match" );
+  
+  if( UM.M.is_empty() || UD.M.is_empty() )
+    {
+    out.set_size(0,N);
+    return;
+    }
+  
+  if(UM.is_alias(out) || UD.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    glue_mvnrnd::generate(tmp, UM.M, UD.M, N, true);
     
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    glue_mvnrnd::generate(out, UM.M, UD.M, N, true);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_mvnrnd::generate(Mat<eT>& out, const Mat<eT>& M, const Mat<eT>& D, const uword N, const bool trans_D)
+  {
+  arma_extra_debug_sigprint();
+  
+  const Mat<eT> Z = randn< Mat<eT> >(M.n_rows, N);
+  
+  if(trans_D)
+    {
+    out = D.t() * Z;
+    }
+  else
+    {
+    out = D * Z;
+    }
+  
   if(N == 1)
     {
     out += M;
@@ -142,8 +204,6 @@ glue_mvnrnd::apply_noalias(Mat<eT>& out, const Mat<eT>& M, const Mat<eT>& C, con
     {
     out.each_col() += M;
     }
-  
-  return true;
   }
 
 
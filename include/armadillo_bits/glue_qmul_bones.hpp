@@ -0,0 +1,79 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup glue_qmul
+//! @{
+
+
+//! matrix multiplication of low-precision integer matrices (s8, u8, s16),
+//! with accumulation in s32 (or in wide_type if either operand is s16, or for long inner dimensions) and optional dequantisation of the result
+class glue_qmul
+  {
+  public:
+  
+  static const uword block_size = 32;  // number of products summed in the innermost (vectorisable) loop
+  static const uword row_block  = 64;  // number of packed rows of A processed per sweep over a column of B
+  
+  template<typename eT>
+  struct is_supported
+    {
+    static const bool value = is_same_type<eT,s8>::value || is_same_type<eT,u8>::value || is_same_type<eT,s16>::value;
+    };
+  
+  //! products of two s16 values can reach 2^30, so sums of more than one of them can overflow s32
+  template<typename eTA, typename eTB>
+  struct use_wide
+    {
+    static const bool value = is_same_type<eTA,s16>::value || is_same_type<eTB,s16>::value;
+    };
+  
+  //! products of s8 or u8 values are at most 255*255 in magnitude, so s32 holds the sum of up to 33025 of them
+  static const uword max_s32_K = 33025;
+  
+  template<typename eTA, typename eTB>
+  inline static bool need_wide(const uword K) { return use_wide<eTA,eTB>::value || (K > uword(max_s32_K)); }
+  
+  #if defined(ARMA_USE_U64S64)
+    typedef s64    wide_type;
+  #else
+    typedef double wide_type;  // exact for inner dimensions up to 2^23
+  #endif
+  
+  template<typename eT>
+  inline static void widen_cols(podarray<s16>& out, const Mat<eT>& X);
+  
+  template<typename eT>
+  inline static void widen_rows(podarray<s16>& out, const Mat<eT>& X);
+  
+  template<typename acc_eT>
+  arma_hot inline static acc_eT dot(const s16* a, const s16* b, const uword N);
+  
+  template<typename acc_eT, typename eTA, typename eTB>
+  inline static void apply_acc(Mat<acc_eT>& out, const Mat<eTA>& A, const Mat<eTB>& B);
+  
+  template<typename eTA, typename eTB>
+  inline static void apply_noalias(Mat<s32>& out, const Mat<eTA>& A, const Mat<eTB>& B);
+  
+  template<typename eT, typename eTA, typename eTB>
+  inline static void apply_dequant(Mat<eT>& out, const Mat<eTA>& A, const Mat<eT>& A_scales, const Mat<s32>& A_zero_points, const Mat<eTB>& B, const Mat<eT>& B_scales, const Mat<s32>& B_zero_points);
+  
+  template<typename eT, typename acc_eT, typename eTA, typename eTB>
+  inline static void dequant(Mat<eT>& out, const Mat<acc_eT>& C, const Mat<eTA>& A, const Mat<eT>& A_scales, const Mat<s32>& A_zero_points, const Mat<eTB>& B, const Mat<eT>& B_scales, const Mat<s32>& B_zero_points);
+  };
+
+
+
+//! @}
@@ -0,0 +1,356 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup glue_qmul
+//! @{
+
+
+
+//! convert X to s16, storing each column contiguously
+template<typename eT>
+inline
+void
+glue_qmul::widen_cols(podarray<s16>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  out.set_size(X.n_elem);
+  
+  const eT*  X_mem   = X.memptr();
+        s16* out_mem = out.memptr();
+  
+  for(uword i=0; i < X.n_elem; ++i)  { out_mem[i] = s16(X_mem[i]); }
+  }
+
+
+
+//! convert X to s16, storing each row contiguously
+template<typename eT>
+inline
+void
+glue_qmul::widen_rows(podarray<s16>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  out.set_size(X.n_elem);
+  
+  s16* out_mem = out.memptr();
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+    
+    for(uword row=0; row < X_n_rows; ++row)  { out_mem[row*X_n_cols + col] = s16(X_colptr[row]); }
+    }
+  }
+
+
+
+//! dot product of two s16 vectors, accumulated in acc_eT.
+//! the products are summed in fixed-size blocks with a separate accumulator,
+//! which allows the compiler to map the inner loop onto widening multiply-add instructions
+//! (eg. pmaddwd on SSE2/AVX2, or vpdpwssd on AVX-512 VNNI)
+template<typename acc_eT>
+arma_hot
+inline
+acc_eT
+glue_qmul::dot(const s16* a, const s16* b, const uword N)
+  {
+  const uword n_blocks = N / uword(block_size);
+  
+  acc_eT acc = acc_eT(0);
+  
+  for(uword block=0; block < n_blocks; ++block)
+    {
+    const s16* a_block = &(a[block * uword(block_size)]);
+    const s16* b_block = &(b[block * uword(block_size)]);
+    
+    acc_eT acc_block = acc_eT(0);
+    
+    for(uword i=0; i < uword(block_size); ++i)  { acc_block += acc_eT( s32(a_block[i]) * s32(b_block[i]) ); }
+    
+    acc += acc_block;
+    }
+  
+  for(uword i = n_blocks * uword(block_size); i < N; ++i)  { acc += acc_eT( s32(a[i]) * s32(b[i]) ); }
+  
+  return acc;
+  }
+
+
+
+//! product of low-precision integer matrices, with each element of the result accumulated in acc_eT
+template<typename acc_eT, typename eTA, typename eTB>
+inline
+void
+glue_qmul::apply_acc(Mat<acc_eT>& out, const Mat<eTA>& A, const Mat<eTB>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( is_supported<eTA>::value == false ));
+  arma_type_check(( is_supported<eTB>::value == false ));
+  
+  arma_debug_assert_mul_size(A, B, "qmul()");
+  
+  const uword M = A.n_rows;
+  const uword K = A.n_cols;
+  const uword N = B.n_cols;
+  
+  out.set_size(M, N);
+  
+  if(out.n_elem == 0)  { return; }
+  
+  if(K == 0)  { out.zeros(); return; }
+  
+  // all supported element types fit into s16;
+  // widening both operands once allows each output element to be computed
+  // as a dot product of two contiguous s16 vectors
+  
+  podarray<s16> At;  glue_qmul::widen_rows(At, A);
+  podarray<s16> Bw;  glue_qmul::widen_cols(Bw, B);
+  
+  const s16* At_mem = At.memptr();
+  const s16* Bw_mem = Bw.memptr();
+  
+  const uword n_row_blocks = (M + uword(row_block) - 1) / uword(row_block);
+  
+  if( arma_config::openmp && (N > 1) && mp_gate<s32>::eval(M*N*K) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_chunks      = (std::min)(N, uword(n_threads_max));
+      const uword chunk_size    = (N + n_chunks - 1) / n_chunks;
+      const int   n_threads     = int(n_chunks);
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword t=0; t < n_chunks; ++t)
+        {
+        const uword col_start = t * chunk_size;
+        const uword col_end   = (std::min)(col_start + chunk_size, N);
+        
+        for(uword rb=0; rb < n_row_blocks; ++rb)
+          {
+          const uword row_start = rb * uword(row_block);
+          const uword row_end   = (std::min)(row_start + uword(row_block), M);
+          
+          for(uword col=col_start; col < col_end; ++col)
+            {
+            const s16* b = &(Bw_mem[col*K]);
+            
+            acc_eT* out_colptr = out.colptr(col);
+            
+            for(uword row=row_start; row < row_end; ++row)  { out_colptr[row] = glue_qmul::dot<acc_eT>(&(At_mem[row*K]), b, K); }
+            }
+          }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword rb=0; rb < n_row_blocks; ++rb)
+      {
+      const uword row_start = rb * uword(row_block);
+      const uword row_end   = (std::min)(row_start + uword(row_block), M);
+      
+      for(uword col=0; col < N; ++col)
+        {
+        const s16* b = &(Bw_mem[col*K]);
+        
+        acc_eT* out_colptr = out.colptr(col);
+        
+        for(uword row=row_start; row < row_end; ++row)  { out_colptr[row] = glue_qmul::dot<acc_eT>(&(At_mem[row*K]), b, K); }
+        }
+      }
+    }
+  }
+
+
+
+//! product of low-precision integer matrices as s32;
+//! if either operand is s16, or the inner dimension is too long for s32, the elements are accumulated in wide_type and saturated to the range of s32
+template<typename eTA, typename eTB>
+inline
+void
+glue_qmul::apply_noalias(Mat<s32>& out, const Mat<eTA>& A, const Mat<eTB>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(glue_qmul::need_wide<eTA,eTB>(A.n_cols) == false)
+    {
+    glue_qmul::apply_acc(out, A, B);
+    
+    return;
+    }
+  
+  Mat<wide_type> C;
+  
+  glue_qmul::apply_acc(C, A, B);
+  
+  out.set_size(C.n_rows, C.n_cols);
+  
+  const wide_type s32_min = wide_type( std::numeric_limits<s32>::min() );
+  const wide_type s32_max = wide_type( std::numeric_limits<s32>::max() );
+  
+  const wide_type* C_mem   = C.memptr();
+        s32*       out_mem = out.memptr();
+  
+  const uword n_elem = C.n_elem;
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const wide_type val = C_mem[i];
+    
+    out_mem[i] = (val < s32_min) ? std::numeric_limits<s32>::min() : ( (val > s32_max) ? std::numeric_limits<s32>::max() : s32(val) );
+    }
+  }
+
+
+
+//! compute (A - A_zero_points) * (B - B_zero_points), scaled by A_scales (one per row of A) and B_scales (one per column of B);
+//! the zero points are not subtracted elementwise, but are corrected for using the row sums of A and the column sums of B:
+//! sum_k (a_ik - za_i) (b_kj - zb_j) = sum_k a_ik b_kj - za_i colsum_j(B) - zb_j rowsum_i(A) + K za_i zb_j
+template<typename eT, typename eTA, typename eTB>
+inline
+void
+glue_qmul::apply_dequant(Mat<eT>& out, const Mat<eTA>& A, const Mat<eT>& A_scales, const Mat<s32>& A_zero_points, const Mat<eTB>& B, const Mat<eT>& B_scales, const Mat<s32>& B_zero_points)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( is_real<eT>::value == false ));
+  
+  const uword M = A.n_rows;
+  const uword N = B.n_cols;
+  
+  arma_debug_check( ((A_scales.n_elem != 1) && (A_scales.n_elem != M)), "qmul(): number of scales for A must be 1 or equal to the number of rows of A"    );
+  arma_debug_check( ((B_scales.n_elem != 1) && (B_scales.n_elem != N)), "qmul(): number of scales for B must be 1 or equal to the number of columns of B" );
+  
+  arma_debug_check( ((A_zero_points.n_elem != 0) && (A_zero_points.n_elem != A_scales.n_elem)), "qmul(): number of zero points for A must match the number of scales for A" );
+  arma_debug_check( ((B_zero_points.n_elem != 0) && (B_zero_points.n_elem != B_scales.n_elem)), "qmul(): number of zero points for B must match the number of scales for B" );
+  
+  // the dequantised result is computed from the exact (unsaturated) products
+  
+  if(glue_qmul::need_wide<eTA,eTB>(A.n_cols))
+    {
+    Mat<wide_type> C;
+    
+    glue_qmul::apply_acc(C, A, B);
+    
+    glue_qmul::dequant(out, C, A, A_scales, A_zero_points, B, B_scales, B_zero_points);
+    }
+  else
+    {
+    Mat<s32> C;
+    
+    glue_qmul::apply_acc(C, A, B);
+    
+    glue_qmul::dequant(out, C, A, A_scales, A_zero_points, B, B_scales, B_zero_points);
+    }
+  }
+
+
+
+template<typename eT, typename acc_eT, typename eTA, typename eTB>
+inline
+void
+glue_qmul::dequant(Mat<eT>& out, const Mat<acc_eT>& C, const Mat<eTA>& A, const Mat<eT>& A_scales, const Mat<s32>& A_zero_points, const Mat<eTB>& B, const Mat<eT>& B_scales, const Mat<s32>& B_zero_points)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword M = A.n_rows;
+  const uword K = A.n_cols;
+  const uword N = B.n_cols;
+  
+  out.set_size(M, N);
+  
+  const bool A_has_zp = (A_zero_points.n_elem > 0);
+  const bool B_has_zp = (B_zero_points.n_elem > 0);
+  
+  // the corrections are computed in double precision, as K*za*zb can exceed the range of s32
+  
+  podarray<double> A_row_sums;
+  podarray<double> B_col_sums;
+  
+  if(B_has_zp)
+    {
+    A_row_sums.zeros(M);
+    
+    for(uword col=0; col < K; ++col)
+      {
+      const eTA* A_colptr = A.colptr(col);
+      
+      for(uword row=0; row < M; ++row)  { A_row_sums[row] += double(A_colptr[row]); }
+      }
+    }
+  
+  if(A_has_zp)
+    {
+    B_col_sums.zeros(N);
+    
+    for(uword col=0; col < N; ++col)
+      {
+      const eTB* B_colptr = B.colptr(col);
+      
+      double acc = double(0);
+      
+      for(uword row=0; row < K; ++row)  { acc += double(B_colptr[row]); }
+      
+      B_col_sums[col] = acc;
+      }
+    }
+  
+  const eT*  A_scales_mem = A_scales.memptr();
+  const eT*  B_scales_mem = B_scales.memptr();
+  const s32* A_zp_mem     = A_zero_points.memptr();
+  const s32* B_zp_mem     = B_zero_points.memptr();
+  
+  const bool A_per_row = (A_scales.n_elem != 1);
+  const bool B_per_col = (B_scales.n_elem != 1);
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const uword  j    = (B_per_col) ? col : uword(0);
+    const eT     sb   = B_scales_mem[j];
+    const double zb   = (B_has_zp) ? double(B_zp_mem[j]) : double(0);
+    const double csum = (A_has_zp) ? B_col_sums[col]    : double(0);
+    
+    const acc_eT* C_colptr   = C.colptr(col);
+          eT*     out_colptr = out.colptr(col);
+    
+    for(uword row=0; row < M; ++row)
+      {
+      const uword  i  = (A_per_row) ? row : uword(0);
+      const double za = (A_has_zp) ? double(A_zp_mem[i]) : double(0);
+      
+      double val = double(C_colptr[row]);
+      
+      if(A_has_zp)  { val -= za * csum; }
+      if(B_has_zp)  { val -= zb * A_row_sums[row]; }
+      
+      if(A_has_zp && B_has_zp)  { val += double(K) * za * zb; }
+      
+      out_colptr[row] = eT(val) * A_scales_mem[i] * sb;
+      }
+    }
+  }
+
+
+
+//! @}
@@ -0,0 +1,49 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup glue_quantile
+//! @{
+
+
+class glue_quantile
+  {
+  public:
+  
+  template<typename eT>
+  inline static void multi_select(eT* X, const uword n_elem, const uword* ranks, const uword n_ranks);
+  
+  template<typename eT>
+  inline static void multi_select_worker(eT* X, const uword start, const uword endp1, const uword* ranks, const uword n_ranks);
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& P, const uword dim);
+  
+  template<typename T1, typename T2>
+  inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile>& expr);
+  };
+
+
+
+class glue_quantile_default
+  {
+  public:
+  
+  template<typename T1, typename T2>
+  inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile_default>& expr);
+  };
+
+
+//! @}
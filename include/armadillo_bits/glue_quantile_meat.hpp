@@ -0,0 +1,257 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup glue_quantile
+//! @{
+
+
+//! Partially order the array X so that X[ranks[i]] holds the ranks[i]-th smallest element
+//! for each of the given ranks, as if X was sorted in ascending order.
+//! The ranks must be sorted in ascending order, without duplicates, and less than n_elem.
+//! Each partitioning step (via std::nth_element) splits both the array and the set of ranks,
+//! so the cost is O(n_elem * log(n_ranks)) rather than the O(n_elem * log(n_elem)) of a full sort.
+template<typename eT>
+inline
+void
+glue_quantile::multi_select(eT* X, const uword n_elem, const uword* ranks, const uword n_ranks)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_quantile::multi_select_worker(X, 0, n_elem, ranks, n_ranks);
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_quantile::multi_select_worker(eT* X, const uword start, const uword endp1, const uword* ranks, const uword n_ranks)
+  {
+  if( (n_ranks == 0) || ((endp1 - start) < 2) )  { return; }
+  
+  const uword mid  = n_ranks / 2;
+  const uword rank = ranks[mid];
+  
+  std::nth_element( X + start, X + rank, X + endp1 );
+  
+  glue_quantile::multi_select_worker(X, start,    rank,  ranks,           mid              );
+  glue_quantile::multi_select_worker(X, rank + 1, endp1, ranks + mid + 1, n_ranks - mid - 1);
+  }
+
+
+
+//! Quantiles are found via linear interpolation between order statistics,
+//! using "Definition 5" (piecewise linear, with the k-th order statistic at probability (k-0.5)/N) in:
+//! Rob J. Hyndman and Yanan Fan.
+//! Sample Quantiles in Statistical Packages.
+//! The American Statistician, Vol. 50, No. 4, pp. 361-365, 1996.
+template<typename eT>
+inline
+void
+glue_quantile::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& P, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((P.is_vec() == false) && (P.is_empty() == false)), "quantile(): parameter 'P' must be a vector" );
+  
+  if(X.is_empty() || P.is_empty())  { out.reset(); return; }
+  
+  const uword P_n_elem = P.n_elem;
+  const eT*   P_mem    = P.memptr();
+  
+  for(uword i=0; i < P_n_elem; ++i)
+    {
+    const eT P_val = P_mem[i];
+    
+    arma_debug_check( ((P_val >= eT(0)) && (P_val <= eT(1))) == false, "quantile(): values in 'P' must be in the [0,1] interval" );
+    }
+  
+  // the selection is done in-place, so each column (or row) of X is copied into a column of the work matrix
+  
+  Mat<eT> work;
+  
+  if(dim == 0)  { work = X; } else { op_strans::apply_mat_noalias(work, X); }
+  
+  const uword N       = work.n_rows;
+  const uword n_lines = work.n_cols;
+  const eT    N_eT    = eT(N);
+  
+  // the order statistics needed for each probability are the same for every column of the work matrix
+  
+  podarray<uword> lo_index(P_n_elem);
+  podarray<uword> hi_index(P_n_elem);
+  podarray<eT>    weight(P_n_elem);
+  
+  podarray<uword> ranks(2*P_n_elem);
+  
+  for(uword i=0; i < P_n_elem; ++i)
+    {
+    const eT h = N_eT * P_mem[i] + eT(0.5);  // position in 1-based sorted order
+    
+    if(h < eT(1))
+      {
+      lo_index[i] = 0;
+      hi_index[i] = 0;
+      weight[i]   = eT(0);
+      }
+    else
+    if(h >= N_eT)
+      {
+      lo_index[i] = N-1;
+      hi_index[i] = N-1;
+      weight[i]   = eT(0);
+      }
+    else
+      {
+      const uword k = uword(std::floor(h));
+      
+      lo_index[i] = k-1;
+      hi_index[i] = k;
+      weight[i]   = h - eT(k);
+      }
+    
+    ranks[2*i    ] = lo_index[i];
+    ranks[2*i + 1] = hi_index[i];
+    }
+  
+  uword* ranks_mem = ranks.memptr();
+  
+  std::sort(ranks_mem, ranks_mem + 2*P_n_elem);
+  
+  const uword n_ranks = uword(std::unique(ranks_mem, ranks_mem + 2*P_n_elem) - ranks_mem);
+  
+  if(dim == 0)  { out.set_size(P_n_elem, n_lines); } else { out.set_size(n_lines, P_n_elem); }
+  
+  const uword out_n_rows = out.n_rows;
+        eT*   out_mem    = out.memptr();
+  
+  // for dim = 0, quantiles for line j are stored in column j of the output;
+  // for dim = 1, quantiles for line j are stored in row j of the output
+  
+  const uword out_line_offset = (dim == 0) ? out_n_rows : uword(1);
+  const uword out_elem_offset = (dim == 0) ? uword(1)   : out_n_rows;
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(work.n_elem) && (n_lines > 1) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+      for(uword line=0; line < n_lines; ++line)
+        {
+        eT* line_mem = work.colptr(line);
+        
+        glue_quantile::multi_select(line_mem, N, ranks_mem, n_ranks);
+        
+        eT* out_line_mem = &(out_mem[line * out_line_offset]);
+        
+        for(uword i=0; i < P_n_elem; ++i)
+          {
+          const eT lo_val = line_mem[ lo_index[i] ];
+          const eT hi_val = line_mem[ hi_index[i] ];
+          
+          out_line_mem[i * out_elem_offset] = lo_val + weight[i] * (hi_val - lo_val);
+          }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword line=0; line < n_lines; ++line)
+      {
+      eT* line_mem = work.colptr(line);
+      
+      glue_quantile::multi_select(line_mem, N, ranks_mem, n_ranks);
+      
+      eT* out_line_mem = &(out_mem[line * out_line_offset]);
+      
+      for(uword i=0; i < P_n_elem; ++i)
+        {
+        const eT lo_val = line_mem[ lo_index[i] ];
+        const eT hi_val = line_mem[ hi_index[i] ];
+        
+        out_line_mem[i * out_elem_offset] = lo_val + weight[i] * (hi_val - lo_val);
+        }
+      }
+    }
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_quantile::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword dim = expr.aux_uword;
+  
+  arma_debug_check( (dim > 1), "quantile(): parameter 'dim' must be 0 or 1" );
+  
+  const quasi_unwrap<T1> UA(expr.A);
+  const quasi_unwrap<T2> UB(expr.B);
+  
+  if(UA.is_alias(out) || UB.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    glue_quantile::apply_noalias(tmp, UA.M, UB.M, dim);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    glue_quantile::apply_noalias(out, UA.M, UB.M, dim);
+    }
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_quantile_default::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile_default>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> UA(expr.A);
+  const quasi_unwrap<T2> UB(expr.B);
+  
+  const uword dim = ( (T1::is_row) || ((T1::is_col == false) && (UA.M.n_rows == 1)) ) ? 1 : 0;
+  
+  if(UA.is_alias(out) || UB.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    glue_quantile::apply_noalias(tmp, UA.M, UB.M, dim);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    glue_quantile::apply_noalias(out, UA.M, UB.M, dim);
+    }
+  }
+
+
+//! @}
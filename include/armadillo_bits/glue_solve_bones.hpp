@@ -27,6 +27,10 @@ class glue_solve_gen
   template<typename T1, typename T2> inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_solve_gen>& X);
   
   template<typename eT, typename T1, typename T2> inline static bool apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>& B_expr, const uword flags);
+  
+  template<typename eT, typename T1, typename T2> inline static bool apply(Mat<eT>& out, typename get_pod_type<eT>::result& out_rcond, uword& out_n_iter, const Base<eT,T1>& A_expr, const Base<eT,T2>& B_expr, const uword flags);
+  
+  template<typename eT, typename T1, typename T2> inline static bool apply_fixed(Mat<eT>& out, const T1& A, const Base<eT,T2>& B_expr, const uword flags);
   };
 
 
@@ -80,6 +84,7 @@ namespace solve_opts
   static const uword flag_tril        = uword(1u << 4);
   static const uword flag_no_band     = uword(1u << 5);
   static const uword flag_no_sympd    = uword(1u << 6);
+  static const uword flag_mixed       = uword(1u << 7);
   
   struct opts_none        : public opts { inline opts_none()        : opts(flag_none       ) {} };
   struct opts_fast        : public opts { inline opts_fast()        : opts(flag_fast       ) {} };
@@ -89,6 +94,7 @@ namespace solve_opts
   struct opts_tril        : public opts { inline opts_tril()        : opts(flag_tril       ) {} };
   struct opts_no_band     : public opts { inline opts_no_band()     : opts(flag_no_band    ) {} };
   struct opts_no_sympd    : public opts { inline opts_no_sympd()    : opts(flag_no_sympd   ) {} };
+  struct opts_mixed       : public opts { inline opts_mixed()       : opts(flag_mixed      ) {} };
   
   static const opts_none        none;
   static const opts_fast        fast;
@@ -98,6 +104,7 @@ namespace solve_opts
   static const opts_tril        tril;
   static const opts_no_band     no_band;
   static const opts_no_sympd    no_sympd;
+  static const opts_mixed       mixed;
   }
 
 
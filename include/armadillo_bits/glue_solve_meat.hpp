@@ -30,7 +30,11 @@ glue_solve_gen::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_so
   {
   arma_extra_debug_sigprint();
   
-  const bool status = glue_solve_gen::apply( out, X.A, X.B, X.aux_uword );
+  const uword flags = X.aux_uword;
+  
+  const bool use_fixed = (fixed_dims<T1>::is_small_sq) && bool(flags & solve_opts::flag_fast) && (bool(flags & solve_opts::flag_equilibrate) == false);
+  
+  const bool status = (use_fixed) ? glue_solve_gen::apply_fixed( out, X.A, X.B, flags ) : glue_solve_gen::apply( out, X.A, X.B, flags );
   
   if(status == false)
     {
@@ -40,6 +44,45 @@ glue_solve_gen::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_so
 
 
 
+//! for fixed-size A (up to 16x16) with the 'fast' option, via a kernel with the size known at compile time
+template<typename eT, typename T1, typename T2>
+inline
+bool
+glue_solve_gen::apply_fixed(Mat<eT>& out, const T1& A, const Base<eT,T2>& B_expr, const uword flags)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = fixed_dims<T1>::n_rows;
+  
+  const quasi_unwrap<T1> UA(A);
+  const quasi_unwrap<T2> UB(B_expr.get_ref());
+  
+  const Mat<eT>& B = UB.M;
+  
+  arma_debug_check( (B.n_rows != N), "solve(): number of rows in the given objects must be the same" );
+  
+  const bool is_alias = UA.is_alias(out) || UB.is_alias(out);
+  
+  Mat<eT>  tmp;
+  Mat<eT>& dest = (is_alias) ? tmp : out;
+  
+  dest.set_size(N, B.n_cols);
+  
+  const bool status = batch_linalg::solve_tiny<eT, fixed_dims<T1>::small_sq_N>(dest.memptr(), UA.M.memptr(), B.memptr(), B.n_cols);
+  
+  if(status == false)
+    {
+    // singular matrix: let the general solver find an approximate solution, if allowed
+    return glue_solve_gen::apply( out, A, B_expr, flags );
+    }
+  
+  if(is_alias)  { out.steal_mem(tmp); }
+  
+  return true;
+  }
+
+
+
 template<typename eT, typename T1, typename T2>
 inline
 bool
@@ -49,11 +92,34 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
   
   typedef typename get_pod_type<eT>::result T;
   
+  T     rcond  = T(0);
+  uword n_iter = 0;
+  
+  return glue_solve_gen::apply(out, rcond, n_iter, A_expr, B_expr, flags);
+  }
+
+
+
+//! as above, also providing the reciprocal condition number estimated by the solver (zero if not estimated)
+//! and the number of refinement steps taken by the mixed precision solver (zero if not used)
+template<typename eT, typename T1, typename T2>
+inline
+bool
+glue_solve_gen::apply(Mat<eT>& out, typename get_pod_type<eT>::result& out_rcond, uword& out_n_iter, const Base<eT,T1>& A_expr, const Base<eT,T2>& B_expr, const uword flags)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  out_rcond  = T(0);
+  out_n_iter = 0;
+  
   const bool fast        = bool(flags & solve_opts::flag_fast       );
   const bool equilibrate = bool(flags & solve_opts::flag_equilibrate);
   const bool no_approx   = bool(flags & solve_opts::flag_no_approx  );
   const bool no_band     = bool(flags & solve_opts::flag_no_band    );
   const bool no_sympd    = bool(flags & solve_opts::flag_no_sympd   );
+  const bool mixed       = bool(flags & solve_opts::flag_mixed      );
   
   arma_extra_debug_print("glue_solve_gen::apply(): enabled flags:");
   
@@ -62,9 +128,11 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
   if(no_approx  )  { arma_extra_debug_print("no_approx");   }
   if(no_band    )  { arma_extra_debug_print("no_band");     }
   if(no_sympd   )  { arma_extra_debug_print("no_sympd");    }
+  if(mixed      )  { arma_extra_debug_print("mixed");       }
   
-  T    rcond  = T(0);
-  bool status = false;
+  T     rcond  = T(0);
+  uword n_iter = 0;
+  bool  status = false;
   
   Mat<eT> A = A_expr.get_ref();
   
@@ -81,53 +149,76 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
       const bool is_band = false;
     #endif
     
-    if(fast)
+    if(mixed && (is_band == false) && (get_lower_prec_type<eT>::value) && (auxlib::crippled_lapack(A) == false))
       {
-      if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'fast' is enabled"); }
+      arma_extra_debug_print("glue_solve_gen::apply(): mixed precision + dense");
+      
+      status = auxlib::solve_square_mixed(out, rcond, n_iter, A, B_expr.get_ref(), (no_sympd == false));
       
-      if(is_band == false)
+      if(status)
         {
-        arma_extra_debug_print("glue_solve_gen::apply(): fast + dense");
-        
-        status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
+        arma_extra_debug_print("glue_solve_gen::apply(): rcond estimate: ", rcond);
+        arma_extra_debug_print("glue_solve_gen::apply(): number of refinement steps: ", n_iter);
         }
       else
         {
-        if( (KL == 1) && (KU == 1) )
+        arma_extra_debug_print("glue_solve_gen::apply(): mixed precision failed; falling back to working precision");
+        
+        rcond  = T(0);
+        n_iter = 0;
+        }
+      }
+    
+    if(status == false)
+      {
+      if(fast)
+        {
+        if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'fast' is enabled"); }
+        
+        if(is_band == false)
           {
-          arma_extra_debug_print("glue_solve_gen::apply(): fast + tridiagonal");
+          arma_extra_debug_print("glue_solve_gen::apply(): fast + dense");
           
-          status = auxlib::solve_tridiag_fast(out, A, B_expr.get_ref());
+          status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
           }
         else
           {
-          arma_extra_debug_print("glue_solve_gen::apply(): fast + band");
-          
-          status = auxlib::solve_band_fast(out, A, KL, KU, B_expr.get_ref());
+          if( (KL == 1) && (KU == 1) )
+            {
+            arma_extra_debug_print("glue_solve_gen::apply(): fast + tridiagonal");
+            
+            status = auxlib::solve_tridiag_fast(out, A, B_expr.get_ref());
+            }
+          else
+            {
+            arma_extra_debug_print("glue_solve_gen::apply(): fast + band");
+            
+            status = auxlib::solve_band_fast(out, A, KL, KU, B_expr.get_ref());
+            }
           }
         }
-      }
-    else
-      {
-      if(is_band == false)
-        {
-        arma_extra_debug_print("glue_solve_gen::apply(): refine + dense");
-        
-        status = auxlib::solve_square_refine(out, rcond, A, B_expr, equilibrate);  // A is overwritten
-        }
       else
         {
-        if( (KL == 1) && (KU == 1) && (equilibrate == false) )
+        if(is_band == false)
           {
-          arma_extra_debug_print("glue_solve_gen::apply(): refine + tridiagonal");
+          arma_extra_debug_print("glue_solve_gen::apply(): refine + dense");
           
-          status = auxlib::solve_tridiag_refine(out, rcond, A, B_expr);
+          status = auxlib::solve_square_refine(out, rcond, A, B_expr, equilibrate);  // A is overwritten
           }
         else
           {
-          arma_extra_debug_print("glue_solve_gen::apply(): refine + band");
-          
-          status = auxlib::solve_band_refine(out, rcond, A, KL, KU, B_expr, equilibrate);
+          if( (KL == 1) && (KU == 1) && (equilibrate == false) )
+            {
+            arma_extra_debug_print("glue_solve_gen::apply(): refine + tridiagonal");
+            
+            status = auxlib::solve_tridiag_refine(out, rcond, A, B_expr);
+            }
+          else
+            {
+            arma_extra_debug_print("glue_solve_gen::apply(): refine + band");
+            
+            status = auxlib::solve_band_refine(out, rcond, A, KL, KU, B_expr, equilibrate);
+            }
           }
         }
       }
@@ -176,6 +267,9 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
   
   if(status == false)  { out.soft_reset(); }
   
+  out_rcond  = rcond;
+  out_n_iter = n_iter;
+  
   return status;
   }
 
@@ -38,6 +38,31 @@ struct depth_lhs< glue_type, Glue<T1,T2,glue_type> >
 
 
 
+//! \brief
+//! Template metaprogram depth_lhs_times
+//! calculates the number of matrix multiplications on the left hand side of a product;
+//! unlike depth_lhs, it also counts products involving diagmat() (ie. glue_times_diag)
+
+template<typename T1>
+struct depth_lhs_times
+  {
+  static const uword num = 0;
+  };
+
+template<typename T1, typename T2>
+struct depth_lhs_times< Glue<T1,T2,glue_times> >
+  {
+  static const uword num = 1 + depth_lhs_times<T1>::num;
+  };
+
+template<typename T1, typename T2>
+struct depth_lhs_times< Glue<T1,T2,glue_times_diag> >
+  {
+  static const uword num = 1 + depth_lhs_times<T1>::num;
+  };
+
+
+
 template<bool do_inv_detect>
 struct glue_times_redirect2_helper
   {
@@ -138,6 +163,44 @@ class glue_times
 
 
 
+//! Products in which one operand is a join_rows() or join_cols() of matrices (or submatrices)
+//! are evaluated block by block, without materialising the concatenation
+class glue_times_join
+  {
+  public:
+  
+  template<typename T1, typename glue_type>
+  struct is_tree { static const bool value = is_Mat<T1>::value || is_subview<T1>::value || is_subview_col<T1>::value || is_subview_row<T1>::value; };
+  
+  template<typename T1, typename T2, typename glue_type>
+  struct is_tree< Glue<T1, T2, glue_type>, glue_type > { static const bool value = is_tree<T1, glue_type>::value && is_tree<T2, glue_type>::value; };
+  
+  template<typename eT, typename T1, typename T2> inline static bool apply_lhs(Mat<eT>& out, const T1& A, const T2& B);
+  template<typename eT, typename T1, typename T2> inline static bool apply_rhs(Mat<eT>& out, const T1& A, const T2& B);
+  
+  template<typename eT, typename T1, typename T2, typename T3> inline static bool apply_lhs(Mat<eT>& out, const Glue<T1, T2, glue_join_rows>& A, const T3& B);
+  template<typename eT, typename T1, typename T2, typename T3> inline static bool apply_lhs(Mat<eT>& out, const Glue<T1, T2, glue_join_cols>& A, const T3& B);
+  
+  template<typename eT, typename T1, typename T2, typename T3> inline static bool apply_rhs(Mat<eT>& out, const T1& A, const Glue<T2, T3, glue_join_rows>& B);
+  template<typename eT, typename T1, typename T2, typename T3> inline static bool apply_rhs(Mat<eT>& out, const T1& A, const Glue<T2, T3, glue_join_cols>& B);
+  
+  //
+  
+  template<typename eT, typename T1>              inline static void lhs_rows(Mat<eT>& out, const T1&                            X, const Mat<eT>& W, uword& offset);
+  template<typename eT, typename T1, typename T2> inline static void lhs_rows(Mat<eT>& out, const Glue<T1, T2, glue_join_rows>& X, const Mat<eT>& W, uword& offset);
+  
+  template<typename eT, typename T1>              inline static void lhs_cols(Mat<eT>& out, const T1&                            X, const Mat<eT>& W, uword& offset);
+  template<typename eT, typename T1, typename T2> inline static void lhs_cols(Mat<eT>& out, const Glue<T1, T2, glue_join_cols>& X, const Mat<eT>& W, uword& offset);
+  
+  template<typename eT, typename T1>              inline static void rhs_rows(Mat<eT>& out, const Mat<eT>& W, const T1&                            X, uword& offset);
+  template<typename eT, typename T1, typename T2> inline static void rhs_rows(Mat<eT>& out, const Mat<eT>& W, const Glue<T1, T2, glue_join_rows>& X, uword& offset);
+  
+  template<typename eT, typename T1>              inline static void rhs_cols(Mat<eT>& out, const Mat<eT>& W, const T1&                            X, uword& offset);
+  template<typename eT, typename T1, typename T2> inline static void rhs_cols(Mat<eT>& out, const Mat<eT>& W, const Glue<T1, T2, glue_join_cols>& X, uword& offset);
+  };
+
+
+
 class glue_times_diag
   {
   public:
@@ -149,5 +212,164 @@ class glue_times_diag
 
 
 
+//! operand of a chain of matrix multiplications, as seen by glue_times_chain
+template<typename eT>
+struct glue_times_chain_term
+  {
+  const Mat<eT>* M;      //!< dense matrix; for diagonal terms, the diagonal; for inverse terms, the matrix to be inverted
+  
+  uword n_rows;          //!< number of rows of the term as it appears in the product
+  uword n_cols;          //!< number of columns of the term as it appears in the product
+  
+  bool do_trans;
+  bool is_diag;
+  bool is_inv;
+  };
+
+
+
+//! single operand of a chain; inverses are only detected for element types supported by LAPACK
+template<typename T1, bool do_inv_detect>
+struct glue_times_chain_leaf
+  {
+  typedef typename T1::elem_type eT;
+  
+  inline glue_times_chain_leaf(const T1& X);
+  
+  inline void get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const;
+  
+  const partial_unwrap<T1> U;
+  };
+
+
+template<typename T1, bool do_inv_detect>
+struct glue_times_chain_leaf< Op<T1, op_diagmat>, do_inv_detect >
+  {
+  typedef typename T1::elem_type eT;
+  
+  inline glue_times_chain_leaf(const Op<T1, op_diagmat>& X);
+  
+  inline void get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const;
+  
+  Col<eT> D;
+  uword   D_n_rows;
+  uword   D_n_cols;
+  };
+
+
+template<typename T1>
+struct glue_times_chain_leaf< Op<T1, op_inv>, true >
+  {
+  typedef typename T1::elem_type eT;
+  
+  inline glue_times_chain_leaf(const Op<T1, op_inv>& X);
+  
+  inline void get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const;
+  
+  const quasi_unwrap<T1> U;
+  };
+
+
+template<typename T1>
+struct glue_times_chain_leaf< Op<T1, op_inv_sympd>, true >
+  {
+  typedef typename T1::elem_type eT;
+  
+  inline glue_times_chain_leaf(const Op<T1, op_inv_sympd>& X);
+  
+  inline void get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const;
+  
+  const quasi_unwrap<T1> U;
+  };
+
+
+
+//! flattens a left-nested chain of products into its individual operands
+template<typename T1>
+struct glue_times_chain_collector
+  {
+  typedef typename T1::elem_type eT;
+  
+  static const uword n_terms = 1;
+  
+  inline glue_times_chain_collector(const T1& X);
+  
+  inline void get_terms(glue_times_chain_term<eT>* terms, eT& alpha, bool& use_alpha) const;
+  
+  const glue_times_chain_leaf<T1, is_supported_blas_type<eT>::value> leaf;
+  };
+
+
+template<typename T1, typename T2>
+struct glue_times_chain_collector< Glue<T1,T2,glue_times> >
+  {
+  typedef typename T1::elem_type eT;
+  
+  static const uword n_terms = 1 + glue_times_chain_collector<T1>::n_terms;
+  
+  inline glue_times_chain_collector(const Glue<T1,T2,glue_times>& X);
+  
+  inline void get_terms(glue_times_chain_term<eT>* terms, eT& alpha, bool& use_alpha) const;
+  
+  const glue_times_chain_collector<T1>                                  lhs;
+  const glue_times_chain_leaf<T2, is_supported_blas_type<eT>::value>    rhs;
+  };
+
+
+template<typename T1, typename T2>
+struct glue_times_chain_collector< Glue<T1,T2,glue_times_diag> >
+  {
+  typedef typename T1::elem_type eT;
+  
+  static const uword n_terms = 1 + glue_times_chain_collector<T1>::n_terms;
+  
+  inline glue_times_chain_collector(const Glue<T1,T2,glue_times_diag>& X);
+  
+  inline void get_terms(glue_times_chain_term<eT>* terms, eT& alpha, bool& use_alpha) const;
+  
+  const glue_times_chain_collector<T1>                                  lhs;
+  const glue_times_chain_leaf<T2, is_supported_blas_type<eT>::value>    rhs;
+  };
+
+
+
+//! Class which evaluates long chains of matrix multiplications,
+//! using an order of multiplications chosen at run-time via dynamic programming
+class glue_times_chain
+  {
+  public:
+  
+  static const uword min_n_terms = 5;  //!< shorter chains are handled by glue_times_redirect<2>, <3> and <4>
+  
+  template<typename T1>
+  inline static void apply(Mat<typename T1::elem_type>& out, const T1& X);
+  
+  template<typename eT>
+  inline static void order(podarray<uword>& split, const glue_times_chain_term<eT>* terms, const uword N);
+  
+  template<typename eT>
+  inline static void eval(Mat<eT>& out, const glue_times_chain_term<eT>* terms, const podarray<uword>& split, const uword N, const uword i, const uword j);
+  
+  template<typename eT>
+  inline static void mul(Mat<eT>& out, const glue_times_chain_term<eT>& A, const glue_times_chain_term<eT>& B);
+  
+  template<typename eT>
+  inline static const Mat<eT>& extract(Mat<eT>& tmp, const glue_times_chain_term<eT>& A);
+  
+  template<typename eT>
+  inline static void solve(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const typename arma_blas_type_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void solve(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const typename arma_not_blas_type<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void inv(Mat<eT>& out, const Mat<eT>& A, const typename arma_blas_type_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void inv(Mat<eT>& out, const Mat<eT>& A, const typename arma_not_blas_type<eT>::result* junk = 0);
+  };
+
+
+
 //! @}
 
@@ -291,45 +291,7 @@ glue_times_redirect<N>::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2
   {
   arma_extra_debug_sigprint();
   
-  typedef typename T1::elem_type eT;
-  
-  const partial_unwrap<T1> tmp1(X.A);
-  const partial_unwrap<T2> tmp2(X.B);
-  
-  const typename partial_unwrap<T1>::stored_type& A = tmp1.M;
-  const typename partial_unwrap<T2>::stored_type& B = tmp2.M;
-  
-  const bool use_alpha = partial_unwrap<T1>::do_times || partial_unwrap<T2>::do_times;
-  const eT       alpha = use_alpha ? (tmp1.get_val() * tmp2.get_val()) : eT(0);
-  
-  const bool alias = tmp1.is_alias(out) || tmp2.is_alias(out);
-  
-  if(alias == false)
-    {
-    glue_times::apply
-      <
-      eT,
-      partial_unwrap<T1>::do_trans,
-      partial_unwrap<T2>::do_trans,
-      (partial_unwrap<T1>::do_times || partial_unwrap<T2>::do_times)
-      >
-      (out, A, B, alpha);
-    }
-  else
-    {
-    Mat<eT> tmp;
-    
-    glue_times::apply
-      <
-      eT,
-      partial_unwrap<T1>::do_trans,
-      partial_unwrap<T2>::do_trans,
-      (partial_unwrap<T1>::do_times || partial_unwrap<T2>::do_times)
-      >
-      (tmp, A, B, alpha);
-    
-    out.steal_mem(tmp);
-    }
+  glue_times_chain::apply(out, X);
   }
 
 
@@ -438,7 +400,18 @@ glue_times::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>
   
   arma_extra_debug_print(arma_str::format("N_mat = %d") % N_mat);
   
-  glue_times_redirect<N_mat>::apply(out, X);
+  if( glue_times_join::apply_lhs(out, X.A, X.B) )  { return; }
+  if( glue_times_join::apply_rhs(out, X.A, X.B) )  { return; }
+  
+  if( (1 + depth_lhs_times< Glue<T1,T2,glue_times> >::num) >= glue_times_chain::min_n_terms )
+    {
+    // long chain, possibly interleaved with diagmat()
+    glue_times_chain::apply(out, X);
+    }
+  else
+    {
+    glue_times_redirect<N_mat>::apply(out, X);
+    }
   }
 
 
@@ -621,6 +594,13 @@ glue_times::apply
     return;
     }
   
+  if( gemm_emul_fixed<TA, TB, do_trans_A, do_trans_B, use_alpha>::use_kernel )
+    {
+    gemm_emul_fixed<TA, TB, do_trans_A, do_trans_B, use_alpha>::apply(out.memptr(), A.memptr(), B.memptr(), alpha);
+    
+    return;
+    }
+  
   
   if( (do_trans_A == false) && (do_trans_B == false) && (use_alpha == false) )
     {
@@ -802,6 +782,13 @@ glue_times_diag::apply(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue
   
   typedef typename T1::elem_type eT;
   
+  if( (1 + depth_lhs_times< Glue<T1,T2,glue_times_diag> >::num) >= glue_times_chain::min_n_terms )
+    {
+    glue_times_chain::apply(out, X);
+    
+    return;
+    }
+  
   const strip_diagmat<T1> S1(X.A);
   const strip_diagmat<T2> S2(X.B);
   
@@ -899,4 +886,880 @@ glue_times_diag::apply(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue
 
 
 
+//
+// glue_times_chain_leaf
+
+
+
+template<typename T1, bool do_inv_detect>
+inline
+glue_times_chain_leaf<T1,do_inv_detect>::glue_times_chain_leaf(const T1& X)
+  : U(X)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1, bool do_inv_detect>
+inline
+void
+glue_times_chain_leaf<T1,do_inv_detect>::get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const Mat<eT>& M = U.M;
+  
+  const bool do_trans = partial_unwrap<T1>::do_trans;
+  
+  term.M        = &M;
+  term.n_rows   = do_trans ? M.n_cols : M.n_rows;
+  term.n_cols   = do_trans ? M.n_rows : M.n_cols;
+  term.do_trans = do_trans;
+  term.is_diag  = false;
+  term.is_inv   = false;
+  
+  if(partial_unwrap<T1>::do_times)
+    {
+    alpha    *= U.get_val();
+    use_alpha = true;
+    }
+  }
+
+
+
+template<typename T1, bool do_inv_detect>
+inline
+glue_times_chain_leaf< Op<T1, op_diagmat>, do_inv_detect >::glue_times_chain_leaf(const Op<T1, op_diagmat>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const diagmat_proxy<T1> P(X.m);
+  
+  D_n_rows = P.n_rows;
+  D_n_cols = P.n_cols;
+  
+  const uword N = (std::min)(D_n_rows, D_n_cols);
+  
+  D.set_size(N);
+  
+  eT* D_mem = D.memptr();
+  
+  for(uword i=0; i < N; ++i)  { D_mem[i] = P[i]; }
+  }
+
+
+
+template<typename T1, bool do_inv_detect>
+inline
+void
+glue_times_chain_leaf< Op<T1, op_diagmat>, do_inv_detect >::get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(alpha);
+  arma_ignore(use_alpha);
+  
+  term.M        = &D;
+  term.n_rows   = D_n_rows;
+  term.n_cols   = D_n_cols;
+  term.do_trans = false;
+  term.is_diag  = true;
+  term.is_inv   = false;
+  }
+
+
+
+template<typename T1>
+inline
+glue_times_chain_leaf< Op<T1, op_inv>, true >::glue_times_chain_leaf(const Op<T1, op_inv>& X)
+  : U(X.m)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1>
+inline
+void
+glue_times_chain_leaf< Op<T1, op_inv>, true >::get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(alpha);
+  arma_ignore(use_alpha);
+  
+  arma_debug_check( (U.M.is_square() == false), "inv(): given matrix must be square sized" );
+  
+  term.M        = &(U.M);
+  term.n_rows   = U.M.n_rows;
+  term.n_cols   = U.M.n_cols;
+  term.do_trans = false;
+  term.is_diag  = false;
+  term.is_inv   = true;
+  }
+
+
+
+template<typename T1>
+inline
+glue_times_chain_leaf< Op<T1, op_inv_sympd>, true >::glue_times_chain_leaf(const Op<T1, op_inv_sympd>& X)
+  : U(X.m)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1>
+inline
+void
+glue_times_chain_leaf< Op<T1, op_inv_sympd>, true >::get_term(glue_times_chain_term<eT>& term, eT& alpha, bool& use_alpha) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(alpha);
+  arma_ignore(use_alpha);
+  
+  arma_debug_check( (U.M.is_square() == false), "inv_sympd(): given matrix must be square sized" );
+  
+  term.M        = &(U.M);
+  term.n_rows   = U.M.n_rows;
+  term.n_cols   = U.M.n_cols;
+  term.do_trans = false;
+  term.is_diag  = false;
+  term.is_inv   = true;
+  }
+
+
+
+//
+// glue_times_chain_collector
+
+
+
+template<typename T1>
+inline
+glue_times_chain_collector<T1>::glue_times_chain_collector(const T1& X)
+  : leaf(X)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1>
+inline
+void
+glue_times_chain_collector<T1>::get_terms(glue_times_chain_term<eT>* terms, eT& alpha, bool& use_alpha) const
+  {
+  leaf.get_term(terms[0], alpha, use_alpha);
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+glue_times_chain_collector< Glue<T1,T2,glue_times> >::glue_times_chain_collector(const Glue<T1,T2,glue_times>& X)
+  : lhs(X.A)
+  , rhs(X.B)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_times_chain_collector< Glue<T1,T2,glue_times> >::get_terms(glue_times_chain_term<eT>* terms, eT& alpha, bool& use_alpha) const
+  {
+  lhs.get_terms(terms, alpha, use_alpha);
+  rhs.get_term(terms[n_terms-1], alpha, use_alpha);
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+glue_times_chain_collector< Glue<T1,T2,glue_times_diag> >::glue_times_chain_collector(const Glue<T1,T2,glue_times_diag>& X)
+  : lhs(X.A)
+  , rhs(X.B)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_times_chain_collector< Glue<T1,T2,glue_times_diag> >::get_terms(glue_times_chain_term<eT>* terms, eT& alpha, bool& use_alpha) const
+  {
+  lhs.get_terms(terms, alpha, use_alpha);
+  rhs.get_term(terms[n_terms-1], alpha, use_alpha);
+  }
+
+
+
+//
+// glue_times_chain
+
+
+
+template<typename T1>
+inline
+void
+glue_times_chain::apply(Mat<typename T1::elem_type>& out, const T1& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword N = glue_times_chain_collector<T1>::n_terms;
+  
+  arma_extra_debug_print(arma_str::format("glue_times_chain::apply(): N = %d") % N);
+  
+  const glue_times_chain_collector<T1> C(X);
+  
+  glue_times_chain_term<eT> terms[N];
+  
+  eT   alpha     = eT(1);
+  bool use_alpha = false;
+  
+  C.get_terms(terms, alpha, use_alpha);
+  
+  for(uword i=0; i < (N-1); ++i)
+    {
+    arma_debug_assert_mul_size(terms[i].n_rows, terms[i].n_cols, terms[i+1].n_rows, terms[i+1].n_cols, "matrix multiplication");
+    }
+  
+  podarray<uword> split;
+  
+  glue_times_chain::order(split, terms, N);
+  
+  // the operands may alias the output, so the result is stored in a temporary
+  
+  Mat<eT> tmp;
+  
+  glue_times_chain::eval(tmp, terms, split, N, 0, N-1);
+  
+  if(use_alpha)  { arrayops::inplace_mul(tmp.memptr(), alpha, tmp.n_elem); }
+  
+  out.steal_mem(tmp);
+  }
+
+
+
+//! Standard O(N^3) dynamic programming over the dimensions of the terms.
+//! split[i + j*N] holds the position k at which the sub-chain i..j is split into (i..k) * (k+1..j).
+//! A product involving a bare diagonal term costs only a row or column scaling;
+//! ties are resolved in favour of the usual left-to-right order.
+template<typename eT>
+inline
+void
+glue_times_chain::order(podarray<uword>& split, const glue_times_chain_term<eT>* terms, const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  podarray<double> cost(N*N);
+  
+  split.set_size(N*N);
+  
+  for(uword i=0; i < N; ++i)  { cost[i + i*N] = double(0); split[i + i*N] = i; }
+  
+  for(uword len=2; len <= N; ++len)
+  for(uword i=0; (i+len) <= N; ++i)
+    {
+    const uword j = i + len - 1;
+    
+    const double n_rows = double(terms[i].n_rows);
+    const double n_cols = double(terms[j].n_cols);
+    
+    double best_cost = Datum<double>::inf;
+    uword  best_k    = i;
+    
+    for(uword k=i; k < j; ++k)
+      {
+      const bool scale_only = ( (k == i) && terms[i].is_diag ) || ( ((k+1) == j) && terms[j].is_diag );
+      
+      const double mul_cost = (scale_only) ? (n_rows * n_cols) : (n_rows * double(terms[k].n_cols) * n_cols);
+      
+      const double total_cost = cost[i + k*N] + cost[(k+1) + j*N] + mul_cost;
+      
+      if(total_cost <= best_cost)  { best_cost = total_cost; best_k = k; }
+      }
+    
+    cost[i + j*N]  = best_cost;
+    split[i + j*N] = best_k;
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_times_chain::eval(Mat<eT>& out, const glue_times_chain_term<eT>* terms, const podarray<uword>& split, const uword N, const uword i, const uword j)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword k = split[i + j*N];
+  
+  glue_times_chain_term<eT> A = terms[i];
+  glue_times_chain_term<eT> B = terms[j];
+  
+  Mat<eT> A_tmp;
+  Mat<eT> B_tmp;
+  
+  if(k > i)
+    {
+    glue_times_chain::eval(A_tmp, terms, split, N, i, k);
+    
+    A.M        = &A_tmp;
+    A.n_rows   = A_tmp.n_rows;
+    A.n_cols   = A_tmp.n_cols;
+    A.do_trans = false;
+    A.is_diag  = false;
+    A.is_inv   = false;
+    }
+  
+  if((k+1) < j)
+    {
+    glue_times_chain::eval(B_tmp, terms, split, N, k+1, j);
+    
+    B.M        = &B_tmp;
+    B.n_rows   = B_tmp.n_rows;
+    B.n_cols   = B_tmp.n_cols;
+    B.do_trans = false;
+    B.is_diag  = false;
+    B.is_inv   = false;
+    }
+  
+  glue_times_chain::mul(out, A, B);
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_times_chain::mul(Mat<eT>& out, const glue_times_chain_term<eT>& A, const glue_times_chain_term<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(A.is_diag)
+    {
+    Mat<eT> tmp;
+    
+    const Mat<eT>& BB = glue_times_chain::extract(tmp, B);
+    
+    const eT*   D     = A.M->memptr();
+    const uword D_len = A.M->n_elem;
+    
+    out.zeros(A.n_rows, BB.n_cols);
+    
+    for(uword col=0; col < BB.n_cols; ++col)
+      {
+            eT* out_coldata = out.colptr(col);
+      const eT*  BB_coldata =  BB.colptr(col);
+      
+      for(uword i=0; i < D_len; ++i)  { out_coldata[i] = D[i] * BB_coldata[i]; }
+      }
+    
+    return;
+    }
+  
+  if(B.is_diag)
+    {
+    Mat<eT> tmp;
+    
+    const Mat<eT>& AA = glue_times_chain::extract(tmp, A);
+    
+    const eT*   D     = B.M->memptr();
+    const uword D_len = B.M->n_elem;
+    
+    out.zeros(AA.n_rows, B.n_cols);
+    
+    for(uword col=0; col < D_len; ++col)
+      {
+      const eT val = D[col];
+      
+            eT* out_coldata = out.colptr(col);
+      const eT*  AA_coldata =  AA.colptr(col);
+      
+      for(uword i=0; i < AA.n_rows; ++i)  { out_coldata[i] = AA_coldata[i] * val; }
+      }
+    
+    return;
+    }
+  
+  if(A.is_inv)
+    {
+    // replace inv(A)*B with solve(A,B)
+    
+    Mat<eT> tmp;
+    
+    const Mat<eT>& BB = glue_times_chain::extract(tmp, B);
+    
+    glue_times_chain::solve(out, *(A.M), BB);
+    
+    return;
+    }
+  
+  Mat<eT> tmp;
+  
+  const Mat<eT>& BB = (B.is_inv) ? glue_times_chain::extract(tmp, B) : *(B.M);
+  const Mat<eT>& AA = *(A.M);
+  
+  const bool B_do_trans = (B.is_inv) ? false : B.do_trans;
+  
+       if( (A.do_trans == false) && (B_do_trans == false) )  { glue_times::apply<eT, false, false, false>(out, AA, BB, eT(0)); }
+  else if( (A.do_trans == true ) && (B_do_trans == false) )  { glue_times::apply<eT, true,  false, false>(out, AA, BB, eT(0)); }
+  else if( (A.do_trans == false) && (B_do_trans == true ) )  { glue_times::apply<eT, false, true,  false>(out, AA, BB, eT(0)); }
+  else                                                       { glue_times::apply<eT, true,  true,  false>(out, AA, BB, eT(0)); }
+  }
+
+
+
+//! obtain a term as a dense matrix, without any pending transpose
+template<typename eT>
+inline
+const Mat<eT>&
+glue_times_chain::extract(Mat<eT>& tmp, const glue_times_chain_term<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(A.is_diag)
+    {
+    tmp.zeros(A.n_rows, A.n_cols);
+    
+    tmp.diag() = *(A.M);
+    
+    return tmp;
+    }
+  
+  if(A.is_inv)
+    {
+    glue_times_chain::inv(tmp, *(A.M));
+    
+    return tmp;
+    }
+  
+  if(A.do_trans)
+    {
+    op_htrans::apply_mat_noalias(tmp, *(A.M));
+    
+    return tmp;
+    }
+  
+  return *(A.M);
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_times_chain::solve(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const typename arma_blas_type_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  Mat<eT> AA(A);
+  
+  const bool status = auxlib::solve_square_fast(out, AA, B);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("matrix multiplication: inverse of singular matrix; suggest to use solve() instead");
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_times_chain::solve(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const typename arma_not_blas_type<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(A);
+  arma_ignore(B);
+  arma_ignore(junk);
+  
+  // inverse terms are only formed for element types supported by LAPACK
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_times_chain::inv(Mat<eT>& out, const Mat<eT>& A, const typename arma_blas_type_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  op_inv::apply(out, A);
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_times_chain::inv(Mat<eT>& out, const Mat<eT>& A, const typename arma_not_blas_type<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(A);
+  arma_ignore(junk);
+  
+  // inverse terms are only formed for element types supported by LAPACK
+  }
+
+
+
+//
+// glue_times_join
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+bool
+glue_times_join::apply_lhs(Mat<eT>& out, const T1& A, const T2& B)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(A);
+  arma_ignore(B);
+  
+  return false;
+  }
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+bool
+glue_times_join::apply_rhs(Mat<eT>& out, const T1& A, const T2& B)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(A);
+  arma_ignore(B);
+  
+  return false;
+  }
+
+
+
+//! join_rows(A1, A2, ...) * B  =  A1 * B.rows(...)  +  A2 * B.rows(...)  +  ...
+template<typename eT, typename T1, typename T2, typename T3>
+inline
+bool
+glue_times_join::apply_lhs(Mat<eT>& out, const Glue<T1, T2, glue_join_rows>& A, const T3& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef Glue<T1, T2, glue_join_rows> join_type;
+  
+  if(is_tree<join_type, glue_join_rows>::value == false)  { return false; }
+  
+  const Proxy<join_type> PA(A);
+  
+  const quasi_unwrap<T3> UB(B);
+  const Mat<eT>& W     = UB.M;
+  
+  arma_debug_assert_mul_size(PA.get_n_rows(), PA.get_n_cols(), W.n_rows, W.n_cols, "matrix multiplication");
+  
+  Mat<eT> tmp;
+  
+  tmp.zeros(PA.get_n_rows(), W.n_cols);
+  
+  uword offset = 0;
+  
+  glue_times_join::lhs_rows(tmp, A, W, offset);
+  
+  out.steal_mem(tmp);
+  
+  return true;
+  }
+
+
+
+//! join_cols(A1, A2, ...) * B  =  join_cols(A1 * B, A2 * B, ...)
+template<typename eT, typename T1, typename T2, typename T3>
+inline
+bool
+glue_times_join::apply_lhs(Mat<eT>& out, const Glue<T1, T2, glue_join_cols>& A, const T3& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef Glue<T1, T2, glue_join_cols> join_type;
+  
+  if(is_tree<join_type, glue_join_cols>::value == false)  { return false; }
+  
+  const Proxy<join_type> PA(A);
+  
+  const quasi_unwrap<T3> UB(B);
+  const Mat<eT>& W     = UB.M;
+  
+  arma_debug_assert_mul_size(PA.get_n_rows(), PA.get_n_cols(), W.n_rows, W.n_cols, "matrix multiplication");
+  
+  Mat<eT> tmp(PA.get_n_rows(), W.n_cols);
+  
+  uword offset = 0;
+  
+  glue_times_join::lhs_cols(tmp, A, W, offset);
+  
+  out.steal_mem(tmp);
+  
+  return true;
+  }
+
+
+
+//! A * join_rows(B1, B2, ...)  =  join_rows(A * B1, A * B2, ...)
+template<typename eT, typename T1, typename T2, typename T3>
+inline
+bool
+glue_times_join::apply_rhs(Mat<eT>& out, const T1& A, const Glue<T2, T3, glue_join_rows>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef Glue<T2, T3, glue_join_rows> join_type;
+  
+  if(is_tree<join_type, glue_join_rows>::value == false)  { return false; }
+  
+  const Proxy<join_type> PB(B);
+  
+  const quasi_unwrap<T1> UA(A);
+  const Mat<eT>& W     = UA.M;
+  
+  arma_debug_assert_mul_size(W.n_rows, W.n_cols, PB.get_n_rows(), PB.get_n_cols(), "matrix multiplication");
+  
+  Mat<eT> tmp(W.n_rows, PB.get_n_cols());
+  
+  uword offset = 0;
+  
+  glue_times_join::rhs_rows(tmp, W, B, offset);
+  
+  out.steal_mem(tmp);
+  
+  return true;
+  }
+
+
+
+//! A * join_cols(B1, B2, ...)  =  A.cols(...) * B1  +  A.cols(...) * B2  +  ...
+template<typename eT, typename T1, typename T2, typename T3>
+inline
+bool
+glue_times_join::apply_rhs(Mat<eT>& out, const T1& A, const Glue<T2, T3, glue_join_cols>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef Glue<T2, T3, glue_join_cols> join_type;
+  
+  if(is_tree<join_type, glue_join_cols>::value == false)  { return false; }
+  
+  const Proxy<join_type> PB(B);
+  
+  const quasi_unwrap<T1> UA(A);
+  const Mat<eT>& W     = UA.M;
+  
+  arma_debug_assert_mul_size(W.n_rows, W.n_cols, PB.get_n_rows(), PB.get_n_cols(), "matrix multiplication");
+  
+  Mat<eT> tmp;
+  
+  tmp.zeros(W.n_rows, PB.get_n_cols());
+  
+  uword offset = 0;
+  
+  glue_times_join::rhs_cols(tmp, W, B, offset);
+  
+  out.steal_mem(tmp);
+  
+  return true;
+  }
+
+
+
+template<typename eT, typename T1>
+inline
+void
+glue_times_join::lhs_rows(Mat<eT>& out, const T1& X, const Mat<eT>& W, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X);
+  const Mat<eT>& A     = U.M;
+  
+  const uword k = A.n_cols;
+  
+  if(A.n_elem > 0)
+    {
+    if(W.n_cols == 1)
+      {
+      const Col<eT> W_block(const_cast<eT*>(W.memptr()) + offset, k, false, true);
+      
+      out += A * W_block;
+      }
+    else
+      {
+      out += A * W.rows(offset, offset + k - 1);
+      }
+    }
+  
+  offset += k;
+  }
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+void
+glue_times_join::lhs_rows(Mat<eT>& out, const Glue<T1, T2, glue_join_rows>& X, const Mat<eT>& W, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_times_join::lhs_rows(out, X.A, W, offset);
+  glue_times_join::lhs_rows(out, X.B, W, offset);
+  }
+
+
+
+template<typename eT, typename T1>
+inline
+void
+glue_times_join::lhs_cols(Mat<eT>& out, const T1& X, const Mat<eT>& W, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X);
+  const Mat<eT>& A     = U.M;
+  
+  const uword r = A.n_rows;
+  
+  if(r > 0)
+    {
+    if(A.n_elem == 0)
+      {
+      out.rows(offset, offset + r - 1).zeros();
+      }
+    else
+    if(W.n_cols == 1)
+      {
+      Col<eT> out_block(out.memptr() + offset, r, false, true);
+      
+      out_block = A * W;
+      }
+    else
+      {
+      out.rows(offset, offset + r - 1) = A * W;
+      }
+    }
+  
+  offset += r;
+  }
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+void
+glue_times_join::lhs_cols(Mat<eT>& out, const Glue<T1, T2, glue_join_cols>& X, const Mat<eT>& W, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_times_join::lhs_cols(out, X.A, W, offset);
+  glue_times_join::lhs_cols(out, X.B, W, offset);
+  }
+
+
+
+template<typename eT, typename T1>
+inline
+void
+glue_times_join::rhs_rows(Mat<eT>& out, const Mat<eT>& W, const T1& X, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X);
+  const Mat<eT>& B     = U.M;
+  
+  const uword k = B.n_cols;
+  
+  if(k > 0)
+    {
+    Mat<eT> out_block(out.colptr(offset), out.n_rows, k, false, true);
+    
+    if(B.n_elem == 0)
+      {
+      out_block.zeros();
+      }
+    else
+      {
+      out_block = W * B;
+      }
+    }
+  
+  offset += k;
+  }
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+void
+glue_times_join::rhs_rows(Mat<eT>& out, const Mat<eT>& W, const Glue<T1, T2, glue_join_rows>& X, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_times_join::rhs_rows(out, W, X.A, offset);
+  glue_times_join::rhs_rows(out, W, X.B, offset);
+  }
+
+
+
+template<typename eT, typename T1>
+inline
+void
+glue_times_join::rhs_cols(Mat<eT>& out, const Mat<eT>& W, const T1& X, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X);
+  const Mat<eT>& B     = U.M;
+  
+  const uword r = B.n_rows;
+  
+  if(B.n_elem > 0)
+    {
+    const Mat<eT> W_block(const_cast<eT*>(W.colptr(offset)), W.n_rows, r, false, true);
+    
+    out += W_block * B;
+    }
+  
+  offset += r;
+  }
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+void
+glue_times_join::rhs_cols(Mat<eT>& out, const Mat<eT>& W, const Glue<T1, T2, glue_join_cols>& X, uword& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_times_join::rhs_cols(out, W, X.A, offset);
+  glue_times_join::rhs_cols(out, W, X.B, offset);
+  }
+
+
+
 //! @}
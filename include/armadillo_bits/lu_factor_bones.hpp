@@ -0,0 +1,61 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup lu_factor
+//! @{
+
+
+
+//! LU decomposition of a square matrix (with partial pivoting), kept for repeated use.
+//! Once computed, each solve() requires only O(n^2) operations per column of the right-hand side.
+template<typename eT>
+class lu_factor
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  inline ~lu_factor();
+  inline  lu_factor();
+  
+  template<typename T1> inline explicit lu_factor(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool compute(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool    solve(Mat<eT>& out, const Base<eT,T1>& B) const;
+  template<typename T1> inline Mat<eT> solve(              const Base<eT,T1>& B) const;
+  
+  inline eT       det()                                   const;
+  inline void     log_det(eT& out_val, pod_type& out_sign) const;
+  inline pod_type rcond()                                 const;
+  
+  inline uword n_rows()   const;
+  inline bool  is_empty() const;
+  
+  inline void reset();
+  
+  
+  private:
+  
+  arma_aligned Mat<eT>            LU;         // L and U packed into one matrix, as produced by getrf()
+  arma_aligned podarray<blas_int> ipiv;       // row interchanges
+  arma_aligned pod_type           rcond_val;  // reciprocal condition number, estimated once by compute()
+  };
+
+
+
+//! @}
@@ -0,0 +1,271 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup lu_factor
+//! @{
+
+
+
+template<typename eT>
+inline
+lu_factor<eT>::~lu_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+lu_factor<eT>::lu_factor()
+  : rcond_val(pod_type(0))
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+lu_factor<eT>::lu_factor(const Base<eT,T1>& X)
+  : rcond_val(pod_type(0))
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = (*this).compute(X);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("lu_factor(): decomposition failed");
+    }
+  }
+
+
+
+//! factorise X;
+//! false is returned (and the object is reset) if X is singular
+template<typename eT>
+template<typename T1>
+inline
+bool
+lu_factor<eT>::compute(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  LU = X.get_ref();
+  
+  arma_debug_check( (LU.is_square() == false), "lu_factor::compute(): given matrix must be square sized" );
+  
+  rcond_val = pod_type(0);
+  
+  if(LU.is_empty())  { ipiv.reset(); return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(LU);
+    
+    char     norm_id = '1';
+    blas_int n       = blas_int(LU.n_rows);
+    blas_int info    = blas_int(0);
+    
+    podarray<pod_type> junk(1);
+    
+    const pod_type norm_val = lapack::lange(&norm_id, &n, &n, LU.memptr(), &n, junk.memptr());
+    
+    ipiv.set_size(LU.n_rows);
+    
+    arma_extra_debug_print("lapack::getrf()");
+    lapack::getrf(&n, &n, LU.memptr(), &n, ipiv.memptr(), &info);
+    
+    if(info != blas_int(0))  { (*this).reset(); return false; }
+    
+    rcond_val = auxlib::lu_rcond(LU, norm_val);
+    
+    return true;
+    }
+  #else
+    {
+    (*this).reset();
+    arma_stop_logic_error("lu_factor::compute(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve A*X = B, where A is the factorised matrix
+template<typename eT>
+template<typename T1>
+inline
+bool
+lu_factor<eT>::solve(Mat<eT>& out, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  out = B.get_ref();
+  
+  arma_debug_check( (out.n_rows != LU.n_rows), "lu_factor::solve(): number of rows in given matrix must match the size of the factorised matrix" );
+  
+  if(out.is_empty())  { return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(out);
+    
+    char     trans = 'N';
+    blas_int n     = blas_int(LU.n_rows);
+    blas_int nrhs  = blas_int(out.n_cols);
+    blas_int info  = blas_int(0);
+    
+    arma_extra_debug_print("lapack::getrs()");
+    lapack::getrs(&trans, &n, &nrhs, LU.memptr(), &n, ipiv.memptr(), out.memptr(), &n, &info);
+    
+    if(info != blas_int(0))  { out.soft_reset(); return false; }
+    
+    return true;
+    }
+  #else
+    {
+    out.soft_reset();
+    arma_stop_logic_error("lu_factor::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+lu_factor<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = (*this).solve(out, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("lu_factor::solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+eT
+lu_factor<eT>::det() const
+  {
+  arma_extra_debug_sigprint();
+  
+  eT val = eT(1);
+  
+  for(uword i=0; i < LU.n_rows; ++i)
+    {
+    val *= LU.at(i,i);
+    
+    if( blas_int(i) != (ipiv.mem[i] - 1) )  { val = -val; }  // NOTE: adjustment of -1 is required as Fortran counts from 1
+    }
+  
+  return val;
+  }
+
+
+
+//! log(abs(det)) and the sign of det for real matrices; complex log(det) for complex matrices (sign is then +1 or -1 due to row interchanges)
+template<typename eT>
+inline
+void
+lu_factor<eT>::log_det(eT& out_val, pod_type& out_sign) const
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef pod_type T;
+  
+  sword sign = +1;
+  eT    val  = eT(0);
+  
+  for(uword i=0; i < LU.n_rows; ++i)
+    {
+    const eT x = LU.at(i,i);
+    
+    sign *= (is_complex<eT>::value == false) ? ( (access::tmp_real(x) < T(0)) ? -1 : +1 ) : +1;
+    val  += (is_complex<eT>::value == false) ? std::log( (access::tmp_real(x) < T(0)) ? x*T(-1) : x ) : std::log(x);
+    
+    if( blas_int(i) != (ipiv.mem[i] - 1) )  { sign *= -1; }
+    }
+  
+  out_val  = val;
+  out_sign = T(sign);
+  }
+
+
+
+//! reciprocal condition number of the factorised matrix (estimate in the 1-norm)
+template<typename eT>
+inline
+typename lu_factor<eT>::pod_type
+lu_factor<eT>::rcond() const
+  {
+  return (LU.is_empty()) ? Datum<pod_type>::inf : rcond_val;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+lu_factor<eT>::n_rows() const
+  {
+  return LU.n_rows;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+lu_factor<eT>::is_empty() const
+  {
+  return LU.is_empty();
+  }
+
+
+
+template<typename eT>
+inline
+void
+lu_factor<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  LU.reset();
+  ipiv.reset();
+  
+  rcond_val = pod_type(0);
+  }
+
+
+
+//! @}
@@ -86,4 +86,48 @@ struct mp_thread_limit
 
 
 
+//! number of threads for column-wise (dim=0) and row-wise (dim=1) reductions of a matrix,
+//! such as sum(), mean(), var(), min(), max(), index_min() and index_max();
+//! columns are processed in parallel, while rows are split into blocks which are processed in parallel
+template<typename eT>
+struct mp_reduce
+  {
+  static const uword n_elem_min = 32768;  //!< minimum number of elements for using multiple threads
+  
+  arma_inline
+  static
+  uword
+  n_col_threads(const uword n_rows, const uword n_cols)
+    {
+    const uword n_elem = n_rows * n_cols;
+    
+    if( arma_config::openmp && (n_cols > 1) && (n_elem >= n_elem_min) && mp_gate<eT>::eval(n_elem) )
+      {
+      return (std::min)( uword(mp_thread_limit::get()), n_cols );
+      }
+    
+    return uword(1);
+    }
+  
+  arma_inline
+  static
+  uword
+  n_row_blocks(const uword n_rows, const uword n_cols)
+    {
+    const uword n_elem = n_rows * n_cols;
+    
+    if( arma_config::openmp && (n_elem >= n_elem_min) && mp_gate<eT>::eval(n_elem) )
+      {
+      // each block should span at least one cache line in each column
+      const uword n_blocks_max = n_rows / (std::max)( uword(1), uword(64 / sizeof(eT)) );
+      
+      return (std::max)( uword(1), (std::min)( uword(mp_thread_limit::get()), n_blocks_max ) );
+      }
+    
+    return uword(1);
+    }
+  };
+
+
+
 //! @}
@@ -19,6 +19,86 @@
 
 
 
+//! for fixed-size matrices, with all dimensions known at compile time;
+//! C = op(A) * op(B), where op() is either a no-op or the conjugate transpose.
+//! BLAS is faster for all but small products, so with BLAS available the kernel is only used
+//! when the product needs at most 64 real or 32 complex multiplications (eg. real matrix-vector products up to 8x8).
+//! Real square A up to 4x4 is left to gemm_emul_tinysq and gemv_emul_tinysq.
+template<typename TA, typename TB, const bool do_trans_A=false, const bool do_trans_B=false, const bool use_alpha=false>
+class gemm_emul_fixed
+  {
+  public:
+  
+  static const uword M = (do_trans_A == false) ? fixed_dims<TA>::n_rows : fixed_dims<TA>::n_cols;
+  static const uword K = (do_trans_A == false) ? fixed_dims<TA>::n_cols : fixed_dims<TA>::n_rows;
+  static const uword N = (do_trans_B == false) ? fixed_dims<TB>::n_cols : fixed_dims<TB>::n_rows;
+  
+  static const bool is_tinysq = (fixed_dims<TA>::n_rows == fixed_dims<TA>::n_cols) && (fixed_dims<TA>::n_rows <= 4) && (is_cx<typename TA::elem_type>::no);
+  
+  #if defined(ARMA_USE_BLAS)
+    static const bool use_kernel = (fixed_dims<TA>::is_small && fixed_dims<TB>::is_small) && (is_tinysq == false) && ((M*K*N) <= (is_cx<typename TA::elem_type>::yes ? 32 : 64));
+  #else
+    static const bool use_kernel = (fixed_dims<TA>::is_small && fixed_dims<TB>::is_small) && (is_tinysq == false);
+  #endif
+  
+  
+  template<typename eT>
+  arma_hot
+  inline
+  static
+  void
+  apply(eT* C, const eT* A, const eT* B, const eT alpha = eT(1))
+    {
+    arma_extra_debug_sigprint();
+    
+    // the columns of C are accumulated in a local array, so that the compiler can keep them in registers
+    
+    eT acc[(M > 0) ? M : 1];
+    
+    for(uword col=0; col < N; ++col)
+      {
+      if(do_trans_A == false)
+        {
+        for(uword row=0; row < M; ++row)  { acc[row] = eT(0); }
+        
+        for(uword k=0; k < K; ++k)
+          {
+          const eT  B_val = (do_trans_B == false) ? B[k + col*K] : access::alt_conj(B[col + k*N]);
+          const eT* A_col = &(A[k*M]);
+          
+          for(uword row=0; row < M; ++row)  { acc[row] += A_col[row] * B_val; }
+          }
+        }
+      else
+        {
+        for(uword row=0; row < M; ++row)
+          {
+          const eT* A_col = &(A[row*K]);
+          
+          eT val = eT(0);
+          
+          for(uword k=0; k < K; ++k)
+            {
+            const eT B_val = (do_trans_B == false) ? B[k + col*K] : access::alt_conj(B[col + k*N]);
+            
+            val += access::alt_conj(A_col[k]) * B_val;
+            }
+          
+          acc[row] = val;
+          }
+        }
+      
+      eT* C_col = &(C[col*M]);
+      
+      if(use_alpha)  { for(uword row=0; row < M; ++row)  { C_col[row] = alpha * acc[row]; } }
+      else           { for(uword row=0; row < M; ++row)  { C_col[row] =         acc[row]; } }
+      }
+    }
+  
+  };
+
+
+
 //! for tiny square matrices, size <= 4x4
 template<const bool do_trans_A=false, const bool use_alpha=false, const bool use_beta=false>
 class gemm_emul_tinysq
@@ -171,6 +251,266 @@ class gemm_emul_large
   
 
 
+//! blocked emulation of gemm(), in the style of Goto's algorithm:
+//! blocks of A and B are packed into contiguous buffers (applying the simple transposes during packing),
+//! and the kernel accumulates each mr x nr block of C in local storage, allowing the compiler to keep it in registers;
+//! the sizes of the blocks are chosen so that the packed block of A fits into L2 cache and each packed sliver of B fits into L1 cache.
+//! if OpenMP is enabled, blocks of rows of C are processed in parallel.
+template<const bool do_trans_A=false, const bool do_trans_B=false, const bool use_alpha=false, const bool use_beta=false>
+class gemm_emul_blocked
+  {
+  public:
+  
+  static const uword mr = 8;
+  static const uword nr = 4;
+  static const uword mc = 128;
+  static const uword kc = 256;
+  static const uword nc = 2048;
+  
+  
+  //! pack rows [i_start, i_start+i_len) and columns [p_start, p_start+p_len) of op(A) into slivers of mr rows
+  template<typename eT, typename TA>
+  arma_hot
+  inline
+  static
+  void
+  pack_A(eT* out, const TA& A, const uword i_start, const uword i_len, const uword p_start, const uword p_len)
+    {
+    const eT*   A_mem    = A.memptr();
+    const uword A_n_rows = A.n_rows;
+    
+    for(uword ii=0; ii < i_len; ii += mr)
+      {
+      const uword m_valid = (std::min)(uword(mr), i_len - ii);
+      
+      eT* out_sliver = out + ii*p_len;
+      
+      for(uword p=0; p < p_len; ++p)
+        {
+        eT* out_p = out_sliver + p*mr;
+        
+        for(uword i=0; i < m_valid; ++i)
+          {
+          const uword row = i_start + ii + i;
+          const uword col = p_start + p;
+          
+          out_p[i] = (do_trans_A) ? A_mem[col + row*A_n_rows] : A_mem[row + col*A_n_rows];
+          }
+        
+        for(uword i=m_valid; i < mr; ++i)  { out_p[i] = eT(0); }
+        }
+      }
+    }
+  
+  
+  
+  //! pack rows [p_start, p_start+p_len) and columns [j_start, j_start+j_len) of op(B) into slivers of nr columns
+  template<typename eT, typename TB>
+  arma_hot
+  inline
+  static
+  void
+  pack_B(eT* out, const TB& B, const uword p_start, const uword p_len, const uword j_start, const uword j_len)
+    {
+    const eT*   B_mem    = B.memptr();
+    const uword B_n_rows = B.n_rows;
+    
+    for(uword jj=0; jj < j_len; jj += nr)
+      {
+      const uword n_valid = (std::min)(uword(nr), j_len - jj);
+      
+      eT* out_sliver = out + jj*p_len;
+      
+      for(uword j=0; j < nr; ++j)
+        {
+        if(j < n_valid)
+          {
+          const uword col = j_start + jj + j;
+          
+          for(uword p=0; p < p_len; ++p)
+            {
+            const uword row = p_start + p;
+            
+            out_sliver[p*nr + j] = (do_trans_B) ? B_mem[col + row*B_n_rows] : B_mem[row + col*B_n_rows];
+            }
+          }
+        else
+          {
+          for(uword p=0; p < p_len; ++p)  { out_sliver[p*nr + j] = eT(0); }
+          }
+        }
+      }
+    }
+  
+  
+  
+  //! C += alpha * (packed sliver of A) * (packed sliver of B), for a block of C with at most mr rows and nr columns;
+  //! the loop over the nr=4 columns is written out, so that the accumulators can be held in (vector) registers
+  template<typename eT>
+  arma_hot
+  inline
+  static
+  void
+  kernel(eT* C_mem, const uword C_n_rows, const eT* A_sliver, const eT* B_sliver, const uword p_len, const uword m_valid, const uword n_valid, const eT alpha)
+    {
+    eT acc0[mr];
+    eT acc1[mr];
+    eT acc2[mr];
+    eT acc3[mr];
+    
+    for(uword i=0; i < mr; ++i)
+      {
+      acc0[i] = eT(0);
+      acc1[i] = eT(0);
+      acc2[i] = eT(0);
+      acc3[i] = eT(0);
+      }
+    
+    for(uword p=0; p < p_len; ++p)
+      {
+      const eT* a = A_sliver + p*mr;
+      const eT* b = B_sliver + p*nr;
+      
+      const eT b0 = b[0];
+      const eT b1 = b[1];
+      const eT b2 = b[2];
+      const eT b3 = b[3];
+      
+      for(uword i=0; i < mr; ++i)
+        {
+        const eT a_i = a[i];
+        
+        acc0[i] += a_i * b0;
+        acc1[i] += a_i * b1;
+        acc2[i] += a_i * b2;
+        acc3[i] += a_i * b3;
+        }
+      }
+    
+    const eT* acc[nr] = { acc0, acc1, acc2, acc3 };
+    
+    for(uword j=0; j < n_valid; ++j)
+      {
+            eT* C_col = C_mem + j*C_n_rows;
+      const eT* acc_j = acc[j];
+      
+      if(use_alpha)
+        {
+        for(uword i=0; i < m_valid; ++i)  { C_col[i] += alpha * acc_j[i]; }
+        }
+      else
+        {
+        for(uword i=0; i < m_valid; ++i)  { C_col[i] += acc_j[i]; }
+        }
+      }
+    }
+  
+  
+  
+  template<typename eT, typename TA, typename TB>
+  arma_hot
+  inline
+  static
+  void
+  apply
+    (
+          Mat<eT>& C,
+    const TA&      A,
+    const TB&      B,
+    const eT       alpha = eT(1),
+    const eT       beta  = eT(0)
+    )
+    {
+    arma_extra_debug_sigprint();
+    
+    const uword M = C.n_rows;
+    const uword N = C.n_cols;
+    const uword K = (do_trans_A) ? A.n_rows : A.n_cols;
+    
+    if(use_beta)
+      {
+      if(beta != eT(1))  { arrayops::inplace_mul(C.memptr(), beta, C.n_elem); }
+      }
+    else
+      {
+      C.zeros();
+      }
+    
+    if( (M == 0) || (N == 0) || (K == 0) )  { return; }
+    
+    const uword n_row_blocks = (M + mc - 1) / mc;
+    
+    uword n_threads = 1;
+    
+    #if defined(ARMA_USE_OPENMP)
+      {
+      if( (n_row_blocks > 1) && mp_gate<eT>::eval(M*N) )
+        {
+        n_threads = (std::min)( uword(mp_thread_limit::get()), n_row_blocks );
+        }
+      }
+    #endif
+    
+    const uword kc_max = (std::min)(uword(kc), K);
+    const uword nc_max = (std::min)(uword(nc), N);
+    const uword mc_max = (std::min)(uword(mc), M);
+    
+    podarray<eT> B_packed( kc_max * (((nc_max + nr - 1) / nr) * nr) );
+    podarray<eT> A_packed( n_threads * kc_max * (((mc_max + mr - 1) / mr) * mr) );
+    
+    const uword A_packed_stride = A_packed.n_elem / n_threads;
+    
+    eT* C_mem = C.memptr();
+    
+    for(uword j_start=0; j_start < N; j_start += nc)
+      {
+      const uword j_len = (std::min)(uword(nc), N - j_start);
+      
+      for(uword p_start=0; p_start < K; p_start += kc)
+        {
+        const uword p_len = (std::min)(uword(kc), K - p_start);
+        
+        gemm_emul_blocked::pack_B(B_packed.memptr(), B, p_start, p_len, j_start, j_len);
+        
+        #if defined(ARMA_USE_OPENMP)
+          #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+        #endif
+        for(uword t=0; t < n_threads; ++t)
+          {
+          eT* A_packed_t = A_packed.memptr() + t*A_packed_stride;
+          
+          for(uword row_block=t; row_block < n_row_blocks; row_block += n_threads)
+            {
+            const uword i_start = row_block * mc;
+            const uword i_len   = (std::min)(uword(mc), M - i_start);
+            
+            gemm_emul_blocked::pack_A(A_packed_t, A, i_start, i_len, p_start, p_len);
+            
+            for(uword jj=0; jj < j_len; jj += nr)
+            for(uword ii=0; ii < i_len; ii += mr)
+              {
+              gemm_emul_blocked::kernel
+                (
+                C_mem + (i_start + ii) + (j_start + jj)*M,
+                M,
+                A_packed_t + ii*p_len,
+                B_packed.memptr() + jj*p_len,
+                p_len,
+                (std::min)(uword(mr), i_len - ii),
+                (std::min)(uword(nr), j_len - jj),
+                alpha
+                );
+              }
+            }
+          }
+        }
+      }
+    }
+  
+  };
+
+
+
 template<const bool do_trans_A=false, const bool do_trans_B=false, const bool use_alpha=false, const bool use_beta=false>
 class gemm_emul
   {
@@ -195,7 +535,14 @@ class gemm_emul
     arma_extra_debug_sigprint();
     arma_ignore(junk);
     
-    gemm_emul_large<do_trans_A, do_trans_B, use_alpha, use_beta>::apply(C, A, B, alpha, beta);
+    if( gemm_emul<do_trans_A, do_trans_B, use_alpha, use_beta>::use_blocked(C, (do_trans_A) ? A.n_rows : A.n_cols) )
+      {
+      gemm_emul_blocked<do_trans_A, do_trans_B, use_alpha, use_beta>::apply(C, A, B, alpha, beta);
+      }
+    else
+      {
+      gemm_emul_large<do_trans_A, do_trans_B, use_alpha, use_beta>::apply(C, A, B, alpha, beta);
+      }
     }
   
   
@@ -229,7 +576,26 @@ class gemm_emul
     const Mat<eT>& AA = (do_trans_A == false) ? A : tmp_A;
     const Mat<eT>& BB = (do_trans_B == false) ? B : tmp_B;
     
-    gemm_emul_large<false, false, use_alpha, use_beta>::apply(C, AA, BB, alpha, beta);
+    if( gemm_emul<do_trans_A, do_trans_B, use_alpha, use_beta>::use_blocked(C, AA.n_cols) )
+      {
+      gemm_emul_blocked<false, false, use_alpha, use_beta>::apply(C, AA, BB, alpha, beta);
+      }
+    else
+      {
+      gemm_emul_large<false, false, use_alpha, use_beta>::apply(C, AA, BB, alpha, beta);
+      }
+    }
+  
+  
+  
+  //! the blocked emulation has overheads due to packing, so it is only used for reasonably large matrices
+  template<typename eT>
+  arma_inline
+  static
+  bool
+  use_blocked(const Mat<eT>& C, const uword K)
+    {
+    return ( (C.n_rows >= 16) && (C.n_cols >= 16) && (K >= 16) && ((double(C.n_rows) * double(C.n_cols) * double(K)) >= double(32768)) );
     }
 
   };
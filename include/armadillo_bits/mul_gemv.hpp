@@ -143,6 +143,9 @@ class gemv_emul_helper
   {
   public:
   
+  static const uword block_size    = 256;    //!< number of rows processed by block_times_vec()
+  static const uword mp_n_elem_min = 32768;  //!< minimum number of elements in A for using multiple threads
+  
   template<typename eT, typename TA>
   arma_hot
   inline
@@ -203,19 +206,113 @@ class gemv_emul_helper
     return std::complex<T>(val_real, val_imag);
     }
   
+  
+  
+  //! acc = A(rows,:) * x, for a block of n_rows rows starting at row_start (n_rows <= gemv_emul_helper::block_size);
+  //! A is traversed column by column, which is friendlier to caches than taking dot products of rows
+  template<typename eT, typename TA>
+  arma_hot
+  inline
+  static
+  void
+  block_times_vec( eT* acc, const TA& A, const eT* x, const uword row_start, const uword n_rows, const typename arma_not_cx<eT>::result* junk = 0 )
+    {
+    arma_ignore(junk);
+    
+    for(uword i=0; i < n_rows; ++i)  { acc[i] = eT(0); }
+    
+    const uword A_n_cols = A.n_cols;
+    
+    for(uword col=0; col < A_n_cols; ++col)
+      {
+      const eT* A_col = A.colptr(col) + row_start;
+      const eT  x_val = x[col];
+      
+      for(uword i=0; i < n_rows; ++i)  { acc[i] += A_col[i] * x_val; }
+      }
+    }
+  
+  
+  
+  template<typename eT, typename TA>
+  arma_hot
+  inline
+  static
+  void
+  block_times_vec( eT* acc, const TA& A, const eT* x, const uword row_start, const uword n_rows, const typename arma_cx_only<eT>::result* junk = 0 )
+    {
+    arma_ignore(junk);
+    
+    typedef typename get_pod_type<eT>::result T;
+    
+    T acc_real[block_size];
+    T acc_imag[block_size];
+    
+    for(uword i=0; i < n_rows; ++i)  { acc_real[i] = T(0); acc_imag[i] = T(0); }
+    
+    const uword A_n_cols = A.n_cols;
+    
+    for(uword col=0; col < A_n_cols; ++col)
+      {
+      const eT* A_col = A.colptr(col) + row_start;
+      
+      const T c = x[col].real();
+      const T d = x[col].imag();
+      
+      for(uword i=0; i < n_rows; ++i)
+        {
+        const T a = A_col[i].real();
+        const T b = A_col[i].imag();
+        
+        acc_real[i] += (a*c) - (b*d);
+        acc_imag[i] += (a*d) + (b*c);
+        }
+      }
+    
+    for(uword i=0; i < n_rows; ++i)  { acc[i] = std::complex<T>(acc_real[i], acc_imag[i]); }
+    }
+  
+  
+  
+  //! gemv() is limited by memory bandwidth, so multiple threads are only worthwhile for reasonably large matrices
+  template<typename eT>
+  arma_inline
+  static
+  bool
+  use_mp(const uword A_n_elem, const uword n_tasks)
+    {
+    return ( arma_config::openmp && (n_tasks > 1) && (A_n_elem >= mp_n_elem_min) && mp_gate<eT>::eval(A_n_elem) );
+    }
+  
   };
 
 
 
 //! \brief
 //! Partial emulation of ATLAS/BLAS gemv().
-//! 'y' is assumed to have been set to the correct size (i.e. taking into account the transpose)
+//! 'y' is assumed to have been set to the correct size (i.e. taking into account the transpose).
+//! If OpenMP is enabled and A is large enough, blocks of rows (or columns for the transpose) are processed in parallel.
 
 template<const bool do_trans_A=false, const bool use_alpha=false, const bool use_beta=false>
 class gemv_emul
   {
   public:
   
+  template<typename eT>
+  arma_hot
+  arma_inline
+  static
+  void
+  assign(eT& y_i, const eT acc, const eT alpha, const eT beta)
+    {
+         if( (use_alpha == false) && (use_beta == false) )  { y_i =       acc;            }
+    else if( (use_alpha == true ) && (use_beta == false) )  { y_i = alpha*acc;            }
+    else if( (use_alpha == false) && (use_beta == true ) )  { y_i =       acc + beta*y_i; }
+    else if( (use_alpha == true ) && (use_beta == true ) )  { y_i = alpha*acc + beta*y_i; }
+    }
+  
+  
+  
   template<typename eT, typename TA>
   arma_hot
   inline
@@ -234,20 +331,34 @@ class gemv_emul
         {
         const eT acc = op_dot::direct_dot_arma(A_n_cols, A.memptr(), x);
         
-             if( (use_alpha == false) && (use_beta == false) )  { y[0] =       acc;             }
-        else if( (use_alpha == true ) && (use_beta == false) )  { y[0] = alpha*acc;             }
-        else if( (use_alpha == false) && (use_beta == true ) )  { y[0] =       acc + beta*y[0]; }
-        else if( (use_alpha == true ) && (use_beta == true ) )  { y[0] = alpha*acc + beta*y[0]; }
+        gemv_emul::assign(y[0], acc, alpha, beta);
         }
       else
-      for(uword row=0; row < A_n_rows; ++row)
         {
-        const eT acc = gemv_emul_helper::dot_row_col(A, x, row, A_n_cols);
+        // blocks of rows of A are processed in parallel
+        
+        const uword block_size = gemv_emul_helper::block_size;
+        const uword n_blocks   = (A_n_rows + block_size - 1) / block_size;
         
-             if( (use_alpha == false) && (use_beta == false) )  { y[row] =       acc;               }
-        else if( (use_alpha == true ) && (use_beta == false) )  { y[row] = alpha*acc;               }
-        else if( (use_alpha == false) && (use_beta == true ) )  { y[row] =       acc + beta*y[row]; }
-        else if( (use_alpha == true ) && (use_beta == true ) )  { y[row] = alpha*acc + beta*y[row]; }
+        const bool use_mp    = gemv_emul_helper::use_mp<eT>(A.n_elem, n_blocks);
+        const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+        
+        arma_ignore(n_threads);
+        
+        #if defined(ARMA_USE_OPENMP)
+          #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+        #endif
+        for(uword block=0; block < n_blocks; ++block)
+          {
+          const uword row_start = block * block_size;
+          const uword n_rows    = (std::min)(block_size, A_n_rows - row_start);
+          
+          eT acc[gemv_emul_helper::block_size];
+          
+          gemv_emul_helper::block_times_vec(acc, A, x, row_start, n_rows);
+          
+          for(uword i=0; i < n_rows; ++i)  { gemv_emul::assign(y[row_start + i], acc[i], alpha, beta); }
+          }
         }
       }
     else
@@ -255,25 +366,21 @@ class gemv_emul
       {
       if(is_cx<eT>::no)
         {
+        // col is interpreted as row when storing the results in 'y'
+        
+        const bool use_mp    = gemv_emul_helper::use_mp<eT>(A.n_elem, A_n_cols);
+        const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+        
+        arma_ignore(n_threads);
+        
+        #if defined(ARMA_USE_OPENMP)
+          #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+        #endif
         for(uword col=0; col < A_n_cols; ++col)
           {
-          // col is interpreted as row when storing the results in 'y'
-          
-          
-          // const eT* A_coldata = A.colptr(col);
-          // 
-          // eT acc = eT(0);
-          // for(uword row=0; row < A_n_rows; ++row)
-          //   {
-          //   acc += A_coldata[row] * x[row];
-          //   }
-          
           const eT acc = op_dot::direct_dot_arma(A_n_rows, A.colptr(col), x);
           
-               if( (use_alpha == false) && (use_beta == false) )  { y[col] =       acc;               }
-          else if( (use_alpha == true ) && (use_beta == false) )  { y[col] = alpha*acc;               }
-          else if( (use_alpha == false) && (use_beta == true ) )  { y[col] =       acc + beta*y[col]; }
-          else if( (use_alpha == true ) && (use_beta == true ) )  { y[col] = alpha*acc + beta*y[col]; }
+          gemv_emul::assign(y[col], acc, alpha, beta);
           }
         }
       else
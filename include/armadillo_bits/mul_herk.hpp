@@ -222,6 +222,8 @@ class herk_vec
 
 
 
+//! partial emulation of BLAS function herk();
+//! if OpenMP is enabled, the columns of large matrices are processed in parallel
 template<const bool do_trans_A=false, const bool use_alpha=false, const bool use_beta=false>
 class herk_emul
   {
@@ -261,6 +263,17 @@ class herk_emul
       const uword A_n_rows = A.n_rows;
       const uword A_n_cols = A.n_cols;
       
+      // for large matrices, the columns of A are processed in parallel;
+      // the work per column decreases along the columns, hence the dynamic schedule
+      
+      const bool use_mp    = gemm_emul<true, false, use_alpha, use_beta>::use_blocked(C, A_n_rows) && mp_gate<eT>::eval(C.n_elem);
+      const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+      
+      arma_ignore(n_threads);
+      
+      #if defined(ARMA_USE_OPENMP)
+        #pragma omp parallel for schedule(dynamic) num_threads(n_threads) if(use_mp)
+      #endif
       for(uword col_A=0; col_A < A_n_cols; ++col_A)
         {
         // col_A is interpreted as row_A when storing the results in matrix C
@@ -185,7 +185,8 @@ class syrk_vec
 
 
 
-//! partial emulation of BLAS function syrk()
+//! partial emulation of BLAS function syrk();
+//! large matrices are handled by the blocked emulation of gemm(), which can use multiple threads
 template<const bool do_trans_A=false, const bool use_alpha=false, const bool use_beta=false>
 class syrk_emul
   {
@@ -223,6 +224,17 @@ class syrk_emul
       const uword A_n_rows = A.n_rows;
       const uword A_n_cols = A.n_cols;
       
+      if( gemm_emul<true, false, use_alpha, use_beta>::use_blocked(C, A_n_rows) )
+        {
+        // for large matrices, the blocked (and possibly multi-threaded) emulation of gemm() is considerably faster
+        // than taking dot products of columns, despite computing both triangles of C;
+        // the result is still exactly symmetric, as both elements of each pair are accumulated in the same order
+        
+        gemm_emul_blocked<true, false, use_alpha, use_beta>::apply(C, A, A, alpha, beta);
+        
+        return;
+        }
+      
       for(uword col_A=0; col_A < A_n_cols; ++col_A)
         {
         // col_A is interpreted as row_A when storing the results in matrix C
@@ -231,7 +243,9 @@ class syrk_emul
         
         for(uword k=col_A; k < A_n_cols; ++k)
           {
-          const eT acc = op_dot::direct_dot_arma(A_n_rows, A_coldata, A.colptr(k));
+          // tall and narrow A: each dot product can be split across threads
+          
+          const eT acc = op_dot::direct_dot_mp(A_n_rows, A_coldata, A.colptr(k));
           
           if( (use_alpha == false) && (use_beta == false) )
             {
@@ -14,7 +14,6 @@
 // ------------------------------------------------------------------------
 
 
-
 //! \addtogroup op_any
 //! @{
 
@@ -45,8 +44,7 @@ class op_any
   any_vec_helper
     (
     const mtOp<uword, T1, op_type>& X,
-    const typename arma_op_rel_only<op_type>::result           junk1 = 0,
-    const typename arma_not_cx<typename T1::elem_type>::result junk2 = 0
+    const typename arma_op_rel_only<op_type>::result junk = 0
     );
   
   
@@ -55,9 +53,7 @@ class op_any
   any_vec_helper
     (
     const mtGlue<uword, T1, T2, glue_type>& X,
-    const typename arma_glue_rel_only<glue_type>::result       junk1 = 0,
-    const typename arma_not_cx<typename T1::elem_type>::result junk2 = 0,
-    const typename arma_not_cx<typename T2::elem_type>::result junk3 = 0
+    const typename arma_glue_rel_only<glue_type>::result junk = 0
     );
   
   
@@ -66,7 +62,33 @@ class op_any
   
   
   template<typename T1>
-  static inline void apply_helper(Mat<uword>& out, const Proxy<T1>& P, const uword dim);
+  static inline void apply_helper(Mat<uword>& out, const Base<typename T1::elem_type, T1>& X, const uword dim);
+  
+  
+  template<typename T1, typename op_type>
+  static inline void
+  apply_helper
+    (
+    Mat<uword>& out,
+    const mtOp<uword, T1, op_type>& X,
+    const uword dim,
+    const typename arma_op_rel_only<op_type>::result junk = 0
+    );
+  
+  
+  template<typename T1, typename T2, typename glue_type>
+  static inline void
+  apply_helper
+    (
+    Mat<uword>& out,
+    const mtGlue<uword, T1, T2, glue_type>& X,
+    const uword dim,
+    const typename arma_glue_rel_only<glue_type>::result junk = 0
+    );
+  
+  
+  template<typename mask_type>
+  static inline void apply_mask(Mat<uword>& out, const mask_type& F, const uword dim);
   
   
   template<typename T1>
@@ -14,7 +14,6 @@
 // ------------------------------------------------------------------------
 
 
-
 //! \addtogroup op_any
 //! @{
 
@@ -27,34 +26,9 @@ op_any::any_vec_helper(const Base<typename T1::elem_type, T1>& X)
   {
   arma_extra_debug_sigprint();
   
-  typedef typename T1::elem_type eT;
-  
-  const Proxy<T1> P(X.get_ref());
-  
-  const uword n_elem = P.get_n_elem();
-  
-  if(Proxy<T1>::use_at == false)
-    {
-    typename Proxy<T1>::ea_type Pea = P.get_ea();
-    
-    for(uword i=0; i<n_elem; ++i)
-      {
-      if(Pea[i] != eT(0))  { return true; }
-      }
-    }
-  else
-    {
-    const uword n_rows = P.get_n_rows();
-    const uword n_cols = P.get_n_cols();
-    
-    for(uword col=0; col < n_cols; ++col)
-    for(uword row=0; row < n_rows; ++row)
-      {
-      if(P.at(row,col) != eT(0))  { return true; }
-      }
-    }
+  const rel_mask_nonzero<T1> F(X.get_ref());
   
-  return false;
+  return rel_mask::any(F);
   }
 
 
@@ -80,12 +54,9 @@ op_any::any_vec_helper(const subview<eT>& X)
     {
     for(uword col=0; col < X_n_cols; ++col)
       {
-      const eT* X_colmem = X.colptr(col);
+      const Col<eT> X_col(const_cast<eT*>(X.colptr(col)), X_n_rows, false, true);
       
-      for(uword row=0; row < X_n_rows; ++row)
-        {
-        if(X_colmem[row] != eT(0))  { return true; }
-        }
+      if(rel_mask::any( rel_mask_nonzero< Col<eT> >(X_col) ))  { return true; }
       }
     }
   
@@ -106,73 +77,23 @@ op_any::any_vec_helper(const Op<T1, op_vectorise_col>& X)
 
 
 
+//! the relational expression is evaluated lazily, stopping at the first block of elements which determines the result
+
 template<typename T1, typename op_type>
 inline
 bool
 op_any::any_vec_helper
   (
   const mtOp<uword, T1, op_type>& X,
-  const typename arma_op_rel_only<op_type>::result           junk1,
-  const typename arma_not_cx<typename T1::elem_type>::result junk2
+  const typename arma_op_rel_only<op_type>::result junk
   )
   {
   arma_extra_debug_sigprint();
-  arma_ignore(junk1);
-  arma_ignore(junk2);
-  
-  typedef typename T1::elem_type eT;
-  
-  const eT val = X.aux;
-  
-  const Proxy<T1> P(X.m);
-  
+  arma_ignore(junk);
   
-  if(Proxy<T1>::use_at == false)
-    {
-    typename Proxy<T1>::ea_type Pea = P.get_ea();
-    
-    const uword n_elem = P.get_n_elem();
-  
-    for(uword i=0; i < n_elem; ++i)
-      {
-      const eT tmp = Pea[i];
-      
-           if(is_same_type<op_type, op_rel_lt_pre   >::yes)  { if(val <  tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_lt_post  >::yes)  { if(tmp <  val) { return true; } }
-      else if(is_same_type<op_type, op_rel_gt_pre   >::yes)  { if(val >  tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_gt_post  >::yes)  { if(tmp >  val) { return true; } }
-      else if(is_same_type<op_type, op_rel_lteq_pre >::yes)  { if(val <= tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_lteq_post>::yes)  { if(tmp <= val) { return true; } }
-      else if(is_same_type<op_type, op_rel_gteq_pre >::yes)  { if(val >= tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_gteq_post>::yes)  { if(tmp >= val) { return true; } }
-      else if(is_same_type<op_type, op_rel_eq       >::yes)  { if(tmp == val) { return true; } }
-      else if(is_same_type<op_type, op_rel_noteq    >::yes)  { if(tmp != val) { return true; } }
-      }
-    }
-  else
-    {
-    const uword n_rows = P.get_n_rows();
-    const uword n_cols = P.get_n_cols();
-    
-    for(uword col=0; col < n_cols; ++col)
-    for(uword row=0; row < n_rows; ++row)
-      {
-      const eT tmp = P.at(row,col);
-      
-           if(is_same_type<op_type, op_rel_lt_pre   >::yes)  { if(val <  tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_lt_post  >::yes)  { if(tmp <  val) { return true; } }
-      else if(is_same_type<op_type, op_rel_gt_pre   >::yes)  { if(val >  tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_gt_post  >::yes)  { if(tmp >  val) { return true; } }
-      else if(is_same_type<op_type, op_rel_lteq_pre >::yes)  { if(val <= tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_lteq_post>::yes)  { if(tmp <= val) { return true; } }
-      else if(is_same_type<op_type, op_rel_gteq_pre >::yes)  { if(val >= tmp) { return true; } }
-      else if(is_same_type<op_type, op_rel_gteq_post>::yes)  { if(tmp >= val) { return true; } }
-      else if(is_same_type<op_type, op_rel_eq       >::yes)  { if(tmp == val) { return true; } }
-      else if(is_same_type<op_type, op_rel_noteq    >::yes)  { if(tmp != val) { return true; } }
-      }
-    }
+  const rel_mask_op<T1, op_type> F(X);
   
-  return false;
+  return rel_mask::any(F);
   }
 
 
@@ -183,74 +104,15 @@ bool
 op_any::any_vec_helper
   (
   const mtGlue<uword, T1, T2, glue_type>& X,
-  const typename arma_glue_rel_only<glue_type>::result       junk1,
-  const typename arma_not_cx<typename T1::elem_type>::result junk2,
-  const typename arma_not_cx<typename T2::elem_type>::result junk3
+  const typename arma_glue_rel_only<glue_type>::result junk
   )
   {
   arma_extra_debug_sigprint();
-  arma_ignore(junk1);
-  arma_ignore(junk2);
-  arma_ignore(junk3);
+  arma_ignore(junk);
   
-  typedef typename T1::elem_type eT1;
-  typedef typename T2::elem_type eT2;
-  
-  typedef typename Proxy<T1>::ea_type ea_type1;
-  typedef typename Proxy<T2>::ea_type ea_type2;
-  
-  const Proxy<T1> A(X.A);
-  const Proxy<T2> B(X.B);
-  
-  arma_debug_assert_same_size(A, B, "relational operator");
-  
-  const bool use_at = (Proxy<T1>::use_at || Proxy<T2>::use_at);
-  
-  if(use_at == false)
-    {
-    ea_type1 PA = A.get_ea();
-    ea_type2 PB = B.get_ea();
-    
-    const uword n_elem = A.get_n_elem();
-    
-    for(uword i=0; i<n_elem; ++i)
-      {
-      const eT1 tmp1 = PA[i];
-      const eT2 tmp2 = PB[i];
-      
-           if(is_same_type<glue_type, glue_rel_lt    >::yes)  { if(tmp1 <  tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_gt    >::yes)  { if(tmp1 >  tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_lteq  >::yes)  { if(tmp1 <= tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_gteq  >::yes)  { if(tmp1 >= tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_eq    >::yes)  { if(tmp1 == tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_noteq >::yes)  { if(tmp1 != tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_and   >::yes)  { if(tmp1 && tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_or    >::yes)  { if(tmp1 || tmp2) { return true; } }
-      }
-    }
-  else
-    {
-    const uword n_rows = A.get_n_rows();
-    const uword n_cols = A.get_n_cols();
-    
-    for(uword col=0; col < n_cols; ++col)
-    for(uword row=0; row < n_rows; ++row)
-      {
-      const eT1 tmp1 = A.at(row,col);
-      const eT2 tmp2 = B.at(row,col);
-      
-           if(is_same_type<glue_type, glue_rel_lt    >::yes)  { if(tmp1 <  tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_gt    >::yes)  { if(tmp1 >  tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_lteq  >::yes)  { if(tmp1 <= tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_gteq  >::yes)  { if(tmp1 >= tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_eq    >::yes)  { if(tmp1 == tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_noteq >::yes)  { if(tmp1 != tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_and   >::yes)  { if(tmp1 && tmp2) { return true; } }
-      else if(is_same_type<glue_type, glue_rel_or    >::yes)  { if(tmp1 || tmp2) { return true; } }
-      }
-    }
+  const rel_mask_glue<T1, T2, glue_type> F(X);
   
-  return false;
+  return rel_mask::any(F);
   }
 
 
@@ -270,77 +132,117 @@ op_any::any_vec(T1& X)
 template<typename T1>
 inline
 void
-op_any::apply_helper(Mat<uword>& out, const Proxy<T1>& P, const uword dim)
+op_any::apply_helper(Mat<uword>& out, const Base<typename T1::elem_type, T1>& X, const uword dim)
   {
   arma_extra_debug_sigprint();
   
-  const uword n_rows = P.get_n_rows();
-  const uword n_cols = P.get_n_cols();
+  const rel_mask_nonzero<T1> F(X.get_ref());
   
-  typedef typename Proxy<T1>::elem_type eT;
+  op_any::apply_mask(out, F, dim);
+  }
+
+
+
+template<typename T1, typename op_type>
+inline
+void
+op_any::apply_helper
+  (
+  Mat<uword>& out,
+  const mtOp<uword, T1, op_type>& X,
+  const uword dim,
+  const typename arma_op_rel_only<op_type>::result junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const rel_mask_op<T1, op_type> F(X);
+  
+  op_any::apply_mask(out, F, dim);
+  }
+
+
+
+template<typename T1, typename T2, typename glue_type>
+inline
+void
+op_any::apply_helper
+  (
+  Mat<uword>& out,
+  const mtGlue<uword, T1, T2, glue_type>& X,
+  const uword dim,
+  const typename arma_glue_rel_only<glue_type>::result junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const rel_mask_glue<T1, T2, glue_type> F(X);
+  
+  op_any::apply_mask(out, F, dim);
+  }
+
+
+
+template<typename mask_type>
+inline
+void
+op_any::apply_mask(Mat<uword>& out, const mask_type& F, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_rows = F.get_n_rows();
+  const uword n_cols = F.get_n_cols();
+  
+  const bool is_alias = F.is_alias(out);
+  
+  Mat<uword>  tmp;
+  Mat<uword>& dest = (is_alias) ? tmp : out;
   
   if(dim == 0)  // traverse rows (ie. process each column)
     {
-    out.zeros(1, n_cols);
+    dest.zeros(1, n_cols);
     
-    uword* out_mem = out.memptr();
+    uword* out_mem = dest.memptr();
     
-    if(is_Mat<typename Proxy<T1>::stored_type>::value)
+    for(uword col=0; col < n_cols; ++col)
       {
-      const unwrap<typename Proxy<T1>::stored_type> U(P.Q);
-      
-      for(uword col=0; col < n_cols; ++col)
+      if(mask_type::use_at == false)
         {
-        const eT* colmem = U.M.colptr(col);
-        
-        for(uword row=0; row < n_rows; ++row)
-          {
-          if(colmem[row] != eT(0))  { out_mem[col] = uword(1); break; }
-          }
+        out_mem[col] = rel_mask::any_range(F, col*n_rows, n_rows) ? uword(1) : uword(0);
         }
-      }
-    else
-      {
-      for(uword col=0; col < n_cols; ++col)
+      else
         {
         for(uword row=0; row < n_rows; ++row)
           {
-          if(P.at(row,col) != eT(0))  { out_mem[col] = uword(1); break; }
+          if(F.at(row,col))  { out_mem[col] = uword(1); break; }
           }
         }
       }
     }
   else
     {
-    out.zeros(n_rows, 1);
+    dest.zeros(n_rows, 1);
     
-    uword* out_mem = out.memptr();
+    uword* out_mem = dest.memptr();
     
-    if(is_Mat<typename Proxy<T1>::stored_type>::value)
+    for(uword col=0; col < n_cols; ++col)
       {
-      const unwrap<typename Proxy<T1>::stored_type> U(P.Q);
-      
-      for(uword col=0; col < n_cols; ++col)
+      if(mask_type::use_at == false)
         {
-        const eT* colmem = U.M.colptr(col);
+        const uword offset = col*n_rows;
         
-        for(uword row=0; row < n_rows; ++row)
-          {
-          if(colmem[row] != eT(0))  { out_mem[row] = uword(1); }
-          }
+        for(uword row=0; row < n_rows; ++row)  { out_mem[row] |= F[offset + row] ? uword(1) : uword(0); }
         }
-      }
-    else
-      {
-      for(uword col=0; col < n_cols; ++col)
+      else
         {
-        for(uword row=0; row < n_rows; ++row)
-          {
-          if(P.at(row,col) != eT(0))  { out_mem[row] = uword(1); }
-          }
+        for(uword row=0; row < n_rows; ++row)  { out_mem[row] |= F.at(row,col) ? uword(1) : uword(0); }
         }
       }
     }
+  
+  if(is_alias)  { out.steal_mem(tmp); }
   }
 
 
@@ -354,20 +256,7 @@ op_any::apply(Mat<uword>& out, const mtOp<uword, T1, op_any>& X)
   
   const uword dim = X.aux_uword_a;
   
-  const Proxy<T1> P(X.m);
-  
-  if(P.is_alias(out) == false)
-    {
-    op_any::apply_helper(out, P, dim);
-    }
-  else
-    {
-    Mat<uword> out2;
-    
-    op_any::apply_helper(out2, P, dim);
-    
-    out.steal_mem(out2);
-    }
+  op_any::apply_helper(out, X.m, dim);
   }
 
 
@@ -57,8 +57,6 @@ op_chi2rnd::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
     {
     typedef typename T1::elem_type eT;
     
-    op_chi2rnd_varying_df<eT> generator;
-    
     const uword n_rows = P.get_n_rows();
     const uword n_cols = P.get_n_cols();
     
@@ -66,6 +64,9 @@ op_chi2rnd::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
     
     eT* out_mem = out.memptr();
     
+    // chi-squared with df degrees of freedom is gamma with shape df/2 and scale 2;
+    // the shapes are stored in the output and replaced by the generated values
+    
     if(Proxy<T1>::use_at == false)
       {
       const uword N = P.get_n_elem();
@@ -74,7 +75,7 @@ op_chi2rnd::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
       
       for(uword i=0; i<N; ++i)
         {
-        out_mem[i] = generator( Pea[i] );
+        out_mem[i] = Pea[i] / eT(2);
         }
       }
     else
@@ -82,9 +83,11 @@ op_chi2rnd::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
       for(uword col=0; col < n_cols; ++col)
       for(uword row=0; row < n_rows; ++row)
         {
-        (*out_mem) = generator( P.at(row,col) );  ++out_mem;
+        (*out_mem) = P.at(row,col) / eT(2);  ++out_mem;
         }
       }
+    
+    arma_rng::randg<eT>::fill_varying(out.memptr(), out.memptr(), out.n_elem, double(2));
     }
   #else
     {
@@ -108,21 +111,7 @@ op_chi2rnd::fill_constant_df(Mat<eT>& out, const eT df)
     {
     if(df > eT(0))
       {
-      typedef std::mt19937_64                   motor_type;
-      typedef std::mt19937_64::result_type      seed_type;
-      typedef std::chi_squared_distribution<eT> distr_type;
-      
-      motor_type motor;  motor.seed( seed_type(arma_rng::randi<int>()) );
-      distr_type distr(df);
-      
-      const uword N = out.n_elem;
-      
-      eT* out_mem = out.memptr();
-      
-      for(uword i=0; i<N; ++i)
-        {
-        out_mem[i] = eT( distr(motor) );
-        }
+      arma_rng::randg<eT>::fill(out.memptr(), out.n_elem, double(df) / double(2), double(2));
       }
     else
       {
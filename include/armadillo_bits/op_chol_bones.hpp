@@ -28,6 +28,9 @@ class op_chol
   
   template<typename T1>
   inline static bool apply_direct(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_type,T1>& A_expr, const uword layout);
+  
+  template<typename T1>
+  inline static bool apply_fixed(Mat<typename T1::elem_type>& out, const T1& A, const uword layout);
   };
 
 
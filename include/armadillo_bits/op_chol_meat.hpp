@@ -26,7 +26,9 @@ op_chol::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_chol>& X)
   {
   arma_extra_debug_sigprint();
   
-  const bool status = op_chol::apply_direct(out, X.m, X.aux_uword_a);
+  const bool use_fixed = (fixed_dims<T1>::is_small_sq) && (fixed_dims<T1>::n_rows <= batch_linalg::tiny_max);
+  
+  const bool status = (use_fixed) ? op_chol::apply_fixed(out, X.m, X.aux_uword_a) : op_chol::apply_direct(out, X.m, X.aux_uword_a);
   
   if(status == false)
     {
@@ -61,4 +63,23 @@ op_chol::apply_direct(Mat<typename T1::elem_type>& out, const Base<typename T1::
 
 
 
+//! for fixed-size matrices (up to tiny_max x tiny_max), via a kernel with the size known at compile time
+template<typename T1>
+inline
+bool
+op_chol::apply_fixed(Mat<typename T1::elem_type>& out, const T1& A, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(A);
+  
+  out.set_size(fixed_dims<T1>::n_rows, fixed_dims<T1>::n_cols);
+  
+  return batch_linalg::chol_tiny<eT, fixed_dims<T1>::small_sq_N>(out.memptr(), U.M.memptr(), layout);
+  }
+
+
+
 //! @}
@@ -26,81 +26,16 @@ op_cumprod::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim)
   {
   arma_extra_debug_sigprint();
   
-  uword n_rows = X.n_rows;
-  uword n_cols = X.n_cols;
-  
-  out.set_size(n_rows,n_cols);
+  out.set_size(X.n_rows, X.n_cols);
   
   if(dim == 0)
     {
-    if(n_cols == 1)
-      {
-      const eT*   X_mem =   X.memptr();
-            eT* out_mem = out.memptr();
-      
-      eT acc = eT(1);
-      
-      for(uword row=0; row < n_rows; ++row)
-        {
-        acc *= X_mem[row];
-        
-        out_mem[row] = acc;
-        }
-      }
-    else
-      {
-      for(uword col=0; col < n_cols; ++col)
-        {
-        const eT*   X_colmem =   X.colptr(col);
-              eT* out_colmem = out.colptr(col);
-        
-        eT acc = eT(1);
-        
-        for(uword row=0; row < n_rows; ++row)
-          {
-          acc *= X_colmem[row];
-          
-          out_colmem[row] = acc;
-          }
-        }
-      }
+    scan_engine::scan_cols<scan_engine_times>(out, X);
     }
   else
   if(dim == 1)
     {
-    if(n_rows == 1)
-      {
-      const eT*   X_mem =   X.memptr();
-            eT* out_mem = out.memptr();
-      
-      eT acc = eT(1);
-      
-      for(uword col=0; col < n_cols; ++col)
-        {
-        acc *= X_mem[col];
-        
-        out_mem[col] = acc;
-        }
-      }
-    else
-      {
-      if(n_cols > 0)
-        {
-        arrayops::copy( out.colptr(0), X.colptr(0), n_rows );
-        
-        for(uword col=1; col < n_cols; ++col)
-          {
-          const eT* out_colmem_prev = out.colptr(col-1);
-                eT* out_colmem      = out.colptr(col  );
-          const eT*   X_colmem      =   X.colptr(col  );
-          
-          for(uword row=0; row < n_rows; ++row)
-            {
-            out_colmem[row] = out_colmem_prev[row] * X_colmem[row];
-            }
-          }
-        }
-      }
+    scan_engine::scan_rows<scan_engine_times>(out, X);
     }
   }
 
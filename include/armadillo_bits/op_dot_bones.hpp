@@ -34,6 +34,11 @@ class op_dot
   typename arma_cx_only<eT>::result
   direct_dot_arma(const uword n_elem, const eT* const A, const eT* const B);
   
+  static const uword mp_n_elem_min = 65536;  //!< minimum length for using multiple threads in direct_dot_mp()
+  
+  template<typename eT>
+  arma_hot inline static eT direct_dot_mp(const uword n_elem, const eT* const A, const eT* const B);
+  
   template<typename eT>
   arma_hot inline static typename arma_real_only<eT>::result
   direct_dot(const uword n_elem, const eT* const A, const eT* const B);
@@ -98,6 +98,54 @@ op_dot::direct_dot_arma(const uword n_elem, const eT* const A, const eT* const B
 
 
 
+//! for two arrays, splitting long arrays into chunks which are processed in parallel (if OpenMP is enabled);
+//! used when dot products are not computed by BLAS
+template<typename eT>
+arma_hot
+inline
+eT
+op_dot::direct_dot_mp(const uword n_elem, const eT* const A, const eT* const B)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = ( (n_elem >= op_dot::mp_n_elem_min) && mp_gate<eT>::eval(n_elem) ) ? mp_thread_limit::get() : int(1);
+    
+    if(n_threads > 1)
+      {
+      const uword n_chunks  = uword(n_threads);
+      const uword chunk_len = n_elem / n_chunks;
+      
+      podarray<eT> partial(n_chunks);
+      
+      eT* partial_mem = partial.memptr();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword start = chunk * chunk_len;
+        const uword len   = (chunk == (n_chunks-1)) ? (n_elem - start) : chunk_len;
+        
+        partial_mem[chunk] = op_dot::direct_dot_arma(len, &(A[start]), &(B[start]));
+        }
+      
+      // the partial sums are added in a fixed order, so that the result does not depend on the scheduling
+      
+      eT val = eT(0);
+      
+      for(uword chunk=0; chunk < n_chunks; ++chunk)  { val += partial_mem[chunk]; }
+      
+      return val;
+      }
+    }
+  #endif
+  
+  return op_dot::direct_dot_arma(n_elem, A, B);
+  }
+
+
+
 //! for two arrays, float and double version
 template<typename eT>
 arma_hot
@@ -107,6 +155,8 @@ op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
   {
   arma_extra_debug_sigprint();
   
+  if(arma_config::compensated_sum)  { return sum_engine::dot(n_elem, A, B); }
+  
   if( n_elem <= 32u )
     {
     return op_dot::direct_dot_arma(n_elem, A, B);
@@ -127,7 +177,7 @@ op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
       }
     #else
       {
-      return op_dot::direct_dot_arma(n_elem, A, B);
+      return op_dot::direct_dot_mp(n_elem, A, B);
       }
     #endif
     }
@@ -142,6 +192,10 @@ arma_hot
 typename arma_cx_only<eT>::result
 op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
   {
+  arma_extra_debug_sigprint();
+  
+  if(arma_config::compensated_sum)  { return sum_engine::dot(n_elem, A, B); }
+  
   if( n_elem <= 16u )
     {
     return op_dot::direct_dot_arma(n_elem, A, B);
@@ -162,7 +216,7 @@ op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
       }
     #else
       {
-      return op_dot::direct_dot_arma(n_elem, A, B);
+      return op_dot::direct_dot_mp(n_elem, A, B);
       }
     #endif
     }
@@ -177,7 +231,7 @@ inline
 typename arma_integral_only<eT>::result
 op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
   {
-  return op_dot::direct_dot_arma(n_elem, A, B);
+  return op_dot::direct_dot_mp(n_elem, A, B);
   }
 
 
@@ -281,6 +335,11 @@ op_dot::apply_proxy(const Proxy<T1>& PA, const Proxy<T2>& PB)
   ea_type1 A = PA.get_ea();
   ea_type2 B = PB.get_ea();
   
+  if(arma_config::compensated_sum)
+    {
+    return sum_engine::accumulate<eT>( sum_engine_prod<eT, ea_type1, ea_type2>(A, B), N, (Proxy<T1>::use_mp && Proxy<T2>::use_mp) );
+    }
+  
   eT val1 = eT(0);
   eT val2 = eT(0);
   
@@ -321,6 +380,11 @@ op_dot::apply_proxy(const Proxy<T1>& PA, const Proxy<T2>& PB)
   ea_type1 A = PA.get_ea();
   ea_type2 B = PB.get_ea();
   
+  if(arma_config::compensated_sum)
+    {
+    return sum_engine::accumulate<eT>( sum_engine_prod<eT, ea_type1, ea_type2>(A, B), N, (Proxy<T1>::use_mp && Proxy<T2>::use_mp) );
+    }
+  
   T val_real = T(0);
   T val_imag = T(0);
   
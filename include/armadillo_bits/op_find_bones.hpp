@@ -29,7 +29,9 @@ class op_find
   helper
     (
     Mat<uword>& indices,
-    const Base<typename T1::elem_type, T1>& X
+    const Base<typename T1::elem_type, T1>& X,
+    const uword k    = 0,
+    const uword type = 0
     );
   
   template<typename T1, typename op_type>
@@ -38,18 +40,9 @@ class op_find
     (
     Mat<uword>& indices,
     const mtOp<uword, T1, op_type>& X,
-    const typename arma_op_rel_only<op_type>::result junk1 = 0,
-    const typename arma_not_cx<typename T1::elem_type>::result junk2 = 0
-    );
-  
-  template<typename T1, typename op_type>
-  inline static uword
-  helper
-    (
-    Mat<uword>& indices,
-    const mtOp<uword, T1, op_type>& X,
-    const typename arma_op_rel_only<op_type>::result junk1 = 0,
-    const typename arma_cx_only<typename T1::elem_type>::result junk2 = 0
+    const uword k    = 0,
+    const uword type = 0,
+    const typename arma_op_rel_only<op_type>::result junk = 0
     );
   
   template<typename T1, typename T2, typename glue_type>
@@ -58,21 +51,13 @@ class op_find
     (
     Mat<uword>& indices,
     const mtGlue<uword, T1, T2, glue_type>& X,
-    const typename arma_glue_rel_only<glue_type>::result junk1 = 0,
-    const typename arma_not_cx<typename T1::elem_type>::result junk2 = 0,
-    const typename arma_not_cx<typename T2::elem_type>::result junk3 = 0
+    const uword k    = 0,
+    const uword type = 0,
+    const typename arma_glue_rel_only<glue_type>::result junk = 0
     );
   
-  template<typename T1, typename T2, typename glue_type>
-  inline static uword
-  helper
-    (
-    Mat<uword>& indices,
-    const mtGlue<uword, T1, T2, glue_type>& X,
-    const typename arma_glue_rel_only<glue_type>::result junk1 = 0,
-    const typename arma_cx_only<typename T1::elem_type>::result junk2 = 0,
-    const typename arma_cx_only<typename T2::elem_type>::result junk3 = 0
-    );
+  template<typename mask_type>
+  inline static uword helper_mask(Mat<uword>& indices, const mask_type& F, const uword k, const uword type);
   
   template<typename T1>
   inline static void apply(Mat<uword>& out, const mtOp<uword, T1, op_find>& X);
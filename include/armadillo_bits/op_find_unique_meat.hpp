@@ -74,7 +74,7 @@ op_find_unique::apply_helper(Mat<uword>& out, const Proxy<T1>& P, const bool asc
   
   arma_find_unique_comparator<eT> comparator;
   
-  std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+  sort_engine::merge_sort( &(packet_vec[0]), n_elem, comparator, false );
   
   uword* indices_mem = indices.memptr();
   
@@ -95,7 +95,7 @@ op_find_unique::apply_helper(Mat<uword>& out, const Proxy<T1>& P, const bool asc
   
   out.steal_mem_col(indices,count);
   
-  if(ascending_indices)  { std::sort(out.begin(), out.end()); }
+  if(ascending_indices)  { sort_engine::sort(out.memptr(), out.n_elem, uword(0)); }
   
   return true;
   }
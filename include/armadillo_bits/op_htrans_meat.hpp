@@ -59,6 +59,11 @@ op_htrans::apply_mat_noalias(Mat<eT>& out, const Mat<eT>& A, const typename arma
       out_mem[i] = std::conj(A_mem[i]);
       }
     }
+  else
+  if( (A_n_rows >= uword(op_strans::large_n_min)) && (A_n_cols >= uword(op_strans::large_n_min)) )
+    {
+    op_strans::apply_mat_noalias_large<true>(out, A);
+    }
   else
     {
     eT* outptr = out.memptr();
@@ -110,6 +115,8 @@ op_htrans::apply_mat_inplace(Mat<eT>& out, const typename arma_cx_only<eT>::resu
     {
     arma_extra_debug_print("doing in-place hermitian transpose of a square matrix");
     
+    if(n_rows >= uword(op_strans::large_n_min))  { op_strans::apply_mat_inplace_large<true>(out); return; }
+    
     for(uword col=0; col < n_cols; ++col)
       {
       eT* coldata = out.colptr(col);
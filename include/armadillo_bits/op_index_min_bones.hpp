@@ -30,6 +30,12 @@ class op_index_min
   template<typename eT>
   inline static void apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim);
   
+  template<typename eT>
+  inline static void apply_rows(uword* out_mem, const Mat<eT>& X, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void apply_rows(uword* out_mem, const Mat<eT>& X, const typename arma_cx_only<eT>::result* junk = 0);
+  
   
   // cubes
   
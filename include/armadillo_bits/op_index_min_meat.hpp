@@ -70,6 +70,13 @@ op_index_min::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim)
     
     uword* out_mem = out.memptr();
     
+    const uword n_threads = mp_reduce<eT>::n_col_threads(X_n_rows, X_n_cols);
+    
+    arma_ignore(n_threads);
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+    #endif
     for(uword col=0; col < X_n_cols; ++col)
       {
       op_min::direct_min( X.colptr(col), X_n_rows, out_mem[col] );
@@ -84,12 +91,79 @@ op_index_min::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim)
     
     if(X_n_cols == 0)  { return; }
     
-    uword* out_mem = out.memptr();
+    op_index_min::apply_rows(out.memptr(), X);
+    }
+  }
+
+
+
+//! find the index of the extremum in each row;
+//! the columns are traversed contiguously, tracking the best value and its index for every row
+template<typename eT>
+inline
+void
+op_index_min::apply_rows(uword* out_mem, const Mat<eT>& X, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  podarray<eT> best_vals(X_n_rows);
+  
+  eT* best_mem = best_vals.memptr();
+  
+  const uword n_blocks  = mp_reduce<eT>::n_row_blocks(X_n_rows, X_n_cols);
+  const uword block_len = X_n_rows / n_blocks;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_blocks)) if(n_blocks > 1)
+  #endif
+  for(uword block=0; block < n_blocks; ++block)
+    {
+    const uword row_start = block * block_len;
+    const uword row_end   = (block == (n_blocks-1)) ? X_n_rows : (row_start + block_len);
     
-    for(uword row=0; row<X_n_rows; ++row)
+    for(uword row=row_start; row < row_end; ++row)
       {
-      out_mem[row] = X.row(row).index_min();
+      best_mem[row] = priv::most_pos<eT>();
+      out_mem[row]  = 0;
       }
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      const eT* col_mem = X.colptr(col);
+      
+      for(uword row=row_start; row < row_end; ++row)
+        {
+        const eT val = col_mem[row];
+        
+        if(val < best_mem[row])
+          {
+          best_mem[row] = val;
+          out_mem[row]  = col;
+          }
+        }
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_index_min::apply_rows(uword* out_mem, const Mat<eT>& X, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const uword X_n_rows = X.n_rows;
+  
+  for(uword row=0; row<X_n_rows; ++row)
+    {
+    out_mem[row] = X.row(row).index_min();
     }
   }
 
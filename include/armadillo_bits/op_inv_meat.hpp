@@ -49,6 +49,8 @@ op_inv::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_inv>& X)
   {
   arma_extra_debug_sigprint();
   
+  typedef typename T1::elem_type eT;
+  
   const strip_diagmat<T1> strip(X.m);
   
   bool status;
@@ -57,6 +59,18 @@ op_inv::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_inv>& X)
     {
     status = op_inv::apply_diagmat(out, strip.M);
     }
+  else
+  if( (fixed_dims<T1>::is_small_sq) && (fixed_dims<T1>::n_rows > 4) && (fixed_dims<T1>::n_rows <= batch_linalg::tiny_max) )
+    {
+    // fixed-size matrix; sizes up to 4x4 are handled by auxlib::inv() via closed forms,
+    // while LAPACK is faster for sizes above tiny_max
+    
+    const quasi_unwrap<T1> U(X.m);
+    
+    out.set_size(fixed_dims<T1>::n_rows, fixed_dims<T1>::n_cols);
+    
+    status = batch_linalg::inv_tiny<eT, fixed_dims<T1>::small_sq_N>(out.memptr(), U.M.memptr());
+    }
   else
     {
     status = auxlib::inv(out, X.m);
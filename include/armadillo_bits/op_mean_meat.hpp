@@ -56,7 +56,7 @@ op_mean::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, con
   {
   arma_extra_debug_sigprint();
   
-  if(is_Mat<typename Proxy<T1>::stored_type>::value)
+  if(is_Mat<typename Proxy<T1>::stored_type>::value || arma_config::compensated_sum)
     {
     op_mean::apply_noalias_unwrap(out, P, dim);
     }
@@ -95,6 +95,13 @@ op_mean::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
+    const uword n_threads = mp_reduce<eT>::n_col_threads(X_n_rows, X_n_cols);
+    
+    arma_ignore(n_threads);
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+    #endif
     for(uword col=0; col < X_n_cols; ++col)
       {
       out_mem[col] = op_mean::direct_mean( X.colptr(col), X_n_rows );
@@ -109,13 +116,34 @@ op_mean::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
-    for(uword col=0; col < X_n_cols; ++col)
+    if(arma_config::compensated_sum)
       {
-      const eT* col_mem = X.colptr(col);
+      sum_engine::sum_rows(out_mem, X);
+      }
+    else
+      {
+      // whole columns are added to the output, processing blocks of rows in parallel
       
-      for(uword row=0; row < X_n_rows; ++row)
+      const uword n_blocks  = mp_reduce<eT>::n_row_blocks(X_n_rows, X_n_cols);
+      const uword block_len = X_n_rows / n_blocks;
+      
+      #if defined(ARMA_USE_OPENMP)
+        #pragma omp parallel for schedule(static) num_threads(int(n_blocks)) if(n_blocks > 1)
+      #endif
+      for(uword block=0; block < n_blocks; ++block)
         {
-        out_mem[row] += col_mem[row];
+        const uword row_start = block * block_len;
+        const uword row_end   = (block == (n_blocks-1)) ? X_n_rows : (row_start + block_len);
+        
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          const eT* col_mem = X.colptr(col);
+          
+          for(uword row=row_start; row < row_end; ++row)
+            {
+            out_mem[row] += col_mem[row];
+            }
+          }
         }
       }
     
@@ -512,6 +540,13 @@ op_mean::mean_all(const subview<eT>& X)
   
   eT val = eT(0);
   
+  if(arma_config::compensated_sum)
+    {
+    const Proxy< subview<eT> > P(X);
+    
+    val = sum_engine::accumulate_at(P);
+    }
+  else
   if(X_n_rows == 1)
     {
     const Mat<eT>& A = X.m;
@@ -61,7 +61,7 @@ class op_median
   //
   
   template<typename eT>
-  inline static eT direct_median(std::vector<eT>& X);
+  inline static eT direct_median(eT* X, const uword n_elem);
   
   template<typename T>
   inline static void direct_cx_median_index(uword& out_index1, uword& out_index2, std::vector< arma_cx_median_packet<T> >& X);
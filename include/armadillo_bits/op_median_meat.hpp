@@ -35,98 +35,59 @@ op_median::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_median>& in)
   const uword dim = in.aux_uword_a;
   arma_debug_check( (dim > 1), "median(): parameter 'dim' must be 0 or 1" );
   
-  const Proxy<T1> P(in.m);
+  // the selection is done in-place, so each column (or row) is first copied into a column of the work matrix;
+  // as the work matrix is separate, aliasing between the input and output is not an issue
   
-  typedef typename Proxy<T1>::stored_type P_stored_type;
-  
-  const bool is_alias = P.is_alias(out);
+  Mat<eT> work;
   
-  if( (is_Mat<P_stored_type>::value == true) || is_alias )
+  if(dim == 0)
     {
-    const unwrap_check<P_stored_type> tmp(P.Q, is_alias);
-    
-    const typename unwrap_check<P_stored_type>::stored_type& X = tmp.M;
-    
-    const uword X_n_rows = X.n_rows;
-    const uword X_n_cols = X.n_cols;
+    arma_extra_debug_print("op_median::apply(): dim = 0");
     
-    if(dim == 0)  // in each column
-      {
-      arma_extra_debug_print("op_median::apply(): dim = 0");
-      
-      out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
-      
-      if(X_n_rows > 0)
-        {
-        std::vector<eT> tmp_vec(X_n_rows);
-        
-        for(uword col=0; col < X_n_cols; ++col)
-          {
-          arrayops::copy( &(tmp_vec[0]), X.colptr(col), X_n_rows );
-          
-          out[col] = op_median::direct_median(tmp_vec);
-          }
-        }
-      }
-    else  // in each row
-      {
-      arma_extra_debug_print("op_median::apply(): dim = 1");
-      
-      out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
-      
-      if(X_n_cols > 0)
-        {
-        std::vector<eT> tmp_vec(X_n_cols);
-          
-        for(uword row=0; row < X_n_rows; ++row)
-          {
-          for(uword col=0; col < X_n_cols; ++col)  { tmp_vec[col] = X.at(row,col); }
-          
-          out[row] = op_median::direct_median(tmp_vec);
-          }
-        }
-      }
+    work = in.m;
     }
   else
     {
-    const uword P_n_rows = P.get_n_rows();
-    const uword P_n_cols = P.get_n_cols();
+    arma_extra_debug_print("op_median::apply(): dim = 1");
     
-    if(dim == 0)  // in each column
+    work = strans(in.m);
+    }
+  
+  const uword work_n_rows = work.n_rows;
+  const uword work_n_cols = work.n_cols;
+  
+  if(dim == 0)
+    {
+    out.set_size((work_n_rows > 0) ? 1 : 0, work_n_cols);
+    }
+  else
+    {
+    out.set_size(work_n_cols, (work_n_rows > 0) ? 1 : 0);
+    }
+  
+  if(work_n_rows == 0)  { return; }
+  
+  eT* out_mem = out.memptr();
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(work.n_elem) && (work_n_cols > 1) )
+    {
+    #if defined(ARMA_USE_OPENMP)
       {
-      arma_extra_debug_print("op_median::apply(): dim = 0");
-      
-      out.set_size((P_n_rows > 0) ? 1 : 0, P_n_cols);
+      const int n_threads = mp_thread_limit::get();
       
-      if(P_n_rows > 0)
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < work_n_cols; ++col)
         {
-        std::vector<eT> tmp_vec(P_n_rows);
-        
-        for(uword col=0; col < P_n_cols; ++col)
-          {
-          for(uword row=0; row < P_n_rows; ++row)  { tmp_vec[row] = P.at(row,col); }
-          
-          out[col] = op_median::direct_median(tmp_vec);
-          }
+        out_mem[col] = op_median::direct_median(work.colptr(col), work_n_rows);
         }
       }
-    else  // in each row
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < work_n_cols; ++col)
       {
-      arma_extra_debug_print("op_median::apply(): dim = 1");
-      
-      out.set_size(P_n_rows, (P_n_cols > 0) ? 1 : 0);
-      
-      if(P_n_cols > 0)
-        {
-        std::vector<eT> tmp_vec(P_n_cols);
-          
-        for(uword row=0; row < P_n_rows; ++row)
-          {
-          for(uword col=0; col < P_n_cols; ++col)  { tmp_vec[col] = P.at(row,col); }
-          
-          out[row] = op_median::direct_median(tmp_vec);
-          }
-        }
+      out_mem[col] = op_median::direct_median(work.colptr(col), work_n_rows);
       }
     }
   }
@@ -281,7 +242,7 @@ op_median::median_vec
       }
     }
   
-  return op_median::direct_median(tmp_vec);
+  return op_median::direct_median(&(tmp_vec[0]), n_elem);
   }
 
 
@@ -377,36 +338,29 @@ op_median::median_vec
 
 
 
-//! find the median value of a std::vector (contents is modified)
+//! find the median value of an array (contents is modified)
 template<typename eT>
 inline 
 eT
-op_median::direct_median(std::vector<eT>& X)
+op_median::direct_median(eT* X, const uword n_elem)
   {
   arma_extra_debug_sigprint();
   
-  const uword n_elem = uword(X.size());
-  const uword half   = n_elem/2;
-  
-  typename std::vector<eT>::iterator first    = X.begin();
-  typename std::vector<eT>::iterator nth      = first + half;
-  typename std::vector<eT>::iterator pastlast = X.end();
-  
-  std::nth_element(first, nth, pastlast);
+  const uword half = n_elem/2;
   
   if((n_elem % 2) == 0)  // even number of elements
     {
-    typename std::vector<eT>::iterator start   = X.begin();
-    typename std::vector<eT>::iterator pastend = start + half;
+    const uword ranks[2] = { half-1, half };
     
-    const eT val1 = (*nth);
-    const eT val2 = (*(std::max_element(start, pastend)));
+    glue_quantile::multi_select(X, n_elem, ranks, 2);
     
-    return op_mean::robust_mean(val1, val2);
+    return op_mean::robust_mean(X[half], X[half-1]);
     }
   else  // odd number of elements
     {
-    return (*nth);
+    std::nth_element(X, X + half, X + n_elem);
+    
+    return X[half];
     }
   }
 
@@ -71,6 +71,13 @@ op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typ
     
     eT* out_mem = out.memptr();
     
+    const uword n_threads = mp_reduce<eT>::n_col_threads(X_n_rows, X_n_cols);
+    
+    arma_ignore(n_threads);
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+    #endif
     for(uword col=0; col<X_n_cols; ++col)
       {
       out_mem[col] = op_min::direct_min( X.colptr(col), X_n_rows );
@@ -87,17 +94,30 @@ op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typ
     
     eT* out_mem = out.memptr();
     
-    arrayops::copy(out_mem, X.colptr(0), X_n_rows);
+    const uword n_blocks  = mp_reduce<eT>::n_row_blocks(X_n_rows, X_n_cols);
+    const uword block_len = X_n_rows / n_blocks;
     
-    for(uword col=1; col<X_n_cols; ++col)
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_blocks)) if(n_blocks > 1)
+    #endif
+    for(uword block=0; block < n_blocks; ++block)
       {
-      const eT* col_mem = X.colptr(col);
+      const uword row_start = block * block_len;
+      const uword row_end   = (block == (n_blocks-1)) ? X_n_rows : (row_start + block_len);
       
-      for(uword row=0; row<X_n_rows; ++row)
+      arrayops::copy(out_mem + row_start, X.colptr(0) + row_start, row_end - row_start);
+      
+      for(uword col=1; col<X_n_cols; ++col)
         {
-        const eT col_val = col_mem[row];
+        const eT* col_mem = X.colptr(col);
         
-        if(col_val < out_mem[row])  { out_mem[row] = col_val; }
+        for(uword row=row_start; row<row_end; ++row)
+          {
+          const eT col_val = col_mem[row];
+          const eT out_val = out_mem[row];
+          
+          out_mem[row] = (col_val < out_val) ? col_val : out_val;
+          }
         }
       }
     }
@@ -359,26 +379,40 @@ op_min::direct_min(const eT* const X, const uword n_elem)
   {
   arma_extra_debug_sigprint();
   
-  eT min_val = priv::most_pos<eT>();
+  // independent accumulators allow the comparisons to be pipelined and vectorised
   
-  uword i,j;
-  for(i=0, j=1; j<n_elem; i+=2, j+=2)
+  eT min_val1 = priv::most_pos<eT>();
+  eT min_val2 = priv::most_pos<eT>();
+  eT min_val3 = priv::most_pos<eT>();
+  eT min_val4 = priv::most_pos<eT>();
+  
+  uword i = 0;
+  
+  for(; (i+4) <= n_elem; i+=4)
     {
-    const eT X_i = X[i];
-    const eT X_j = X[j];
-    
-    if(X_i < min_val) { min_val = X_i; }
-    if(X_j < min_val) { min_val = X_j; }
+    const eT X_i1 = X[i  ];
+    const eT X_i2 = X[i+1];
+    const eT X_i3 = X[i+2];
+    const eT X_i4 = X[i+3];
+    
+    min_val1 = (X_i1 < min_val1) ? X_i1 : min_val1;
+    min_val2 = (X_i2 < min_val2) ? X_i2 : min_val2;
+    min_val3 = (X_i3 < min_val3) ? X_i3 : min_val3;
+    min_val4 = (X_i4 < min_val4) ? X_i4 : min_val4;
     }
   
-  if(i < n_elem)
+  for(; i < n_elem; ++i)
     {
     const eT X_i = X[i];
     
-    if(X_i < min_val) { min_val = X_i; }
+    min_val1 = (X_i < min_val1) ? X_i : min_val1;
     }
   
-  return min_val;
+  if(min_val2 < min_val1)  { min_val1 = min_val2; }
+  if(min_val3 < min_val1)  { min_val1 = min_val3; }
+  if(min_val4 < min_val1)  { min_val1 = min_val4; }
+  
+  return min_val1;
   }
 
 
@@ -390,43 +424,48 @@ op_min::direct_min(const eT* const X, const uword n_elem, uword& index_of_min_va
   {
   arma_extra_debug_sigprint();
   
-  eT min_val = priv::most_pos<eT>();
+  // independent accumulators, each tracking the first extremum in its own subset of elements;
+  // ties between accumulators are resolved in favour of the lowest index
   
-  uword best_index = 0;
+  eT min_val1 = priv::most_pos<eT>();
+  eT min_val2 = priv::most_pos<eT>();
+  eT min_val3 = priv::most_pos<eT>();
+  eT min_val4 = priv::most_pos<eT>();
   
-  uword i,j;
-  for(i=0, j=1; j<n_elem; i+=2, j+=2)
+  uword best_index1 = 0;
+  uword best_index2 = 0;
+  uword best_index3 = 0;
+  uword best_index4 = 0;
+  
+  uword i = 0;
+  
+  for(; (i+4) <= n_elem; i+=4)
     {
-    const eT X_i = X[i];
-    const eT X_j = X[j];
-    
-    if(X_i < min_val)
-      {
-      min_val    = X_i;
-      best_index = i;
-      }
-    
-    if(X_j < min_val)
-      {
-      min_val    = X_j;
-      best_index = j;
-      }
+    const eT X_i1 = X[i  ];
+    const eT X_i2 = X[i+1];
+    const eT X_i3 = X[i+2];
+    const eT X_i4 = X[i+3];
+    
+    if(X_i1 < min_val1)  { min_val1 = X_i1;  best_index1 = i;   }
+    if(X_i2 < min_val2)  { min_val2 = X_i2;  best_index2 = i+1; }
+    if(X_i3 < min_val3)  { min_val3 = X_i3;  best_index3 = i+2; }
+    if(X_i4 < min_val4)  { min_val4 = X_i4;  best_index4 = i+3; }
     }
   
-  if(i < n_elem)
+  for(; i < n_elem; ++i)
     {
     const eT X_i = X[i];
     
-    if(X_i < min_val)
-      {
-      min_val    = X_i;
-      best_index = i;
-      }
+    if(X_i < min_val1)  { min_val1 = X_i;  best_index1 = i; }
     }
   
-  index_of_min_val = best_index;
+  if( (min_val2 < min_val1) || ((min_val2 == min_val1) && (best_index2 < best_index1)) )  { min_val1 = min_val2;  best_index1 = best_index2; }
+  if( (min_val3 < min_val1) || ((min_val3 == min_val1) && (best_index3 < best_index1)) )  { min_val1 = min_val3;  best_index1 = best_index3; }
+  if( (min_val4 < min_val1) || ((min_val4 == min_val1) && (best_index4 < best_index1)) )  { min_val1 = min_val4;  best_index1 = best_index4; }
   
-  return min_val;
+  index_of_min_val = best_index1;
+  
+  return min_val1;
   }
 
 
@@ -0,0 +1,37 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup op_quantise
+//! @{
+
+
+//! helpers for converting matrices to and from low-precision integer representations
+class op_quantise
+  {
+  public:
+  
+  template<typename qT, typename eT>
+  inline static bool apply(Mat<qT>& Q, Mat<eT>& scales, Mat<s32>& zero_points, const Mat<eT>& X, const uword dim, const bool symmetric);
+  
+  template<typename eT, typename qT>
+  inline static void dequantise(Mat<eT>& out, const Mat<qT>& Q, const Mat<eT>& scales, const Mat<s32>& zero_points, const uword dim);
+  
+  template<typename qT, typename eT>
+  arma_inline static qT convert(const eT val, const eT inv_scale, const s32 zero_point);
+  };
+
+
+//! @}
@@ -0,0 +1,186 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup op_quantise
+//! @{
+
+
+
+template<typename qT, typename eT>
+arma_inline
+qT
+op_quantise::convert(const eT val, const eT inv_scale, const s32 zero_point)
+  {
+  const s32 q_min = s32( std::numeric_limits<qT>::min() );
+  const s32 q_max = s32( std::numeric_limits<qT>::max() );
+  
+  const eT tmp = eop_aux::round(val * inv_scale) + eT(zero_point);
+  
+  return (tmp <= eT(q_min)) ? qT(q_min) : ( (tmp >= eT(q_max)) ? qT(q_max) : qT(tmp) );
+  }
+
+
+
+//! quantise each column (dim = 0) or each row (dim = 1) of X, using a separate scale and zero point for each;
+//! symmetric quantisation uses the range [-q_max, q_max] with a zero point of 0,
+//! while asymmetric quantisation maps the range [min(x,0), max(x,0)] onto the full range of qT
+template<typename qT, typename eT>
+inline
+bool
+op_quantise::apply(Mat<qT>& Q, Mat<eT>& scales, Mat<s32>& zero_points, const Mat<eT>& X, const uword dim, const bool symmetric)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( glue_qmul::is_supported<qT>::value == false ));
+  arma_type_check(( is_real<eT>::value == false ));
+  
+  arma_debug_check( (dim > 1), "quantise(): parameter 'dim' must be 0 or 1" );
+  
+  const s32 q_min = s32( std::numeric_limits<qT>::min() );
+  const s32 q_max = s32( std::numeric_limits<qT>::max() );
+  
+  arma_debug_check( (symmetric && (q_min >= 0)), "quantise(): symmetric quantisation requires a signed element type" );
+  
+  if(X.is_finite() == false)  { return false; }
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  const uword n_groups = (dim == 0) ? X_n_cols : X_n_rows;
+  
+  podarray<eT> lo(n_groups);  lo.zeros();
+  podarray<eT> hi(n_groups);  hi.zeros();
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+    
+    for(uword row=0; row < X_n_rows; ++row)
+      {
+      const uword g   = (dim == 0) ? col : row;
+      const eT    val = X_colptr[row];
+      
+      lo[g] = (val < lo[g]) ? val : lo[g];
+      hi[g] = (val > hi[g]) ? val : hi[g];
+      }
+    }
+  
+  if(dim == 0)  { scales.set_size(1, n_groups);  zero_points.set_size(1, n_groups); }
+  else          { scales.set_size(n_groups, 1);  zero_points.set_size(n_groups, 1); }
+  
+  podarray<eT> inv_scales(n_groups);
+  
+  for(uword g=0; g < n_groups; ++g)
+    {
+    eT  scale;
+    s32 zp;
+    
+    if(symmetric)
+      {
+      const eT max_abs = (std::max)( std::abs(lo[g]), std::abs(hi[g]) );
+      
+      scale = max_abs / eT(q_max);
+      zp    = 0;
+      }
+    else
+      {
+      scale = (hi[g] - lo[g]) / eT(q_max - q_min);
+      zp    = (scale > eT(0)) ? s32( eop_aux::round(eT(q_min) - lo[g]/scale) ) : s32(0);
+      zp    = (std::max)( q_min, (std::min)(zp, q_max) );
+      }
+    
+    // all elements are zero; for all supported types, zero is representable with a zero point of 0
+    if( (scale > eT(0)) == false )  { scale = eT(1); zp = 0; }
+    
+    scales[g]      = scale;
+    zero_points[g] = zp;
+    inv_scales[g]  = eT(1) / scale;
+    }
+  
+  Q.set_size(X_n_rows, X_n_cols);
+  
+  const s32* zp_mem = zero_points.memptr();
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+          qT* Q_colptr = Q.colptr(col);
+    
+    if(dim == 0)
+      {
+      const eT  inv_scale = inv_scales[col];
+      const s32 zp        = zp_mem[col];
+      
+      for(uword row=0; row < X_n_rows; ++row)  { Q_colptr[row] = op_quantise::convert<qT>(X_colptr[row], inv_scale, zp); }
+      }
+    else
+      {
+      for(uword row=0; row < X_n_rows; ++row)  { Q_colptr[row] = op_quantise::convert<qT>(X_colptr[row], inv_scales[row], zp_mem[row]); }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT, typename qT>
+inline
+void
+op_quantise::dequantise(Mat<eT>& out, const Mat<qT>& Q, const Mat<eT>& scales, const Mat<s32>& zero_points, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( is_real<eT>::value == false ));
+  
+  arma_debug_check( (dim > 1), "dequantise(): parameter 'dim' must be 0 or 1" );
+  
+  const uword Q_n_rows = Q.n_rows;
+  const uword Q_n_cols = Q.n_cols;
+  
+  const uword n_groups = (dim == 0) ? Q_n_cols : Q_n_rows;
+  
+  arma_debug_check( ((scales.n_elem != 1) && (scales.n_elem != n_groups)), "dequantise(): number of scales must be 1 or match the size of the given dimension" );
+  
+  arma_debug_check( ((zero_points.n_elem != 0) && (zero_points.n_elem != scales.n_elem)), "dequantise(): number of zero points must match the number of scales" );
+  
+  out.set_size(Q_n_rows, Q_n_cols);
+  
+  const bool per_group = (scales.n_elem != 1);
+  const bool has_zp    = (zero_points.n_elem > 0);
+  
+  const eT*  scales_mem = scales.memptr();
+  const s32* zp_mem     = zero_points.memptr();
+  
+  for(uword col=0; col < Q_n_cols; ++col)
+    {
+    const qT* Q_colptr   = Q.colptr(col);
+          eT* out_colptr = out.colptr(col);
+    
+    for(uword row=0; row < Q_n_rows; ++row)
+      {
+      const uword g = (per_group == false) ? uword(0) : ( (dim == 0) ? col : row );
+      
+      const s32 zp = (has_zp) ? zp_mem[g] : s32(0);
+      
+      out_colptr[row] = eT( s32(Q_colptr[row]) - zp ) * scales_mem[g];
+      }
+    }
+  }
+
+
+
+//! @}
@@ -32,6 +32,39 @@ arma_sort_index_helper(Mat<uword>& out, const Proxy<T1>& P, const uword sort_typ
   
   out.set_size(n_elem, 1);
   
+  if(n_elem >= sort_engine::threshold)
+    {
+    arma_extra_debug_print("arma_sort_index_helper(): using sort_engine");
+    
+    podarray<eT> X(n_elem);
+    
+    eT* X_mem = X.memptr();
+    
+    if(Proxy<T1>::use_at == false)
+      {
+      typename Proxy<T1>::ea_type Pea = P.get_ea();
+      
+      for(uword i=0; i<n_elem; ++i)  { X_mem[i] = Pea[i]; }
+      }
+    else
+      {
+      const uword n_rows = P.get_n_rows();
+      const uword n_cols = P.get_n_cols();
+      
+      for(uword col=0; col < n_cols; ++col)
+      for(uword row=0; row < n_rows; ++row)
+        {
+        *X_mem = P.at(row,col);  ++X_mem;
+        }
+      }
+    
+    const bool all_non_nan = sort_engine::sort_index(out.memptr(), X.memptr(), n_elem, sort_type, sort_stable);
+    
+    if(all_non_nan == false)  { out.soft_reset(); }
+    
+    return all_non_nan;
+    }
+  
   std::vector< arma_sort_index_packet<eT> > packet_vec(n_elem);
   
   if(Proxy<T1>::use_at == false)
@@ -26,18 +26,7 @@ op_sort::direct_sort(eT* X, const uword n_elem, const uword sort_type)
   {
   arma_extra_debug_sigprint();
   
-  if(sort_type == 0)
-    {
-    arma_ascend_sort_helper<eT> comparator;
-    
-    std::sort(&X[0], &X[n_elem], comparator);
-    }
-  else
-    {
-    arma_descend_sort_helper<eT> comparator;
-    
-    std::sort(&X[0], &X[n_elem], comparator);
-    }
+  sort_engine::sort(X, n_elem, sort_type);
   }
 
 
@@ -49,9 +38,7 @@ op_sort::direct_sort_ascending(eT* X, const uword n_elem)
   {
   arma_extra_debug_sigprint();
   
-  arma_ascend_sort_helper<eT> comparator;
-    
-  std::sort(&X[0], &X[n_elem], comparator);
+  sort_engine::sort(X, n_elem, uword(0));
   }
 
 
@@ -126,10 +113,29 @@ op_sort::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword sort_type, co
     
     const uword n_rows = out.n_rows;
     const uword n_cols = out.n_cols;
-      
-    for(uword col=0; col < n_cols; ++col)
+    
+    // columns long enough to be sorted in parallel by the sort engine are processed one at a time
+    
+    if( (n_cols > 1) && (n_rows < sort_engine::threshold) && mp_gate<eT>::eval(out.n_elem) )
       {
-      op_sort::direct_sort( out.colptr(col), n_rows, sort_type );
+      #if defined(ARMA_USE_OPENMP)
+        {
+        const int n_threads = mp_thread_limit::get();
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < n_cols; ++col)
+          {
+          op_sort::direct_sort( out.colptr(col), n_rows, sort_type );
+          }
+        }
+      #endif
+      }
+    else
+      {
+      for(uword col=0; col < n_cols; ++col)
+        {
+        op_sort::direct_sort( out.colptr(col), n_rows, sort_type );
+        }
       }
     }
   else
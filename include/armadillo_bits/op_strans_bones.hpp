@@ -35,12 +35,33 @@ class op_strans
   template<typename eT, typename TA>
   arma_hot inline static void apply_mat_noalias_tinysq(Mat<eT>& out, const TA& A);
   
+  template<const uword A_n_rows, const uword A_n_cols, typename eT>
+  arma_hot inline static void apply_mat_noalias_fixed(eT* out, const eT* A);
+  
   template<typename eT, typename TA>
   arma_hot inline static void apply_mat_noalias(Mat<eT>& out, const TA& A);
   
   template<typename eT>
   arma_hot inline static void apply_mat_inplace(Mat<eT>& out);
   
+  static const uword block_size  = 64;    // size of the tiles used by the large-matrix transposes
+  static const uword large_n_min = 256;   // minimum number of rows and columns for using the tiled transposes
+  
+  template<const bool do_conj, typename eT>
+  arma_hot inline static void block_worker(eT* Y, const eT* X, const uword X_n_rows, const uword Y_n_rows, const uword n_rows, const uword n_cols);
+  
+  template<const bool do_conj, typename eT>
+  arma_hot inline static void apply_mat_noalias_large(Mat<eT>& out, const Mat<eT>& A);
+  
+  template<const bool do_conj, typename eT>
+  arma_hot inline static void block_swapper(Mat<eT>& X, const uword row_block);
+  
+  template<const bool do_conj, typename eT>
+  arma_hot inline static void apply_mat_inplace_large(Mat<eT>& X);
+  
+  template<typename eT>
+  inline static void apply_mat_inplace_lowmem(Mat<eT>& X);
+  
   template<typename eT, typename TA>
   arma_hot inline static void apply_mat(Mat<eT>& out, const TA& A);
   
@@ -113,12 +113,22 @@ op_strans::apply_mat_noalias(Mat<eT>& out, const TA& A)
     {
     arrayops::copy( out.memptr(), A.memptr(), A.n_elem );
     }
+  else
+  if( fixed_dims<TA>::is_small )
+    {
+    op_strans::apply_mat_noalias_fixed< fixed_dims<TA>::n_rows, fixed_dims<TA>::n_cols >(out.memptr(), A.memptr());
+    }
   else
     {
     if( (A_n_rows <= 4) && (A_n_rows == A_n_cols) )
       {
       op_strans::apply_mat_noalias_tinysq(out, A);
       }
+    else
+    if( (A_n_rows >= uword(large_n_min)) && (A_n_cols >= uword(large_n_min)) )
+      {
+      op_strans::apply_mat_noalias_large<false>(out, A);
+      }
     else
       {
       eT* outptr = out.memptr();
@@ -148,6 +158,25 @@ op_strans::apply_mat_noalias(Mat<eT>& out, const TA& A)
 
 
 
+//! transpose of a fixed-size matrix (up to 16x16), with the dimensions known at compile time
+template<const uword A_n_rows, const uword A_n_cols, typename eT>
+arma_hot
+inline
+void
+op_strans::apply_mat_noalias_fixed(eT* out, const eT* A)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword row=0; row < A_n_rows; ++row)
+    {
+    eT* out_col = &(out[row*A_n_cols]);
+    
+    for(uword col=0; col < A_n_cols; ++col)  { out_col[col] = A[row + col*A_n_rows]; }
+    }
+  }
+
+
+
 template<typename eT>
 arma_hot
 inline
@@ -163,6 +192,8 @@ op_strans::apply_mat_inplace(Mat<eT>& out)
     {
     arma_extra_debug_print("op_strans::apply(): doing in-place transpose of a square matrix");
     
+    if(n_rows >= uword(large_n_min))  { op_strans::apply_mat_inplace_large<false>(out); return; }
+    
     const uword N = n_rows;
     
     for(uword k=0; k < N; ++k)
@@ -199,6 +230,323 @@ op_strans::apply_mat_inplace(Mat<eT>& out)
 
 
 
+//! transpose a block of X into Y, writing contiguous segments of the rows of Y
+template<const bool do_conj, typename eT>
+arma_hot
+inline
+void
+op_strans::block_worker(eT* Y, const eT* X, const uword X_n_rows, const uword Y_n_rows, const uword n_rows, const uword n_cols)
+  {
+  for(uword row=0; row < n_rows; ++row)
+    {
+    eT* Y_ptr = &(Y[row*Y_n_rows]);
+    
+    for(uword col=0; col < n_cols; ++col)
+      {
+      const eT val = X[row + col*X_n_rows];
+      
+      Y_ptr[col] = (do_conj) ? eT(access::alt_conj(val)) : val;
+      }
+    }
+  }
+
+
+
+//! tiled transpose of a large matrix;
+//! each tile is small enough to stay in cache, avoiding a cache miss per element when reading along the rows of A
+template<const bool do_conj, typename eT>
+arma_hot
+inline
+void
+op_strans::apply_mat_noalias_large(Mat<eT>& out, const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword A_n_rows = A.n_rows;
+  const uword A_n_cols = A.n_cols;
+  
+  const eT* X = A.memptr();
+        eT* Y = out.memptr();
+  
+  const uword n_row_blocks = (A_n_rows + uword(block_size) - 1) / uword(block_size);
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(A.n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      // each block of rows of A is written to a separate block of columns of out
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword row_block=0; row_block < n_row_blocks; ++row_block)
+        {
+        const uword row    = row_block * uword(block_size);
+        const uword n_rows = (std::min)(uword(block_size), A_n_rows - row);
+        
+        for(uword col=0; col < A_n_cols; col += uword(block_size))
+          {
+          const uword n_cols = (std::min)(uword(block_size), A_n_cols - col);
+          
+          op_strans::block_worker<do_conj>( &(Y[col + row*A_n_cols]), &(X[row + col*A_n_rows]), A_n_rows, A_n_cols, n_rows, n_cols );
+          }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword row_block=0; row_block < n_row_blocks; ++row_block)
+      {
+      const uword row    = row_block * uword(block_size);
+      const uword n_rows = (std::min)(uword(block_size), A_n_rows - row);
+      
+      for(uword col=0; col < A_n_cols; col += uword(block_size))
+        {
+        const uword n_cols = (std::min)(uword(block_size), A_n_cols - col);
+        
+        op_strans::block_worker<do_conj>( &(Y[col + row*A_n_cols]), &(X[row + col*A_n_rows]), A_n_rows, A_n_cols, n_rows, n_cols );
+        }
+      }
+    }
+  }
+
+
+
+//! transpose the tiles in one block of rows of a square matrix, swapping each with its counterpart below the diagonal
+template<const bool do_conj, typename eT>
+arma_hot
+inline
+void
+op_strans::block_swapper(Mat<eT>& X, const uword row_block)
+  {
+  const uword N = X.n_rows;
+  
+  const uword row_start = row_block * uword(block_size);
+  const uword row_end   = (std::min)(row_start + uword(block_size), N);
+  
+  // tile on the diagonal
+  
+  for(uword col=row_start; col < row_end; ++col)
+    {
+    eT* colptr = X.colptr(col);
+    
+    if(do_conj)  { colptr[col] = eT(access::alt_conj(colptr[col])); }
+    
+    for(uword row=(col+1); row < row_end; ++row)
+      {
+      const eT tmp = colptr[row];
+      
+      colptr[row]   = (do_conj) ? eT(access::alt_conj(X.at(col,row))) : X.at(col,row);
+      X.at(col,row) = (do_conj) ? eT(access::alt_conj(tmp))           : tmp;
+      }
+    }
+  
+  // tiles to the right of the diagonal
+  
+  for(uword col=row_end; col < N; ++col)
+    {
+    eT* colptr = X.colptr(col);
+    
+    for(uword row=row_start; row < row_end; ++row)
+      {
+      const eT tmp = colptr[row];
+      
+      colptr[row]   = (do_conj) ? eT(access::alt_conj(X.at(col,row))) : X.at(col,row);
+      X.at(col,row) = (do_conj) ? eT(access::alt_conj(tmp))           : tmp;
+      }
+    }
+  }
+
+
+
+//! tiled in-place transpose of a large square matrix
+template<const bool do_conj, typename eT>
+arma_hot
+inline
+void
+op_strans::apply_mat_inplace_large(Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_blocks = (X.n_rows + uword(block_size) - 1) / uword(block_size);
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(X.n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      // the amount of work for each block of rows decreases along the diagonal,
+      // so the blocks are distributed cyclically to balance the load
+      
+      #pragma omp parallel for schedule(static,1) num_threads(n_threads)
+      for(uword row_block=0; row_block < n_blocks; ++row_block)
+        {
+        op_strans::block_swapper<do_conj>(X, row_block);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword row_block=0; row_block < n_blocks; ++row_block)
+      {
+      op_strans::block_swapper<do_conj>(X, row_block);
+      }
+    }
+  }
+
+
+
+//! in-place transpose of a rectangular matrix, using auxiliary memory proportional to max(n_rows, n_cols);
+//! based on the decomposition into independent row and column permutations described in:
+//! Bryan Catanzaro, Alexander Keller, Michael Garland.
+//! A Decomposition for In-place Matrix Transposition.
+//! ACM SIGPLAN Symposium on Principles and Practice of Parallel Programming, pp. 193-206, 2014.
+template<typename eT>
+inline
+void
+op_strans::apply_mat_inplace_lowmem(Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword m = X.n_rows;
+  const uword n = X.n_cols;
+  
+  // X.set_size() will check whether we can change the dimensions of X;
+  // X.set_size() will also reuse existing memory, as the number of elements hasn't changed
+  
+  X.set_size(n, m);
+  
+  if( (m <= 1) || (n <= 1) )  { return; }
+  
+  eT* mem = X.memptr();
+  
+  // the memory is treated as a row-major matrix R with n rows and m columns,
+  // where row r of R is column r of the original matrix;
+  // element R(j,i) must be moved to the linear position i*n + j
+  
+  uword c = m;
+  uword tmp_gcd = n;
+  
+  while(tmp_gcd != 0)  { const uword tmp = c % tmp_gcd;  c = tmp_gcd;  tmp_gcd = tmp; }
+  
+  const uword a = m / c;
+  const uword b = n / c;
+  
+  // step 1:
+  // for each q in [1,c), rotate columns [q*a, (q+1)*a) of R upwards by q rows;
+  // this is done via reversals of row segments: rev(0,q) and rev(q,n) for each q, followed by rev(0,n) for all segments at once;
+  // the first two reversals are interleaved across all q, so that the partner rows of each row are close together in memory
+  
+  if(c > 1)
+    {
+    for(uword lo=0; lo < n; ++lo)
+      {
+      for(uword q=1; q < c; ++q)
+        {
+        const uword hi = (lo < q) ? (q-1-lo) : (n-1+q-lo);
+        
+        if(lo < hi)
+          {
+          const uword offset = q*a;
+          
+          std::swap_ranges( &(mem[lo*m + offset]), &(mem[lo*m + offset + a]), &(mem[hi*m + offset]) );
+          }
+        }
+      }
+    
+    for(uword lo=0, hi=(n-1); lo < hi; ++lo, --hi)
+      {
+      std::swap_ranges( &(mem[lo*m + a]), &(mem[lo*m + m]), &(mem[hi*m + a]) );
+      }
+    }
+  
+  // step 2:
+  // within each row r of R, move the element in column i to column (i*n + j) mod m, where j = (r + floor(i/a)) mod n
+  
+  podarray<uword> base(m);
+  
+  for(uword i=0; i < m; ++i)  { base[i] = (i*n) % m; }
+  
+  podarray<uword> j_mod_m(c);
+  podarray<eT>    row_tmp(m);
+  
+  for(uword r=0; r < n; ++r)
+    {
+    for(uword q=0; q < c; ++q)  { const uword rq = r + q;  j_mod_m[q] = ((rq < n) ? rq : (rq - n)) % m; }
+    
+    eT* row_mem = &(mem[r*m]);
+    
+    for(uword q=0; q < c; ++q)
+      {
+      const uword jq = j_mod_m[q];
+      
+      for(uword i = q*a; i < (q+1)*a; ++i)
+        {
+        const uword dest = base[i] + jq;
+        
+        row_tmp[ (dest < m) ? dest : (dest - m) ] = row_mem[i];
+        }
+      }
+    
+    arrayops::copy(row_mem, row_tmp.memptr(), m);
+    }
+  
+  // step 3:
+  // within each column k of R, move each element to its final row;
+  // the rows holding elements with the same j = u*c + (k mod c) are r = j, j-1, ..., j-c+1 (modulo n),
+  // and their destination rows increase in steps of b, which avoids divisions in the inner loop;
+  // columns are processed in small groups, so that R is written in contiguous segments
+  
+  podarray<uword> inv_b(a);
+  
+  for(uword s=0; s < a; ++s)  { inv_b[(s*b) % a] = s; }
+  
+  const uword group_size = (std::min)(m, uword(8));
+  
+  podarray<eT> col_tmp(n * group_size);
+  
+  for(uword k_start=0; k_start < m; k_start += group_size)
+    {
+    const uword n_group = (std::min)(group_size, m - k_start);
+    
+    for(uword kk=0; kk < n_group; ++kk)
+      {
+      const uword k       = k_start + kk;
+      const uword k_mod_c = k % c;
+      const uword k_div_c = k / c;
+      
+      eT* tmp_mem = &(col_tmp[kk]);
+      
+      for(uword u=0; u < b; ++u)
+        {
+        const uword j = u*c + k_mod_c;
+        const uword s = inv_b[ (k_div_c + a - (u % a)) % a ];
+        
+        uword t = (s*n + j) / m;
+        uword r = j;
+        
+        for(uword q=0; q < c; ++q)
+          {
+          tmp_mem[t * group_size] = mem[r*m + k];
+          
+          t += b;
+          r  = (r > 0) ? (r-1) : (n-1);
+          }
+        }
+      }
+    
+    for(uword t=0; t < n; ++t)
+      {
+      arrayops::copy( &(mem[t*m + k_start]), &(col_tmp[t * group_size]), n_group );
+      }
+    }
+  }
+
+
+
 template<typename eT, typename TA>
 arma_hot
 inline
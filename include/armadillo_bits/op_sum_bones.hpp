@@ -27,6 +27,9 @@ class op_sum
   template<typename T1>
   arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Op<T1, op_sum>& in);
   
+  template<typename T1>
+  arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Op< Op<T1, op_repmat>, op_sum>& in);
+  
   template<typename T1>
   arma_hot inline static void apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const uword dim);
   
@@ -50,6 +50,47 @@ op_sum::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_sum>& in)
 
 
 
+//! sum of repmat(): the sums of the operand are scaled by the number of copies along dim, then replicated
+template<typename T1>
+arma_hot
+inline
+void
+op_sum::apply(Mat<typename T1::elem_type>& out, const Op< Op<T1, op_repmat>, op_sum>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword dim = in.aux_uword_a;
+  arma_debug_check( (dim > 1), "sum(): parameter 'dim' must be 0 or 1" );
+  
+  const uword copies_per_row = in.m.aux_uword_a;
+  const uword copies_per_col = in.m.aux_uword_b;
+  
+  const quasi_unwrap<T1> U(in.m.m);
+  
+  const Proxy< Mat<eT> > P(U.M);
+  
+  Mat<eT> tmp;
+  
+  op_sum::apply_noalias(tmp, P, dim);
+  
+  if(dim == 0)
+    {
+    if(copies_per_row == 0)  { tmp.zeros(); }  else  { tmp *= eT(copies_per_row); }
+    
+    op_repmat::apply_noalias(out, tmp, 1, copies_per_col);
+    }
+  else
+    {
+    if(copies_per_col == 0)  { tmp.zeros(); }  else  { tmp *= eT(copies_per_col); }
+    
+    op_repmat::apply_noalias(out, tmp, copies_per_row, 1);
+    }
+  }
+
+
+
 template<typename T1>
 arma_hot
 inline
@@ -58,7 +99,7 @@ op_sum::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, cons
   {
   arma_extra_debug_sigprint();
   
-  if(is_Mat<typename Proxy<T1>::stored_type>::value)
+  if(is_Mat<typename Proxy<T1>::stored_type>::value || arma_config::compensated_sum)
     {
     op_sum::apply_noalias_unwrap(out, P, dim);
     }
@@ -95,6 +136,13 @@ op_sum::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
+    const uword n_threads = mp_reduce<eT>::n_col_threads(X_n_rows, X_n_cols);
+    
+    arma_ignore(n_threads);
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+    #endif
     for(uword col=0; col < X_n_cols; ++col)
       {
       out_mem[col] = arrayops::accumulate( X.colptr(col), X_n_rows );
@@ -106,9 +154,25 @@ op_sum::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
-    for(uword col=0; col < X_n_cols; ++col)
+    if(arma_config::compensated_sum)  { sum_engine::sum_rows(out_mem, X); return; }
+    
+    // whole columns are added to the output, processing blocks of rows in parallel
+    
+    const uword n_blocks  = mp_reduce<eT>::n_row_blocks(X_n_rows, X_n_cols);
+    const uword block_len = X_n_rows / n_blocks;
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_blocks)) if(n_blocks > 1)
+    #endif
+    for(uword block=0; block < n_blocks; ++block)
       {
-      arrayops::inplace_plus( out_mem, X.colptr(col), X_n_rows );
+      const uword row_start = block * block_len;
+      const uword len       = (block == (n_blocks-1)) ? (X_n_rows - row_start) : block_len;
+      
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        arrayops::inplace_plus( out_mem + row_start, X.colptr(col) + row_start, len );
+        }
       }
     }
   }
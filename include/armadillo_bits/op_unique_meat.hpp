@@ -78,9 +78,16 @@ op_unique::apply_helper(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
     X_mem = X.memptr();
     }
   
-  arma_unique_comparator<eT> comparator;
-  
-  std::sort( X.begin(), X.end(), comparator );
+  if(is_cx<eT>::no)
+    {
+    sort_engine::sort(X_mem, n_elem, uword(0));
+    }
+  else
+    {
+    arma_unique_comparator<eT> comparator;
+    
+    sort_engine::merge_sort(X_mem, n_elem, comparator, false);
+    }
   
   uword N_unique = 1;
   
@@ -28,6 +28,13 @@ class op_var
   inline static void apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type, T1, op_var>& in);
   
   
+  template<typename eT>
+  inline static void apply_rows(eT* out_mem, const Mat<eT>& X, const uword norm_type, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename T>
+  inline static void apply_rows(T* out_mem, const Mat< std::complex<T> >& X, const uword norm_type);
+  
+  
   //
   
   template<typename eT>
@@ -54,6 +54,13 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
       {
       out_eT* out_mem = out.memptr();
       
+      const uword n_threads = mp_reduce<in_eT>::n_col_threads(X_n_rows, X_n_cols);
+      
+      arma_ignore(n_threads);
+      
+      #if defined(ARMA_USE_OPENMP)
+        #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+      #endif
       for(uword col=0; col<X_n_cols; ++col)
         {
         out_mem[col] = op_var::direct_var( X.colptr(col), X_n_rows, norm_type );
@@ -69,19 +76,128 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
     
     if(X_n_cols > 0)
       {
-      podarray<in_eT> dat(X_n_cols);
+      op_var::apply_rows(out.memptr(), X, norm_type);
+      }
+    }
+  }
+
+
+
+//! find the variance of each row;
+//! the columns are traversed contiguously, accumulating the row means and then the squared deviations from the means
+template<typename eT>
+inline
+void
+op_var::apply_rows(eT* out_mem, const Mat<eT>& X, const uword norm_type, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(X_n_cols < 2)
+    {
+    arrayops::fill_zeros(out_mem, X_n_rows);
+    return;
+    }
+  
+  podarray<eT> mean_vals(X_n_rows);
+  podarray<eT>  acc3_vals(X_n_rows);
+  
+  eT* mean_mem = mean_vals.memptr();
+  eT* acc3_mem =  acc3_vals.memptr();
+  
+  const uword n_blocks  = mp_reduce<eT>::n_row_blocks(X_n_rows, X_n_cols);
+  const uword block_len = X_n_rows / n_blocks;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_blocks)) if(n_blocks > 1)
+  #endif
+  for(uword block=0; block < n_blocks; ++block)
+    {
+    const uword row_start = block * block_len;
+    const uword row_end   = (block == (n_blocks-1)) ? X_n_rows : (row_start + block_len);
+    
+    for(uword row=row_start; row < row_end; ++row)
+      {
+      mean_mem[row] = eT(0);
+      out_mem[row]  = eT(0);
+      acc3_mem[row] = eT(0);
+      }
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      const eT* col_mem = X.colptr(col);
       
-      in_eT*  dat_mem = dat.memptr();
-      out_eT* out_mem = out.memptr();
+      for(uword row=row_start; row < row_end; ++row)  { mean_mem[row] += col_mem[row]; }
+      }
+    
+    for(uword row=row_start; row < row_end; ++row)  { mean_mem[row] /= eT(X_n_cols); }
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      const eT* col_mem = X.colptr(col);
       
-      for(uword row=0; row<X_n_rows; ++row)
+      for(uword row=row_start; row < row_end; ++row)
         {
-        dat.copy_row(X, row);
+        const eT tmp = mean_mem[row] - col_mem[row];
         
-        out_mem[row] = op_var::direct_var( dat_mem, X_n_cols, norm_type );
+        out_mem[row]  += tmp*tmp;
+        acc3_mem[row] += tmp;
         }
       }
     }
+  
+  const eT norm_val = (norm_type == 0) ? eT(X_n_cols-1) : eT(X_n_cols);
+  
+  podarray<eT> dat;
+  
+  for(uword row=0; row < X_n_rows; ++row)
+    {
+    const eT acc3    = acc3_mem[row];
+    const eT var_val = (out_mem[row] - acc3*acc3/eT(X_n_cols)) / norm_val;
+    
+    if(arma_isfinite(var_val))
+      {
+      out_mem[row] = var_val;
+      }
+    else
+      {
+      // overflow or non-finite elements; use the robust method on a copy of the row
+      
+      dat.set_size(X_n_cols);
+      dat.copy_row(X, row);
+      
+      out_mem[row] = op_var::direct_var( dat.memptr(), X_n_cols, norm_type );
+      }
+    }
+  }
+
+
+
+template<typename T>
+inline
+void
+op_var::apply_rows(T* out_mem, const Mat< std::complex<T> >& X, const uword norm_type)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename std::complex<T> eT;
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  podarray<eT> dat(X_n_cols);
+  
+  eT* dat_mem = dat.memptr();
+  
+  for(uword row=0; row<X_n_rows; ++row)
+    {
+    dat.copy_row(X, row);
+    
+    out_mem[row] = op_var::direct_var( dat_mem, X_n_cols, norm_type );
+    }
   }
 
 
@@ -162,33 +278,39 @@ op_var::direct_var(const eT* const X, const uword n_elem, const uword norm_type)
     {
     const eT acc1 = op_mean::direct_mean(X, n_elem);
     
-    eT acc2 = eT(0);
-    eT acc3 = eT(0);
+    // independent accumulators allow the operations to be pipelined and vectorised
+    
+    eT acc2_1 = eT(0);  eT acc3_1 = eT(0);
+    eT acc2_2 = eT(0);  eT acc3_2 = eT(0);
+    eT acc2_3 = eT(0);  eT acc3_3 = eT(0);
+    eT acc2_4 = eT(0);  eT acc3_4 = eT(0);
     
-    uword i,j;
+    uword i = 0;
     
-    for(i=0, j=1; j<n_elem; i+=2, j+=2)
+    for(; (i+4) <= n_elem; i+=4)
       {
-      const eT Xi = X[i];
-      const eT Xj = X[j];
+      const eT tmp1 = acc1 - X[i  ];
+      const eT tmp2 = acc1 - X[i+1];
+      const eT tmp3 = acc1 - X[i+2];
+      const eT tmp4 = acc1 - X[i+3];
       
-      const eT tmpi = acc1 - Xi;
-      const eT tmpj = acc1 - Xj;
-      
-      acc2 += tmpi*tmpi + tmpj*tmpj;
-      acc3 += tmpi      + tmpj;
+      acc2_1 += tmp1*tmp1;  acc3_1 += tmp1;
+      acc2_2 += tmp2*tmp2;  acc3_2 += tmp2;
+      acc2_3 += tmp3*tmp3;  acc3_3 += tmp3;
+      acc2_4 += tmp4*tmp4;  acc3_4 += tmp4;
       }
     
-    if(i < n_elem)
+    for(; i < n_elem; ++i)
       {
-      const eT Xi = X[i];
-      
-      const eT tmpi = acc1 - Xi;
+      const eT tmp = acc1 - X[i];
       
-      acc2 += tmpi*tmpi;
-      acc3 += tmpi;
+      acc2_1 += tmp*tmp;
+      acc3_1 += tmp;
       }
     
+    const eT acc2 = (acc2_1 + acc2_2) + (acc2_3 + acc2_4);
+    const eT acc3 = (acc3_1 + acc3_2) + (acc3_3 + acc3_4);
+    
     const eT norm_val = (norm_type == 0) ? eT(n_elem-1) : eT(n_elem);
     const eT var_val  = (acc2 - acc3*acc3/eT(n_elem)) / norm_val;
     
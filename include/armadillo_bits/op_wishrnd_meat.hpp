@@ -133,13 +133,21 @@ op_wishrnd::apply_noalias_mode2(Mat<eT>& out, const Mat<eT>& D, const eT df)
       {
       arma_extra_debug_print("standard generator");
       
-      op_chi2rnd_varying_df<eT> chi2rnd_generator;
-      
       Mat<eT> A(N, N, fill::zeros);
       
+      // chi-squared variates with df-i degrees of freedom, via gamma variates with shape (df-i)/2 and scale 2
+      
+      podarray<eT> chi2_vals(N);
+      
+      eT* chi2_mem = chi2_vals.memptr();
+      
+      for(uword i=0; i<N; ++i)  { chi2_mem[i] = (df - eT(i)) / eT(2); }
+      
+      arma_rng::randg<eT>::fill_varying(chi2_mem, chi2_mem, N, double(2));
+      
       for(uword i=0; i<N; ++i)
         {
-        A.at(i,i) = std::sqrt( chi2rnd_generator(df - eT(i)) );
+        A.at(i,i) = std::sqrt( chi2_mem[i] );
         }
       
       const uword Nm1 = N-1;
@@ -148,7 +156,7 @@ op_wishrnd::apply_noalias_mode2(Mat<eT>& out, const Mat<eT>& D, const eT df)
         arma_rng::randn<eT>::fill( &(A.at(i+1,i)), Nm1-i );
         }
       
-      const Mat<eT> B = D * A;
+      const Mat<eT> B = D.t() * A;  // S = D.t() * D
       
       A.reset();
       
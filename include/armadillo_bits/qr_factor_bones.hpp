@@ -0,0 +1,57 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup qr_factor
+//! @{
+
+
+
+//! economical QR decomposition of a matrix with at least as many rows as columns, kept for repeated use.
+//! Once computed, each solve() finds a least-squares solution using only O(m*n) operations per column of the right-hand side.
+template<typename eT>
+class qr_factor
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  inline ~qr_factor();
+  inline  qr_factor();
+  
+  template<typename T1> inline explicit qr_factor(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool compute(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool    solve(Mat<eT>& out, const Base<eT,T1>& B) const;
+  template<typename T1> inline Mat<eT> solve(              const Base<eT,T1>& B) const;
+  
+  inline uword n_rows()   const;
+  inline uword n_cols()   const;
+  inline bool  is_empty() const;
+  
+  inline void reset();
+  
+  
+  private:
+  
+  arma_aligned Mat<eT> Q;  // m x n, with orthonormal columns
+  arma_aligned Mat<eT> R;  // n x n, upper triangular
+  };
+
+
+
+//! @}
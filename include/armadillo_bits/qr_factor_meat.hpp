@@ -0,0 +1,200 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup qr_factor
+//! @{
+
+
+
+template<typename eT>
+inline
+qr_factor<eT>::~qr_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+qr_factor<eT>::qr_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+qr_factor<eT>::qr_factor(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = (*this).compute(X);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("qr_factor(): decomposition failed");
+    }
+  }
+
+
+
+//! factorise X;
+//! false is returned (and the object is reset) if the decomposition fails or X does not have full column rank
+template<typename eT>
+template<typename T1>
+inline
+bool
+qr_factor<eT>::compute(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  arma_debug_check( (U.M.n_rows < U.M.n_cols), "qr_factor::compute(): given matrix must have at least as many rows as columns" );
+  
+  const bool status = auxlib::qr_econ(Q, R, U.M);
+  
+  if(status == false)  { (*this).reset(); return false; }
+  
+  for(uword i=0; i < R.n_cols; ++i)
+    {
+    if(R.at(i,i) == eT(0))  { (*this).reset(); return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! find the least-squares solution of A*X = B, where A is the factorised matrix
+template<typename eT>
+template<typename T1>
+inline
+bool
+qr_factor<eT>::solve(Mat<eT>& out, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(B.get_ref());
+  
+  arma_debug_check( (U.M.n_rows != Q.n_rows), "qr_factor::solve(): number of rows in given matrix must match the number of rows in the factorised matrix" );
+  
+  // X = inv(R) * Q.t() * B
+  
+  Mat<eT> tmp = trans(Q) * U.M;
+  
+  if(tmp.is_empty())  { out.steal_mem(tmp); return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(tmp);
+    
+    char     uplo  = 'U';
+    char     trans = 'N';
+    char     diag  = 'N';
+    blas_int n     = blas_int(R.n_rows);
+    blas_int nrhs  = blas_int(tmp.n_cols);
+    blas_int info  = blas_int(0);
+    
+    arma_extra_debug_print("lapack::trtrs()");
+    lapack::trtrs(&uplo, &trans, &diag, &n, &nrhs, R.memptr(), &n, tmp.memptr(), &n, &info);
+    
+    if(info != blas_int(0))  { out.soft_reset(); return false; }
+    
+    out.steal_mem(tmp);
+    
+    return true;
+    }
+  #else
+    {
+    out.soft_reset();
+    arma_stop_logic_error("qr_factor::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+qr_factor<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = (*this).solve(out, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("qr_factor::solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+qr_factor<eT>::n_rows() const
+  {
+  return Q.n_rows;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+qr_factor<eT>::n_cols() const
+  {
+  return R.n_cols;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+qr_factor<eT>::is_empty() const
+  {
+  return R.is_empty();
+  }
+
+
+
+template<typename eT>
+inline
+void
+qr_factor<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  Q.reset();
+  R.reset();
+  }
+
+
+
+//! @}
@@ -0,0 +1,237 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup rel_mask
+//! @{
+
+
+//! Packed bitmask holding the result of a relational expression, one bit per element (in column-major order).
+//! find() and accu() use it instead of evaluating the expression into a Mat<uword>,
+//! which needs 64 times as much memory on 64 bit systems.
+//! The bits are stored in uword sized words.
+//! any(), all() and find() with a limit on the number of indices evaluate the expression
+//! one word-sized block at a time, stopping as soon as the result is known.
+//! With OpenMP enabled, long expressions are evaluated by find() and accu() in parallel chunks of words;
+//! for find(), the per-chunk counts give the position of each chunk's indices in the output.
+class rel_mask
+  {
+  public:
+  
+  static const uword n_word_bits = uword(8) * uword(sizeof(uword));
+  
+  template<typename T1>
+  inline static uword find_all(Mat<uword>& indices, const T1& F);
+  
+  template<typename T1>
+  inline static uword count(const T1& F);
+  
+  inline static void get_indices(uword* out, const uword* bits, const uword w_start, const uword w_end);
+  
+  template<typename T1> inline static bool any(const T1& F);
+  template<typename T1> inline static bool all(const T1& F);
+  
+  template<typename T1> arma_hot inline static bool any_range(const T1& F, const uword start, const uword N);
+  template<typename T1> arma_hot inline static bool all_range(const T1& F, const uword start, const uword N);
+  
+  template<typename T1> inline static uword find_first(Mat<uword>& indices, const T1& F, const uword k);
+  template<typename T1> inline static uword find_last (Mat<uword>& indices, const T1& F, const uword k);
+  
+  arma_inline static uword popcount(uword word);
+  arma_inline static uword ctz(const uword word);
+  arma_inline static uword msb(const uword word);
+  
+  
+  private:
+  
+  template<typename T1>
+  arma_hot inline static uword eval(uword* bits, const T1& F, const uword w_start, const uword w_end);
+  
+  template<typename T1>
+  arma_hot inline static uword eval_at(uword* bits, const T1& F);
+  
+  inline static uword n_chunks(const uword n_elem);
+  
+  template<typename T1>
+  arma_hot arma_inline static uword pack(const T1& F, const uword start, const uword N);
+  };
+
+
+
+//! evaluation of relational operations, specialised for each operation so that only the relevant comparison is instantiated
+
+template<typename op_type> struct rel_mask_op_eval {};
+
+template<> struct rel_mask_op_eval<op_rel_lt_pre   > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (val <  x  ); } };
+template<> struct rel_mask_op_eval<op_rel_lt_post  > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (x   <  val); } };
+template<> struct rel_mask_op_eval<op_rel_gt_pre   > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (val >  x  ); } };
+template<> struct rel_mask_op_eval<op_rel_gt_post  > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (x   >  val); } };
+template<> struct rel_mask_op_eval<op_rel_lteq_pre > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (val <= x  ); } };
+template<> struct rel_mask_op_eval<op_rel_lteq_post> { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (x   <= val); } };
+template<> struct rel_mask_op_eval<op_rel_gteq_pre > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (val >= x  ); } };
+template<> struct rel_mask_op_eval<op_rel_gteq_post> { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (x   >= val); } };
+template<> struct rel_mask_op_eval<op_rel_eq       > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (x   == val); } };
+template<> struct rel_mask_op_eval<op_rel_noteq    > { template<typename eT> arma_inline static bool apply(const eT x, const eT val) { return (x   != val); } };
+
+
+template<typename glue_type> struct rel_mask_glue_eval {};
+
+template<> struct rel_mask_glue_eval<glue_rel_lt   > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a <  b); } };
+template<> struct rel_mask_glue_eval<glue_rel_gt   > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a >  b); } };
+template<> struct rel_mask_glue_eval<glue_rel_lteq > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a <= b); } };
+template<> struct rel_mask_glue_eval<glue_rel_gteq > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a >= b); } };
+template<> struct rel_mask_glue_eval<glue_rel_eq   > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a == b); } };
+template<> struct rel_mask_glue_eval<glue_rel_noteq> { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a != b); } };
+template<> struct rel_mask_glue_eval<glue_rel_and  > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a && b); } };
+template<> struct rel_mask_glue_eval<glue_rel_or   > { template<typename eT1, typename eT2> arma_inline static bool apply(const eT1 a, const eT2 b) { return (a || b); } };
+
+
+
+//! boolean views of expressions, with Proxy-like element access
+
+template<typename T1>
+class rel_mask_nonzero
+  {
+  public:
+  
+  typedef typename T1::elem_type eT;
+  
+  static const bool use_at = Proxy<T1>::use_at;
+  
+  const Proxy<T1> P;
+  
+  inline explicit rel_mask_nonzero(const T1& X);
+  
+  arma_inline uword get_n_rows() const { return P.get_n_rows(); }
+  arma_inline uword get_n_cols() const { return P.get_n_cols(); }
+  arma_inline uword get_n_elem() const { return P.get_n_elem(); }
+  
+  arma_inline bool operator[] (const uword i)                      const { return (P[i]          != eT(0)); }
+  arma_inline bool at         (const uword row, const uword col)   const { return (P.at(row,col) != eT(0)); }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return P.is_alias(X); }
+  };
+
+
+
+template<typename T1>
+class rel_mask_finite
+  {
+  public:
+  
+  typedef typename T1::elem_type eT;
+  
+  static const bool use_at = Proxy<T1>::use_at;
+  
+  const Proxy<T1> P;
+  
+  inline explicit rel_mask_finite(const T1& X);
+  
+  arma_inline uword get_n_rows() const { return P.get_n_rows(); }
+  arma_inline uword get_n_cols() const { return P.get_n_cols(); }
+  arma_inline uword get_n_elem() const { return P.get_n_elem(); }
+  
+  arma_inline bool operator[] (const uword i)                      const;
+  arma_inline bool at         (const uword row, const uword col)   const;
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return P.is_alias(X); }
+  };
+
+
+
+template<typename T1>
+class rel_mask_nonfinite
+  {
+  public:
+  
+  typedef typename T1::elem_type eT;
+  
+  static const bool use_at = Proxy<T1>::use_at;
+  
+  const Proxy<T1> P;
+  
+  inline explicit rel_mask_nonfinite(const T1& X);
+  
+  arma_inline uword get_n_rows() const { return P.get_n_rows(); }
+  arma_inline uword get_n_cols() const { return P.get_n_cols(); }
+  arma_inline uword get_n_elem() const { return P.get_n_elem(); }
+  
+  arma_inline bool operator[] (const uword i)                      const;
+  arma_inline bool at         (const uword row, const uword col)   const;
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return P.is_alias(X); }
+  };
+
+
+
+template<typename T1, typename op_type>
+class rel_mask_op
+  {
+  public:
+  
+  typedef typename T1::elem_type eT;
+  
+  static const bool use_at = Proxy<T1>::use_at;
+  
+  const Proxy<T1> P;
+  const eT        val;
+  
+  inline explicit rel_mask_op(const mtOp<uword, T1, op_type>& X);
+  
+  arma_inline uword get_n_rows() const { return P.get_n_rows(); }
+  arma_inline uword get_n_cols() const { return P.get_n_cols(); }
+  arma_inline uword get_n_elem() const { return P.get_n_elem(); }
+  
+  arma_inline bool operator[] (const uword i)                      const { return rel_mask_op_eval<op_type>::apply(eT(P[i]),          val); }
+  arma_inline bool at         (const uword row, const uword col)   const { return rel_mask_op_eval<op_type>::apply(eT(P.at(row,col)), val); }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return P.is_alias(X); }
+  };
+
+
+
+template<typename T1, typename T2, typename glue_type>
+class rel_mask_glue
+  {
+  public:
+  
+  typedef typename T1::elem_type eT1;
+  typedef typename T2::elem_type eT2;
+  
+  static const bool use_at = (Proxy<T1>::use_at || Proxy<T2>::use_at);
+  
+  const Proxy<T1> A;
+  const Proxy<T2> B;
+  
+  inline explicit rel_mask_glue(const mtGlue<uword, T1, T2, glue_type>& X);
+  
+  arma_inline uword get_n_rows() const { return A.get_n_rows(); }
+  arma_inline uword get_n_cols() const { return A.get_n_cols(); }
+  arma_inline uword get_n_elem() const { return A.get_n_elem(); }
+  
+  arma_inline bool operator[] (const uword i)                      const { return rel_mask_glue_eval<glue_type>::apply(eT1(A[i]),          eT2(B[i])         ); }
+  arma_inline bool at         (const uword row, const uword col)   const { return rel_mask_glue_eval<glue_type>::apply(eT1(A.at(row,col)), eT2(B.at(row,col))); }
+  
+  template<typename eT3>
+  arma_inline bool is_alias(const Mat<eT3>& X) const { return (A.is_alias(X) || B.is_alias(X)); }
+  };
+
+
+
+//! @}
@@ -0,0 +1,648 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup rel_mask
+//! @{
+
+
+
+//! store the indices of the true elements of F in ascending order;
+//! F is first evaluated into a bitmask, so that indices can be allocated with exactly the required size
+template<typename T1>
+inline
+uword
+rel_mask::find_all(Mat<uword>& indices, const T1& F)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_elem  = F.get_n_elem();
+  const uword n_words = (n_elem + n_word_bits - 1) / n_word_bits;
+  
+  podarray<uword> bits(n_words);
+  
+  uword* bits_mem = bits.memptr();
+  
+  if(T1::use_at)
+    {
+    const uword n_nz = rel_mask::eval_at(bits_mem, F);
+    
+    indices.set_size(n_nz, 1);
+    
+    rel_mask::get_indices(indices.memptr(), bits_mem, 0, n_words);
+    
+    return n_nz;
+    }
+  
+  const uword n_chunks  = rel_mask::n_chunks(n_elem);
+  const uword chunk_len = n_words / n_chunks;  // in words
+  
+  podarray<uword> counts(n_chunks);
+  
+  uword* counts_mem = counts.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_chunks)) if(n_chunks > 1)
+  #endif
+  for(uword chunk=0; chunk < n_chunks; ++chunk)
+    {
+    const uword w_start = chunk * chunk_len;
+    const uword w_end   = (chunk == (n_chunks-1)) ? n_words : (w_start + chunk_len);
+    
+    counts_mem[chunk] = rel_mask::eval(bits_mem, F, w_start, w_end);
+    }
+  
+  // stream compaction: the exclusive prefix sum of the counts is the output offset of each chunk
+  
+  const uword n_nz = scan_engine::exclusive_counts(counts_mem, n_chunks);
+  
+  indices.set_size(n_nz, 1);
+  
+  uword* indices_mem = indices.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_chunks)) if(n_chunks > 1)
+  #endif
+  for(uword chunk=0; chunk < n_chunks; ++chunk)
+    {
+    const uword w_start = chunk * chunk_len;
+    const uword w_end   = (chunk == (n_chunks-1)) ? n_words : (w_start + chunk_len);
+    
+    rel_mask::get_indices(indices_mem + counts_mem[chunk], bits_mem, w_start, w_end);
+    }
+  
+  return n_nz;
+  }
+
+
+
+//! count the elements for which F is true, without storing the bits
+template<typename T1>
+inline
+uword
+rel_mask::count(const T1& F)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(T1::use_at)  { return rel_mask::eval_at((uword*)(0), F); }
+  
+  const uword n_elem  = F.get_n_elem();
+  const uword n_words = (n_elem + n_word_bits - 1) / n_word_bits;
+  
+  const uword n_chunks  = rel_mask::n_chunks(n_elem);
+  const uword chunk_len = n_words / n_chunks;  // in words
+  
+  uword n_nz = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_chunks)) if(n_chunks > 1) reduction(+:n_nz)
+  #endif
+  for(uword chunk=0; chunk < n_chunks; ++chunk)
+    {
+    const uword w_start = chunk * chunk_len;
+    const uword w_end   = (chunk == (n_chunks-1)) ? n_words : (w_start + chunk_len);
+    
+    n_nz += rel_mask::eval((uword*)(0), F, w_start, w_end);
+    }
+  
+  return n_nz;
+  }
+
+
+
+//! number of chunks for evaluating an expression with n_elem elements; more than one only when using multiple threads
+inline
+uword
+rel_mask::n_chunks(const uword n_elem)
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(scan_engine::use_mp<uword>(n_elem))
+      {
+      const uword n_words = (n_elem + n_word_bits - 1) / n_word_bits;
+      
+      return (std::min)( uword(mp_thread_limit::get()), n_words );
+      }
+    }
+  #else
+    {
+    arma_ignore(n_elem);
+    }
+  #endif
+  
+  return uword(1);
+  }
+
+
+
+//! evaluate words [w_start, w_end) of F; the words are stored in bits, unless bits is null; returns the number of set bits;
+//! F must not use at()
+template<typename T1>
+arma_hot
+inline
+uword
+rel_mask::eval(uword* bits, const T1& F, const uword w_start, const uword w_end)
+  {
+  const uword n_elem = F.get_n_elem();
+  
+  uword n_nz = 0;
+  
+  for(uword w=w_start; w < w_end; ++w)
+    {
+    const uword start = w * n_word_bits;
+    
+    const uword word = rel_mask::pack(F, start, (std::min)(uword(n_word_bits), n_elem - start));
+    
+    if(bits != 0)  { bits[w] = word; }
+    
+    n_nz += rel_mask::popcount(word);
+    }
+  
+  return n_nz;
+  }
+
+
+
+//! evaluate all elements of F via at(); the words are stored in bits, unless bits is null; returns the number of set bits
+template<typename T1>
+arma_hot
+inline
+uword
+rel_mask::eval_at(uword* bits, const T1& F)
+  {
+  const uword n_elem = F.get_n_elem();
+  const uword n_rows = F.get_n_rows();
+  const uword n_cols = F.get_n_cols();
+  
+  if(bits != 0)  { arrayops::fill_zeros(bits, (n_elem + n_word_bits - 1) / n_word_bits); }
+  
+  uword n_nz = 0;
+  uword i    = 0;
+  
+  for(uword col=0; col < n_cols; ++col)
+  for(uword row=0; row < n_rows; ++row)
+    {
+    if(F.at(row,col))
+      {
+      if(bits != 0)  { bits[i / n_word_bits] |= uword(1) << (i % n_word_bits); }
+      
+      ++n_nz;
+      }
+    
+    ++i;
+    }
+  
+  return n_nz;
+  }
+
+
+
+//! pack elements [start, start+N) of F into one word; N must not exceed n_word_bits; F must not use at()
+template<typename T1>
+arma_hot
+arma_inline
+uword
+rel_mask::pack(const T1& F, const uword start, const uword N)
+  {
+  uword word = 0;
+  
+  if(N == n_word_bits)
+    {
+    u8 flags[n_word_bits];
+    
+    // separate compare and pack loops, so that the compiler can vectorise the compares
+    
+    for(uword b=0; b < n_word_bits; ++b)  { flags[b] = F[start + b] ? u8(1) : u8(0); }
+    
+    for(uword b=0; b < n_word_bits; ++b)  { word |= uword(flags[b]) << b; }
+    }
+  else
+    {
+    for(uword b=0; b < N; ++b)
+      {
+      if(F[start + b])  { word |= uword(1) << b; }
+      }
+    }
+  
+  return word;
+  }
+
+
+
+//! write the positions of the set bits in words [w_start, w_end) in ascending order; out must have room for all of them
+inline
+void
+rel_mask::get_indices(uword* out, const uword* bits, const uword w_start, const uword w_end)
+  {
+  for(uword w=w_start; w < w_end; ++w)
+    {
+    uword word = bits[w];
+    
+    const uword offset = w * n_word_bits;
+    
+    while(word != uword(0))
+      {
+      (*out) = offset + rel_mask::ctz(word);  ++out;
+      
+      word &= (word - uword(1));  // clear lowest set bit
+      }
+    }
+  }
+
+
+
+template<typename T1>
+inline
+bool
+rel_mask::any(const T1& F)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(T1::use_at == false)  { return rel_mask::any_range(F, 0, F.get_n_elem()); }
+  
+  const uword n_rows = F.get_n_rows();
+  const uword n_cols = F.get_n_cols();
+  
+  for(uword col=0; col < n_cols; ++col)
+  for(uword row=0; row < n_rows; ++row)
+    {
+    if(F.at(row,col))  { return true; }
+    }
+  
+  return false;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+rel_mask::all(const T1& F)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(T1::use_at == false)  { return rel_mask::all_range(F, 0, F.get_n_elem()); }
+  
+  const uword n_rows = F.get_n_rows();
+  const uword n_cols = F.get_n_cols();
+  
+  for(uword col=0; col < n_cols; ++col)
+  for(uword row=0; row < n_rows; ++row)
+    {
+    if(F.at(row,col) == false)  { return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! check whether any of the elements [start, start+N) of F is true;
+//! the elements are checked in blocks without branching, and the search stops at the first block containing a true element
+template<typename T1>
+arma_hot
+inline
+bool
+rel_mask::any_range(const T1& F, const uword start, const uword N)
+  {
+  const uword end = start + N;
+  
+  uword i = start;
+  
+  for(; (i + n_word_bits) <= end; i += n_word_bits)
+    {
+    u8 acc = u8(0);
+    
+    for(uword b=0; b < n_word_bits; ++b)  { acc |= F[i + b] ? u8(1) : u8(0); }
+    
+    if(acc != u8(0))  { return true; }
+    }
+  
+  for(; i < end; ++i)
+    {
+    if(F[i])  { return true; }
+    }
+  
+  return false;
+  }
+
+
+
+//! check whether all of the elements [start, start+N) of F are true; see any_range()
+template<typename T1>
+arma_hot
+inline
+bool
+rel_mask::all_range(const T1& F, const uword start, const uword N)
+  {
+  const uword end = start + N;
+  
+  uword i = start;
+  
+  for(; (i + n_word_bits) <= end; i += n_word_bits)
+    {
+    u8 acc = u8(1);
+    
+    for(uword b=0; b < n_word_bits; ++b)  { acc &= F[i + b] ? u8(1) : u8(0); }
+    
+    if(acc == u8(0))  { return false; }
+    }
+  
+  for(; i < end; ++i)
+    {
+    if(F[i] == false)  { return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! store the indices of at most the first k true elements of F; the remaining elements are not evaluated
+template<typename T1>
+inline
+uword
+rel_mask::find_first(Mat<uword>& indices, const T1& F, const uword k)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_elem = F.get_n_elem();
+  const uword n_max  = (std::min)(k, n_elem);
+  
+  Mat<uword> tmp(n_max, 1);
+  
+  uword* tmp_mem = tmp.memptr();
+  uword  count   = 0;
+  
+  if(T1::use_at == false)
+    {
+    for(uword start=0; (start < n_elem) && (count < n_max); start += n_word_bits)
+      {
+      uword word = rel_mask::pack(F, start, (std::min)(uword(n_word_bits), n_elem - start));
+      
+      while( (word != uword(0)) && (count < n_max) )
+        {
+        tmp_mem[count] = start + rel_mask::ctz(word);  ++count;
+        
+        word &= (word - uword(1));  // clear lowest set bit
+        }
+      }
+    }
+  else
+    {
+    const uword n_rows = F.get_n_rows();
+    const uword n_cols = F.get_n_cols();
+    
+    for(uword col=0; (col < n_cols) && (count < n_max); ++col)
+    for(uword row=0; (row < n_rows) && (count < n_max); ++row)
+      {
+      if(F.at(row,col))  { tmp_mem[count] = col*n_rows + row;  ++count; }
+      }
+    }
+  
+  indices.steal_mem_col(tmp, count);
+  
+  return count;
+  }
+
+
+
+//! store the indices of at most the last k true elements of F, in ascending order;
+//! F is evaluated from the end, and the remaining elements are not evaluated
+template<typename T1>
+inline
+uword
+rel_mask::find_last(Mat<uword>& indices, const T1& F, const uword k)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_elem = F.get_n_elem();
+  const uword n_max  = (std::min)(k, n_elem);
+  
+  Mat<uword> tmp(n_max, 1);
+  
+  uword* tmp_mem = tmp.memptr();
+  uword  count   = 0;
+  
+  // the indices are stored from the end of tmp, and moved to the start afterwards
+  
+  if(T1::use_at == false)
+    {
+    const uword n_words = (n_elem + n_word_bits - 1) / n_word_bits;
+    
+    for(uword w=n_words; (w > 0) && (count < n_max); --w)
+      {
+      const uword start = (w-1) * n_word_bits;
+      
+      uword word = rel_mask::pack(F, start, (std::min)(uword(n_word_bits), n_elem - start));
+      
+      while( (word != uword(0)) && (count < n_max) )
+        {
+        const uword pos = rel_mask::msb(word);
+        
+        ++count;  tmp_mem[n_max - count] = start + pos;
+        
+        word &= ~(uword(1) << pos);
+        }
+      }
+    }
+  else
+    {
+    const uword n_rows = F.get_n_rows();
+    const uword n_cols = F.get_n_cols();
+    
+    for(uword col=n_cols; (col > 0) && (count < n_max); --col)
+    for(uword row=n_rows; (row > 0) && (count < n_max); --row)
+      {
+      if(F.at(row-1,col-1))  { ++count;  tmp_mem[n_max - count] = (col-1)*n_rows + (row-1); }
+      }
+    }
+  
+  if( (count > 0) && (count < n_max) )
+    {
+    for(uword i=0; i < count; ++i)  { tmp_mem[i] = tmp_mem[n_max - count + i]; }
+    }
+  
+  indices.steal_mem_col(tmp, count);
+  
+  return count;
+  }
+
+
+
+arma_inline
+uword
+rel_mask::popcount(uword word)
+  {
+  #if defined(__GNUG__) || defined(__clang__)
+    {
+    return uword( __builtin_popcountll(word) );
+    }
+  #else
+    {
+    uword n = 0;
+    
+    while(word != uword(0))  { word &= (word - uword(1));  ++n; }
+    
+    return n;
+    }
+  #endif
+  }
+
+
+
+//! number of trailing zero bits; word must be non-zero
+arma_inline
+uword
+rel_mask::ctz(const uword word)
+  {
+  #if defined(__GNUG__) || defined(__clang__)
+    {
+    return uword( __builtin_ctzll(word) );
+    }
+  #else
+    {
+    uword n = 0;
+    
+    while( ((word >> n) & uword(1)) == uword(0) )  { ++n; }
+    
+    return n;
+    }
+  #endif
+  }
+
+
+
+//! position of the highest set bit; word must be non-zero
+arma_inline
+uword
+rel_mask::msb(const uword word)
+  {
+  #if defined(__GNUG__) || defined(__clang__)
+    {
+    return uword(8*sizeof(unsigned long long) - 1) - uword( __builtin_clzll(word) );
+    }
+  #else
+    {
+    uword n = n_word_bits - 1;
+    
+    while( ((word >> n) & uword(1)) == uword(0) )  { --n; }
+    
+    return n;
+    }
+  #endif
+  }
+
+
+
+//
+
+
+
+template<typename T1>
+inline
+rel_mask_nonzero<T1>::rel_mask_nonzero(const T1& X)
+  : P(X)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1>
+inline
+rel_mask_finite<T1>::rel_mask_finite(const T1& X)
+  : P(X)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1>
+arma_inline
+bool
+rel_mask_finite<T1>::operator[] (const uword i) const
+  {
+  return arma_isfinite(P[i]);
+  }
+
+
+
+template<typename T1>
+arma_inline
+bool
+rel_mask_finite<T1>::at(const uword row, const uword col) const
+  {
+  return arma_isfinite(P.at(row,col));
+  }
+
+
+
+template<typename T1>
+inline
+rel_mask_nonfinite<T1>::rel_mask_nonfinite(const T1& X)
+  : P(X)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1>
+arma_inline
+bool
+rel_mask_nonfinite<T1>::operator[] (const uword i) const
+  {
+  return (arma_isfinite(P[i]) == false);
+  }
+
+
+
+template<typename T1>
+arma_inline
+bool
+rel_mask_nonfinite<T1>::at(const uword row, const uword col) const
+  {
+  return (arma_isfinite(P.at(row,col)) == false);
+  }
+
+
+
+template<typename T1, typename op_type>
+inline
+rel_mask_op<T1, op_type>::rel_mask_op(const mtOp<uword, T1, op_type>& X)
+  : P  (X.m)
+  , val(X.aux)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename T1, typename T2, typename glue_type>
+inline
+rel_mask_glue<T1, T2, glue_type>::rel_mask_glue(const mtGlue<uword, T1, T2, glue_type>& X)
+  : A(X.A)
+  , B(X.B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_assert_same_size(A, B, "relational operator");
+  }
+
+
+
+//! @}
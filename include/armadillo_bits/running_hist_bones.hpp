@@ -0,0 +1,80 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_hist
+//! @{
+
+
+
+//! Class for accumulating a histogram of a continuously sampled process / signal.
+//! The bins are equally spaced, or logarithmically spaced, between fixed limits;
+//! samples below or above the limits are counted separately.
+//! Instances with the same bins can be merged, allowing samples to be processed in separate threads.
+template<typename eT>
+class running_hist
+  {
+  public:
+  
+  inline ~running_hist();
+  inline  running_hist();
+  inline  running_hist(const uword in_n_bins, const eT in_min_val, const eT in_max_val, const bool in_log_bins = false);
+  
+  inline void operator() (const eT sample);
+  
+  template<typename T1> inline void operator() (const Base<eT,T1>& X);
+  
+  inline void merge(const running_hist& in_rh);
+  
+  inline void reset();
+  
+  inline const uvec& counts() const;
+  
+  inline uword underflow() const;
+  inline uword overflow()  const;
+  inline uword count()     const;
+  
+  inline Col<eT> edges()   const;
+  inline Col<eT> centers() const;
+  
+  inline eT quantile(const eT P) const;
+  
+  inline bool save(const std::string name, const file_type type = arma_binary, const bool print_status = true) const;
+  inline bool load(const std::string name, const file_type type = auto_detect, const bool print_status = true);
+  
+  
+  private:
+  
+  arma_aligned uword n_bins;
+  
+  arma_aligned eT   min_val;
+  arma_aligned eT   max_val;
+  arma_aligned bool log_bins;
+  
+  arma_aligned eT offset;
+  arma_aligned eT scale;
+  
+  arma_aligned uvec  bin_counts;
+  arma_aligned uword n_underflow;
+  arma_aligned uword n_overflow;
+  
+  inline void init(const uword in_n_bins, const eT in_min_val, const eT in_max_val, const bool in_log_bins);
+  
+  arma_inline uword bin_index(const eT val) const;
+  };
+
+
+
+//! @}
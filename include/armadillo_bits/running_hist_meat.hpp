@@ -0,0 +1,427 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_hist
+//! @{
+
+
+
+template<typename eT>
+inline
+running_hist<eT>::~running_hist()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+running_hist<eT>::running_hist()
+  : n_bins(0)
+  , min_val(eT(0))
+  , max_val(eT(0))
+  , log_bins(false)
+  , offset(eT(0))
+  , scale(eT(0))
+  , n_underflow(0)
+  , n_overflow(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_real<eT>::value == false ));
+  }
+
+
+
+template<typename eT>
+inline
+running_hist<eT>::running_hist(const uword in_n_bins, const eT in_min_val, const eT in_max_val, const bool in_log_bins)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_real<eT>::value == false ));
+  
+  init(in_n_bins, in_min_val, in_max_val, in_log_bins);
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_hist<eT>::init(const uword in_n_bins, const eT in_min_val, const eT in_max_val, const bool in_log_bins)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (in_n_bins == 0),                            "running_hist(): number of bins must be greater than zero"            );
+  arma_debug_check( ((in_min_val < in_max_val) == false),        "running_hist(): min_val must be less than max_val"                   );
+  arma_debug_check( (in_log_bins && (in_min_val <= eT(0))),      "running_hist(): min_val must be greater than zero for logarithmic bins" );
+  
+  n_bins   = in_n_bins;
+  min_val  = in_min_val;
+  max_val  = in_max_val;
+  log_bins = in_log_bins;
+  
+  offset = (log_bins) ? eT(std::log(min_val))                             : min_val;
+  scale  = (log_bins) ? eT(n_bins) / eT(std::log(max_val) - std::log(min_val)) : eT(n_bins) / (max_val - min_val);
+  
+  bin_counts.zeros(n_bins);
+  
+  n_underflow = 0;
+  n_overflow  = 0;
+  }
+
+
+
+//! index of the bin containing the given value:
+//! 0 for values below min_val, n_bins+1 for values above max_val, and n_bins+2 for NaN
+template<typename eT>
+arma_inline
+uword
+running_hist<eT>::bin_index(const eT val) const
+  {
+  if(val <  min_val)  { return 0;        }
+  if(val >  max_val)  { return n_bins+1; }
+  if(val != val    )  { return n_bins+2; }
+  
+  const eT pos = ( ((log_bins) ? eT(std::log(val)) : val) - offset ) * scale;
+  
+  const uword index = (pos > eT(0)) ? uword(pos) : uword(0);
+  
+  return (index < n_bins) ? (index + 1) : n_bins;
+  }
+
+
+
+//! update the histogram using the given sample; NaN samples are ignored
+template<typename eT>
+inline
+void
+running_hist<eT>::operator() (const eT sample)
+  {
+  if(n_bins == 0)  { return; }
+  
+  const uword index = bin_index(sample);
+  
+       if(index == 0       )  { ++n_underflow;            }
+  else if(index <= n_bins  )  { ++bin_counts[index-1];    }
+  else if(index == n_bins+1)  { ++n_overflow;             }
+  }
+
+
+
+//! update the histogram using all elements of the given matrix or vector;
+//! if OpenMP is enabled, a large number of samples is processed in parallel,
+//! with each thread accumulating its own histogram
+template<typename eT>
+template<typename T1>
+inline
+void
+running_hist<eT>::operator() (const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const eT*   X_mem  = U.M.memptr();
+  const uword n_elem = U.M.n_elem;
+  
+  if(n_bins == 0)  { return; }
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const uword n_counts = n_bins + 3;
+      
+      const uword n_threads_max = uword(mp_thread_limit::get());
+      const uword n_threads     = (std::min)(n_threads_max, (std::max)(uword(1), n_elem / n_counts));
+      const uword chunk_size    = n_elem / n_threads;
+      
+      podarray<uword> thread_counts(n_threads * n_counts);
+      
+      thread_counts.zeros();
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        uword* counts_t = thread_counts.memptr() + t*n_counts;
+        
+        const uword start = t*chunk_size;
+        const uword endp1 = ((t+1) < n_threads) ? (start + chunk_size) : n_elem;
+        
+        for(uword i=start; i < endp1; ++i)  { ++counts_t[ bin_index(X_mem[i]) ]; }
+        }
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword* counts_t = thread_counts.memptr() + t*n_counts;
+        
+        n_underflow += counts_t[0];
+        n_overflow  += counts_t[n_bins+1];
+        
+        arrayops::inplace_plus(bin_counts.memptr(), counts_t + 1, n_bins);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword i=0; i < n_elem; ++i)  { (*this).operator()(X_mem[i]); }
+    }
+  }
+
+
+
+//! combine the histogram with the histogram in another instance, which must have the same bins
+template<typename eT>
+inline
+void
+running_hist<eT>::merge(const running_hist<eT>& in_rh)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check
+    (
+    ( (n_bins != in_rh.n_bins) || (min_val != in_rh.min_val) || (max_val != in_rh.max_val) || (log_bins != in_rh.log_bins) ),
+    "running_hist::merge(): incompatible bins"
+    );
+  
+  if(this == &in_rh)
+    {
+    n_underflow *= 2;
+    n_overflow  *= 2;
+    bin_counts  *= 2;
+    
+    return;
+    }
+  
+  n_underflow += in_rh.n_underflow;
+  n_overflow  += in_rh.n_overflow;
+  bin_counts  += in_rh.bin_counts;
+  }
+
+
+
+//! set all counts to zero, keeping the bins
+template<typename eT>
+inline
+void
+running_hist<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  bin_counts.zeros();
+  
+  n_underflow = 0;
+  n_overflow  = 0;
+  }
+
+
+
+template<typename eT>
+inline
+const uvec&
+running_hist<eT>::counts() const
+  {
+  return bin_counts;
+  }
+
+
+
+//! number of samples below min_val
+template<typename eT>
+inline
+uword
+running_hist<eT>::underflow() const
+  {
+  return n_underflow;
+  }
+
+
+
+//! number of samples above max_val
+template<typename eT>
+inline
+uword
+running_hist<eT>::overflow() const
+  {
+  return n_overflow;
+  }
+
+
+
+//! number of samples so far (excluding NaN samples)
+template<typename eT>
+inline
+uword
+running_hist<eT>::count() const
+  {
+  return accu(bin_counts) + n_underflow + n_overflow;
+  }
+
+
+
+template<typename eT>
+inline
+Col<eT>
+running_hist<eT>::edges() const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<eT> out(n_bins + 1);
+  
+  for(uword i=0; i <= n_bins; ++i)
+    {
+    const eT pos = offset + eT(i) / scale;
+    
+    out[i] = (log_bins) ? eT(std::exp(pos)) : pos;
+    }
+  
+  if(n_bins > 0)
+    {
+    out[0]      = min_val;
+    out[n_bins] = max_val;
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+Col<eT>
+running_hist<eT>::centers() const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<eT> out(n_bins);
+  
+  for(uword i=0; i < n_bins; ++i)
+    {
+    const eT pos = offset + (eT(i) + eT(0.5)) / scale;
+    
+    out[i] = (log_bins) ? eT(std::exp(pos)) : pos;
+    }
+  
+  return out;
+  }
+
+
+
+//! approximate quantile at probability P, found by interpolating within the bin that contains it;
+//! quantiles within the underflow or overflow counts are clamped to min_val or max_val
+template<typename eT>
+inline
+eT
+running_hist<eT>::quantile(const eT P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((P < eT(0)) || (P > eT(1))), "running_hist::quantile(): parameter 'P' must be in the [0,1] interval" );
+  
+  const uword N = count();
+  
+  if(N == 0)  { return Datum<eT>::nan; }
+  
+  const eT target = P * eT(N);
+  
+  eT cumulative = eT(n_underflow);
+  
+  if( (target <= cumulative) && (n_underflow > 0) )  { return min_val; }
+  
+  for(uword i=0; i < n_bins; ++i)
+    {
+    const eT bin_count = eT(bin_counts[i]);
+    
+    if( (bin_count > eT(0)) && (target <= (cumulative + bin_count)) )
+      {
+      const eT pos = offset + (eT(i) + (target - cumulative) / bin_count) / scale;
+      
+      return (log_bins) ? eT(std::exp(pos)) : pos;
+      }
+    
+    cumulative += bin_count;
+    }
+  
+  return max_val;
+  }
+
+
+
+//! save the state via a column vector:
+//! number of bins, min_val, max_val, log_bins flag, underflow count, overflow count, followed by the bin counts
+template<typename eT>
+inline
+bool
+running_hist<eT>::save(const std::string name, const file_type type, const bool print_status) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<double> X(n_bins + 6);
+  
+  X[0] = double(n_bins);
+  X[1] = double(min_val);
+  X[2] = double(max_val);
+  X[3] = (log_bins) ? double(1) : double(0);
+  X[4] = double(n_underflow);
+  X[5] = double(n_overflow);
+  
+  for(uword i=0; i < n_bins; ++i)  { X[i+6] = double(bin_counts[i]); }
+  
+  return X.save(name, type, print_status);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+running_hist<eT>::load(const std::string name, const file_type type, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<double> X;
+  
+  bool load_okay = X.load(name, type, print_status);
+  
+  if(load_okay)
+    {
+    load_okay = (X.n_cols == 1) && (X.n_rows > 6) && (X[0] == double(X.n_rows - 6)) && (X[1] < X[2]) && ((X[3] == double(0)) || (X[1] > double(0)));
+    
+    if(load_okay)
+      {
+      init( uword(X[0]), eT(X[1]), eT(X[2]), (X[3] != double(0)) );
+      
+      n_underflow = uword(X[4]);
+      n_overflow  = uword(X[5]);
+      
+      for(uword i=0; i < n_bins; ++i)  { bin_counts[i] = uword(X[i+6]); }
+      }
+    else
+      {
+      if(print_status)  { arma_debug_warn("running_hist::load(): incompatible data in ", name); }
+      }
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! @}
@@ -0,0 +1,84 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_quantile
+//! @{
+
+
+
+//! Class for estimating quantiles of a continuously sampled process / signal,
+//! using a bounded amount of memory.
+//! The samples are summarised via a merging t-digest, where the number of
+//! centroids is proportional to the compression parameter.
+//! Instances can be merged, allowing samples to be processed in separate threads.
+template<typename eT>
+class running_quantile
+  {
+  public:
+  
+  inline ~running_quantile();
+  inline explicit running_quantile(const uword in_compression = 100);
+  
+  inline void operator() (const eT sample);
+  
+  template<typename T1> inline void operator() (const Base<eT,T1>& X);
+  
+  inline void merge(const running_quantile& in_rq);
+  
+  inline void reset();
+  
+  inline eT quantile(const eT P) const;
+  
+  template<typename T1> inline Mat<eT> quantile(const Base<eT,T1>& P) const;
+  
+  inline eT median() const;
+  
+  inline eT min()   const;
+  inline eT max()   const;
+  inline eT count() const;
+  
+  inline uword get_compression() const;
+  
+  inline bool save(const std::string name, const file_type type = arma_binary, const bool print_status = true) const;
+  inline bool load(const std::string name, const file_type type = auto_detect, const bool print_status = true);
+  
+  
+  private:
+  
+  arma_aligned uword compression;
+  
+  arma_aligned uword n_centroids;
+  arma_aligned uword n_buffered;
+  
+  arma_aligned eT min_val;
+  arma_aligned eT max_val;
+  
+  arma_aligned podarray<eT> c_mean;
+  arma_aligned podarray<eT> c_weight;
+  arma_aligned podarray<eT> buffer;
+  
+  inline void init(const uword in_compression);
+  
+  inline void compress(const running_quantile* in_rq = NULL);
+  
+  inline eT q_limit(const eT q) const;
+  
+  inline eT quantile_worker(const eT P) const;
+  };
+
+
+
+//! @}
@@ -0,0 +1,529 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_quantile
+//! @{
+
+
+
+template<typename eT>
+inline
+running_quantile<eT>::~running_quantile()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+running_quantile<eT>::running_quantile(const uword in_compression)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_real<eT>::value == false ));
+  
+  init(in_compression);
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_quantile<eT>::init(const uword in_compression)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (in_compression < 2), "running_quantile(): compression must be at least 2" );
+  
+  compression = in_compression;
+  
+  // the merging procedure produces at most compression+2 centroids
+  
+  c_mean.set_size(  2*compression + 8);
+  c_weight.set_size(2*compression + 8);
+  buffer.set_size(  5*compression    );
+  
+  reset();
+  }
+
+
+
+//! update the estimates using the given sample
+template<typename eT>
+inline
+void
+running_quantile<eT>::operator() (const eT sample)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( arma_isfinite(sample) == false )
+    {
+    arma_debug_warn("running_quantile: sample ignored as it is non-finite" );
+    return;
+    }
+  
+  if(n_buffered >= buffer.n_elem)  { compress(); }
+  
+  buffer[n_buffered] = sample;
+  ++n_buffered;
+  
+  if( (n_centroids == 0) && (n_buffered == 1) )
+    {
+    min_val = sample;
+    max_val = sample;
+    }
+  else
+    {
+    if(sample < min_val)  { min_val = sample; }
+    if(sample > max_val)  { max_val = sample; }
+    }
+  }
+
+
+
+//! update the estimates using all elements of the given matrix or vector
+template<typename eT>
+template<typename T1>
+inline
+void
+running_quantile<eT>::operator() (const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const eT*   X_mem  = U.M.memptr();
+  const uword n_elem = U.M.n_elem;
+  
+  bool has_non_finite = false;
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT sample = X_mem[i];
+    
+    if( arma_isfinite(sample) == false )  { has_non_finite = true; continue; }
+    
+    if(n_buffered >= buffer.n_elem)  { compress(); }
+    
+    buffer[n_buffered] = sample;
+    ++n_buffered;
+    
+    if( (n_centroids == 0) && (n_buffered == 1) )
+      {
+      min_val = sample;
+      max_val = sample;
+      }
+    else
+      {
+      if(sample < min_val)  { min_val = sample; }
+      if(sample > max_val)  { max_val = sample; }
+      }
+    }
+  
+  if(has_non_finite)  { arma_debug_warn("running_quantile: non-finite samples ignored" ); }
+  }
+
+
+
+//! combine the estimates with the estimates in another instance
+template<typename eT>
+inline
+void
+running_quantile<eT>::merge(const running_quantile<eT>& in_rq)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( (in_rq.n_centroids + in_rq.n_buffered) == 0 )  { return; }
+  
+  if(this == &in_rq)
+    {
+    const running_quantile<eT> tmp(in_rq);
+    
+    (*this).merge(tmp);
+    
+    return;
+    }
+  
+  if( (n_centroids + n_buffered) == 0 )
+    {
+    min_val = in_rq.min_val;
+    max_val = in_rq.max_val;
+    }
+  else
+    {
+    if(in_rq.min_val < min_val)  { min_val = in_rq.min_val; }
+    if(in_rq.max_val > max_val)  { max_val = in_rq.max_val; }
+    }
+  
+  compress(&in_rq);
+  }
+
+
+
+//! set all estimates to zero
+template<typename eT>
+inline
+void
+running_quantile<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  n_centroids = 0;
+  n_buffered  = 0;
+  
+  min_val = eT(0);
+  max_val = eT(0);
+  }
+
+
+
+//! upper limit of the quantile spanned by a centroid which starts at quantile q,
+//! derived from the scale function k(q) = (compression / (2 pi)) asin(2q - 1)
+template<typename eT>
+inline
+eT
+running_quantile<eT>::q_limit(const eT q) const
+  {
+  const eT delta = eT(compression);
+  
+  const eT k = (delta / (eT(2) * Datum<eT>::pi)) * std::asin( (std::min)( eT(1), (std::max)( eT(-1), eT(2)*q - eT(1) ) ) ) + eT(1);
+  
+  if( k >= (delta / eT(4)) )  { return eT(1); }
+  
+  return ( std::sin( k * (eT(2) * Datum<eT>::pi) / delta ) + eT(1) ) / eT(2);
+  }
+
+
+
+//! merge the buffered samples (and optionally the contents of another instance) into the centroids
+template<typename eT>
+inline
+void
+running_quantile<eT>::compress(const running_quantile<eT>* in_rq)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword in_n_centroids = (in_rq != NULL) ? in_rq->n_centroids : uword(0);
+  const uword in_n_buffered  = (in_rq != NULL) ? in_rq->n_buffered  : uword(0);
+  
+  const uword N = n_centroids + n_buffered + in_n_centroids + in_n_buffered;
+  
+  if(N == 0)  { return; }
+  
+  podarray<eT> means(N);
+  podarray<eT> weights(N);
+  
+  uword count = 0;
+  
+  for(uword i=0; i < n_centroids; ++i)  { means[count] = c_mean[i]; weights[count] = c_weight[i]; ++count; }
+  for(uword i=0; i < n_buffered;  ++i)  { means[count] = buffer[i]; weights[count] = eT(1);       ++count; }
+  
+  if(in_rq != NULL)
+    {
+    for(uword i=0; i < in_n_centroids; ++i)  { means[count] = in_rq->c_mean[i]; weights[count] = in_rq->c_weight[i]; ++count; }
+    for(uword i=0; i < in_n_buffered;  ++i)  { means[count] = in_rq->buffer[i]; weights[count] = eT(1);              ++count; }
+    }
+  
+  podarray<uword> indices(N);
+  
+  sort_engine::sort_index(indices.memptr(), means.memptr(), N, uword(0), true);
+  
+  eT total_weight = eT(0);
+  
+  for(uword i=0; i < N; ++i)  { total_weight += weights[i]; }
+  
+  eT cur_mean   = means[  indices[0] ];
+  eT cur_weight = weights[indices[0] ];
+  
+  eT weight_so_far = eT(0);
+  eT weight_limit  = total_weight * q_limit(eT(0));
+  
+  n_centroids = 0;
+  n_buffered  = 0;
+  
+  for(uword i=1; i < N; ++i)
+    {
+    const eT val_mean   = means[  indices[i] ];
+    const eT val_weight = weights[indices[i] ];
+    
+    if( (weight_so_far + cur_weight + val_weight) <= weight_limit )
+      {
+      cur_weight += val_weight;
+      cur_mean   += (val_mean - cur_mean) * (val_weight / cur_weight);
+      }
+    else
+      {
+      c_mean[n_centroids]   = cur_mean;
+      c_weight[n_centroids] = cur_weight;
+      ++n_centroids;
+      
+      weight_so_far += cur_weight;
+      weight_limit   = total_weight * q_limit(weight_so_far / total_weight);
+      
+      cur_mean   = val_mean;
+      cur_weight = val_weight;
+      }
+    }
+  
+  c_mean[n_centroids]   = cur_mean;
+  c_weight[n_centroids] = cur_weight;
+  ++n_centroids;
+  }
+
+
+
+template<typename eT>
+inline
+eT
+running_quantile<eT>::quantile_worker(const eT P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  if(n_centroids == 0)  { return Datum<eT>::nan; }
+  
+  eT total_weight = eT(0);
+  
+  for(uword i=0; i < n_centroids; ++i)  { total_weight += c_weight[i]; }
+  
+  const eT target = P * total_weight;
+  
+  // each centroid is taken to be located at the middle of the weight it spans
+  
+  const eT first_pos = c_weight[0] / eT(2);
+  const eT last_pos  = total_weight - c_weight[n_centroids-1] / eT(2);
+  
+  if(target <= first_pos)
+    {
+    return (first_pos > eT(0)) ? ( min_val + (c_mean[0] - min_val) * (target / first_pos) ) : c_mean[0];
+    }
+  
+  if(target >= last_pos)
+    {
+    const eT last_mean = c_mean[n_centroids-1];
+    const eT denom     = total_weight - last_pos;
+    
+    return (denom > eT(0)) ? ( last_mean + (max_val - last_mean) * ((target - last_pos) / denom) ) : last_mean;
+    }
+  
+  eT pos = first_pos;
+  
+  for(uword i=0; (i+1) < n_centroids; ++i)
+    {
+    const eT next_pos = pos + (c_weight[i] + c_weight[i+1]) / eT(2);
+    
+    if(target < next_pos)
+      {
+      const eT alpha = (target - pos) / (next_pos - pos);
+      
+      return c_mean[i] + alpha * (c_mean[i+1] - c_mean[i]);
+      }
+    
+    pos = next_pos;
+    }
+  
+  return c_mean[n_centroids-1];
+  }
+
+
+
+//! estimate of the quantile at probability P
+template<typename eT>
+inline
+eT
+running_quantile<eT>::quantile(const eT P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((P < eT(0)) || (P > eT(1))), "running_quantile::quantile(): parameter 'P' must be in the [0,1] interval" );
+  
+  if(n_buffered == 0)  { return quantile_worker(P); }
+  
+  running_quantile<eT> tmp(*this);
+  
+  tmp.compress();
+  
+  return tmp.quantile_worker(P);
+  }
+
+
+
+//! estimates of the quantiles at each probability in P
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+running_quantile<eT>::quantile(const Base<eT,T1>& P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(P.get_ref());
+  
+  const Mat<eT>& PP = U.M;
+  
+  arma_debug_check( ((PP.is_vec() == false) && (PP.is_empty() == false)), "running_quantile::quantile(): parameter 'P' must be a vector" );
+  
+  arma_debug_check( (PP.is_empty() == false) && ((PP.min() < eT(0)) || (PP.max() > eT(1))), "running_quantile::quantile(): values in 'P' must be in the [0,1] interval" );
+  
+  running_quantile<eT> tmp(*this);
+  
+  tmp.compress();
+  
+  Mat<eT> out(PP.n_rows, PP.n_cols);
+  
+  for(uword i=0; i < PP.n_elem; ++i)  { out[i] = tmp.quantile_worker(PP[i]); }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+eT
+running_quantile<eT>::median() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return (*this).quantile( eT(0.5) );
+  }
+
+
+
+template<typename eT>
+inline
+eT
+running_quantile<eT>::min() const
+  {
+  return min_val;
+  }
+
+
+
+template<typename eT>
+inline
+eT
+running_quantile<eT>::max() const
+  {
+  return max_val;
+  }
+
+
+
+//! number of samples so far
+template<typename eT>
+inline
+eT
+running_quantile<eT>::count() const
+  {
+  eT total_weight = eT(n_buffered);
+  
+  for(uword i=0; i < n_centroids; ++i)  { total_weight += c_weight[i]; }
+  
+  return total_weight;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+running_quantile<eT>::get_compression() const
+  {
+  return compression;
+  }
+
+
+
+//! save the state via a matrix with 2 rows:
+//! the first two columns hold the compression parameter, count, and min/max values;
+//! each subsequent column holds the mean and weight of a centroid
+template<typename eT>
+inline
+bool
+running_quantile<eT>::save(const std::string name, const file_type type, const bool print_status) const
+  {
+  arma_extra_debug_sigprint();
+  
+  running_quantile<eT> tmp(*this);
+  
+  tmp.compress();
+  
+  Mat<double> X(2, tmp.n_centroids + 2);
+  
+  X.at(0,0) = double(tmp.compression);
+  X.at(1,0) = double(tmp.count());
+  X.at(0,1) = double(tmp.min_val);
+  X.at(1,1) = double(tmp.max_val);
+  
+  for(uword i=0; i < tmp.n_centroids; ++i)
+    {
+    X.at(0,i+2) = double(tmp.c_mean[i]);
+    X.at(1,i+2) = double(tmp.c_weight[i]);
+    }
+  
+  return X.save(name, type, print_status);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+running_quantile<eT>::load(const std::string name, const file_type type, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<double> X;
+  
+  bool load_okay = X.load(name, type, print_status);
+  
+  if(load_okay)
+    {
+    const double in_compression = (X.n_rows == 2 && X.n_cols >= 2) ? X.at(0,0) : double(0);
+    
+    const uword in_n_centroids = X.n_cols - 2;
+    
+    load_okay = (in_compression >= double(2)) && (in_compression == std::floor(in_compression)) && (in_n_centroids <= (2*uword(in_compression) + 8));
+    
+    if(load_okay)
+      {
+      init( uword(in_compression) );
+      
+      min_val = eT(X.at(0,1));
+      max_val = eT(X.at(1,1));
+      
+      for(uword i=0; i < in_n_centroids; ++i)
+        {
+        c_mean[i]   = eT(X.at(0,i+2));
+        c_weight[i] = eT(X.at(1,i+2));
+        }
+      
+      n_centroids = in_n_centroids;
+      }
+    else
+      {
+      if(print_status)  { arma_debug_warn("running_quantile::load(): incompatible data in ", name); }
+      }
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! @}
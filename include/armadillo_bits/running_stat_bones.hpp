@@ -30,6 +30,9 @@ class arma_counter
   inline const arma_counter& operator++();
   inline void                operator++(int);
   
+  inline const arma_counter& operator+=(const uword         n);
+  inline const arma_counter& operator+=(const arma_counter& in_counter);
+  
   inline void reset();
   inline eT   value()         const;
   inline eT   value_plus_1()  const;
@@ -62,6 +65,11 @@ class running_stat
   inline void operator() (const T sample);
   inline void operator() (const std::complex<T>& sample);
   
+  template<typename T1> inline void operator() (const Base<              T, T1>& X);
+  template<typename T1> inline void operator() (const Base<std::complex<T>, T1>& X);
+  
+  inline void merge(const running_stat& in_rs);
+  
   inline void reset();
   
   inline eT mean() const;
@@ -112,6 +120,24 @@ class running_stat_aux
   
   template<typename eT>
   inline static void update_stats(running_stat<eT>& x, const eT& sample, const typename arma_cx_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void batch_update(running_stat<eT>& x, const Mat<eT>& X);
+  
+  template<typename eT, typename eT2>
+  inline static void batch_update(running_stat<eT>& x, const Mat<eT2>& X);
+  
+  template<typename eT>
+  inline static void batch_stats(running_stat<eT>& x, const eT* X_mem, const uword n_elem, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void batch_stats(running_stat<eT>& x, const eT* X_mem, const uword n_elem, const typename arma_cx_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_cx_only<eT>::result* junk = 0);
   };
 
 
@@ -69,6 +69,43 @@ arma_counter<eT>::operator++(int)
 
 
 
+template<typename eT>
+inline
+const arma_counter<eT>&
+arma_counter<eT>::operator+=(const uword n)
+  {
+  if(n <= (ARMA_MAX_UWORD - i_count))
+    {
+    i_count += n;
+    }
+  else
+    {
+    d_count += eT(ARMA_MAX_UWORD);
+    i_count  = n - (ARMA_MAX_UWORD - i_count);
+    }
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+const arma_counter<eT>&
+arma_counter<eT>::operator+=(const arma_counter<eT>& in_counter)
+  {
+  const eT    in_d_count = in_counter.d_count;
+  const uword in_i_count = in_counter.i_count;
+  
+  d_count += in_d_count;
+  
+  (*this) += in_i_count;
+  
+  return *this;
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -190,6 +227,60 @@ running_stat<eT>::operator() (const std::complex< typename running_stat<eT>::T >
 
 
 
+//! update statistics to reflect all elements of given matrix
+template<typename eT>
+template<typename T1>
+inline
+void
+running_stat<eT>::operator() (const Base<typename running_stat<eT>::T, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  running_stat_aux::batch_update(*this, tmp.M);
+  }
+
+
+
+//! update statistics to reflect all elements of given matrix (version for complex numbers)
+template<typename eT>
+template<typename T1>
+inline
+void
+running_stat<eT>::operator() (const Base<std::complex<typename running_stat<eT>::T>, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  running_stat_aux::batch_update(*this, tmp.M);
+  }
+
+
+
+//! combine statistics with the statistics of another instance (eg. computed by another thread)
+template<typename eT>
+inline
+void
+running_stat<eT>::merge(const running_stat<eT>& in_rs)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this != &in_rs)
+    {
+    running_stat_aux::merge_stats(*this, in_rs);
+    }
+  else
+    {
+    const running_stat<eT> tmp(in_rs);
+    
+    running_stat_aux::merge_stats(*this, tmp);
+    }
+  }
+
+
+
 //! set all statistics to zero
 template<typename eT>
 inline
@@ -458,4 +549,287 @@ running_stat_aux::update_stats(running_stat<eT>& x, const eT& sample, const type
 
 
 
+//! update statistics to reflect all elements of given matrix;
+//! large matrices are split into chunks which are processed in parallel and then merged
+template<typename eT>
+inline
+void
+running_stat_aux::batch_update(running_stat<eT>& x, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_elem = X.n_elem;
+  const eT*   X_mem  = X.memptr();
+  
+  if(n_elem == 0)  { return; }
+  
+  if(X.is_finite() == false)
+    {
+    // process each sample separately, so that only the non-finite samples are ignored
+    
+    for(uword i=0; i < n_elem; ++i)  { x(X_mem[i]); }
+    
+    return;
+    }
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = n_elem / n_threads_use;
+      
+      std::vector< running_stat<eT> > partial_stats(n_threads_use);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = thread_id * chunk_size;
+        const uword count = ((thread_id+1) < n_threads_use) ? chunk_size : (n_elem - start);
+        
+        running_stat_aux::batch_stats(partial_stats[thread_id], &(X_mem[start]), count);
+        }
+      
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)  { x.merge(partial_stats[thread_id]); }
+      }
+    #endif
+    }
+  else
+    {
+    running_stat<eT> tmp_stats;
+    
+    running_stat_aux::batch_stats(tmp_stats, X_mem, n_elem);
+    
+    x.merge(tmp_stats);
+    }
+  }
+
+
+
+//! update statistics to reflect all elements of given matrix (version for differing element types)
+template<typename eT, typename eT2>
+inline
+void
+running_stat_aux::batch_update(running_stat<eT>& x, const Mat<eT2>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  running_stat_aux::batch_update(x, conv_to< Mat<eT> >::from(X));
+  }
+
+
+
+//! compute statistics of a block of samples, using two passes (version for non-complex numbers);
+//! the given object is assumed to be freshly constructed or reset
+template<typename eT>
+inline
+void
+running_stat_aux::batch_stats(running_stat<eT>& x, const eT* X_mem, const uword n_elem, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat<eT>::T T;
+  
+  if(n_elem == 0)  { return; }
+  
+  const T N = T(n_elem);
+  
+  eT acc1 = eT(0);
+  eT acc2 = eT(0);
+  
+  eT min_val = X_mem[0];
+  eT max_val = X_mem[0];
+  
+  uword i,j;
+  for(i=0, j=1; j < n_elem; i+=2, j+=2)
+    {
+    const eT val_i = X_mem[i];
+    const eT val_j = X_mem[j];
+    
+    acc1 += val_i;
+    acc2 += val_j;
+    
+    if(val_i < min_val)  { min_val = val_i; }
+    if(val_j < min_val)  { min_val = val_j; }
+    
+    if(val_i > max_val)  { max_val = val_i; }
+    if(val_j > max_val)  { max_val = val_j; }
+    }
+  
+  if(i < n_elem)
+    {
+    const eT val_i = X_mem[i];
+    
+    acc1 += val_i;
+    
+    if(val_i < min_val)  { min_val = val_i; }
+    if(val_i > max_val)  { max_val = val_i; }
+    }
+  
+  const eT mean_val = (acc1 + acc2) / N;
+  
+  eT ssd1 = eT(0);
+  eT ssd2 = eT(0);
+  
+  for(i=0, j=1; j < n_elem; i+=2, j+=2)
+    {
+    const eT tmp_i = X_mem[i] - mean_val;
+    const eT tmp_j = X_mem[j] - mean_val;
+    
+    ssd1 += tmp_i*tmp_i;
+    ssd2 += tmp_j*tmp_j;
+    }
+  
+  if(i < n_elem)
+    {
+    const eT tmp_i = X_mem[i] - mean_val;
+    
+    ssd1 += tmp_i*tmp_i;
+    }
+  
+  x.r_mean  = mean_val;
+  x.r_var   = (n_elem > 1) ? T((ssd1 + ssd2) / (N - T(1))) : T(0);
+  x.min_val = min_val;
+  x.max_val = max_val;
+  
+  x.counter += n_elem;
+  }
+
+
+
+//! compute statistics of a block of samples, using two passes (version for complex numbers);
+//! the given object is assumed to be freshly constructed or reset
+template<typename eT>
+inline
+void
+running_stat_aux::batch_stats(running_stat<eT>& x, const eT* X_mem, const uword n_elem, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename eT::value_type T;
+  
+  if(n_elem == 0)  { return; }
+  
+  const T N = T(n_elem);
+  
+  eT acc = eT(0);
+  
+  uword min_index    = 0;
+  uword max_index    = 0;
+  T     min_val_norm = std::norm(X_mem[0]);
+  T     max_val_norm = min_val_norm;
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT& val      = X_mem[i];
+    const T   val_norm = std::norm(val);
+    
+    acc += val;
+    
+    if(val_norm < min_val_norm)  { min_val_norm = val_norm; min_index = i; }
+    if(val_norm > max_val_norm)  { max_val_norm = val_norm; max_index = i; }
+    }
+  
+  const eT mean_val = acc / N;
+  
+  T ssd = T(0);
+  
+  for(uword i=0; i < n_elem; ++i)  { ssd += std::norm(X_mem[i] - mean_val); }
+  
+  x.r_mean       = mean_val;
+  x.r_var        = (n_elem > 1) ? T(ssd / (N - T(1))) : T(0);
+  x.min_val      = X_mem[min_index];
+  x.max_val      = X_mem[max_index];
+  x.min_val_norm = min_val_norm;
+  x.max_val_norm = max_val_norm;
+  
+  x.counter += n_elem;
+  }
+
+
+
+//! combine two sets of statistics, using the pairwise update of Chan et al (version for non-complex numbers)
+template<typename eT>
+inline
+void
+running_stat_aux::merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat<eT>::T T;
+  
+  const T x_N = x.counter.value();
+  const T y_N = y.counter.value();
+  
+  if(y_N == T(0))  { return; }
+  
+  if(x_N == T(0))  { x = y; return; }
+  
+  const T N = x_N + y_N;
+  
+  const eT delta = y.r_mean - x.r_mean;
+  
+  // r_var holds the unbiased variance, ie. the sum of squared deviations divided by N-1
+  
+  const T ssd = x.counter.value_minus_1() * x.r_var + y.counter.value_minus_1() * y.r_var + (delta*delta) * ((x_N/N) * y_N);
+  
+  x.r_var  = ssd / (N - T(1));
+  x.r_mean = x.r_mean + delta * (y_N/N);
+  
+  if(y.min_val < x.min_val)  { x.min_val = y.min_val; }
+  if(y.max_val > x.max_val)  { x.max_val = y.max_val; }
+  
+  x.counter += y.counter;
+  }
+
+
+
+//! combine two sets of statistics, using the pairwise update of Chan et al (version for complex numbers)
+template<typename eT>
+inline
+void
+running_stat_aux::merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename eT::value_type T;
+  
+  const T x_N = x.counter.value();
+  const T y_N = y.counter.value();
+  
+  if(y_N == T(0))  { return; }
+  
+  if(x_N == T(0))  { x = y; return; }
+  
+  const T N = x_N + y_N;
+  
+  const eT delta = y.r_mean - x.r_mean;
+  
+  const T ssd = x.counter.value_minus_1() * x.r_var + y.counter.value_minus_1() * y.r_var + std::norm(delta) * ((x_N/N) * y_N);
+  
+  x.r_var  = ssd / (N - T(1));
+  x.r_mean = x.r_mean + delta * (y_N/N);
+  
+  if(y.min_val_norm < x.min_val_norm)
+    {
+    x.min_val_norm = y.min_val_norm;
+    x.min_val      = y.min_val;
+    }
+  
+  if(y.max_val_norm > x.max_val_norm)
+    {
+    x.max_val_norm = y.max_val_norm;
+    x.max_val      = y.max_val;
+    }
+  
+  x.counter += y.counter;
+  }
+
+
+
 //! @}
@@ -65,6 +65,11 @@ class running_stat_vec
   template<typename T1> arma_hot inline void operator() (const Base<              T, T1>& X);
   template<typename T1> arma_hot inline void operator() (const Base<std::complex<T>, T1>& X);
   
+  template<typename T1> inline void batch(const Base<              T, T1>& X);
+  template<typename T1> inline void batch(const Base<std::complex<T>, T1>& X);
+  
+  inline void merge(const running_stat_vec& in_rsv);
+  
   inline void reset();
   
   inline const return_type1&  mean() const;
@@ -148,6 +153,77 @@ class running_stat_vec_aux
     const                   Mat<typename running_stat_vec<obj_type>::eT>& sample,
     const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
     );
+  
+  template<typename obj_type>
+  inline static void
+  batch_update
+    (
+    running_stat_vec<obj_type>& x,
+    const Mat<typename running_stat_vec<obj_type>::eT>& X,
+    const bool samples_in_rows
+    );
+  
+  template<typename obj_type>
+  inline static void
+  batch_update
+    (
+    running_stat_vec<obj_type>& x,
+    const          Mat<std::complex< typename running_stat_vec<obj_type>::T > >& X,
+    const bool                                                                    samples_in_rows,
+    const typename       arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  batch_update
+    (
+    running_stat_vec<obj_type>& x,
+    const                  Mat< typename running_stat_vec<obj_type>::T >& X,
+    const bool                                                           samples_in_rows,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  batch_stats
+    (
+    running_stat_vec<obj_type>& x,
+    const                  Mat<typename running_stat_vec<obj_type>::eT>& X,
+    const uword                                                          col_start,
+    const uword                                                          n_samples,
+    const SizeMat&                                                       out_size,
+    const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  batch_stats
+    (
+    running_stat_vec<obj_type>& x,
+    const                   Mat<typename running_stat_vec<obj_type>::eT>& X,
+    const uword                                                           col_start,
+    const uword                                                           n_samples,
+    const SizeMat&                                                        out_size,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  merge_stats
+    (
+    running_stat_vec<obj_type>& x,
+    const running_stat_vec<obj_type>& y,
+    const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  merge_stats
+    (
+    running_stat_vec<obj_type>& x,
+    const running_stat_vec<obj_type>& y,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
   };
 
 
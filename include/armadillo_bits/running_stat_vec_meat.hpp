@@ -137,6 +137,62 @@ running_stat_vec<obj_type>::operator() (const Base< std::complex<typename runnin
 
 
 
+//! update statistics to reflect a batch of samples;
+//! each column of X is a sample, or each row of X if vec_type is a row vector type
+template<typename obj_type>
+template<typename T1>
+inline
+void
+running_stat_vec<obj_type>::batch(const Base<typename running_stat_vec<obj_type>::T, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  running_stat_vec_aux::batch_update(*this, tmp.M, is_Row<return_type1>::value);
+  }
+
+
+
+template<typename obj_type>
+template<typename T1>
+inline
+void
+running_stat_vec<obj_type>::batch(const Base<std::complex<typename running_stat_vec<obj_type>::T>, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  running_stat_vec_aux::batch_update(*this, tmp.M, is_Row<return_type1>::value);
+  }
+
+
+
+//! combine statistics with the statistics of another instance (eg. computed by another thread)
+template<typename obj_type>
+inline
+void
+running_stat_vec<obj_type>::merge(const running_stat_vec<obj_type>& in_rsv)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (calc_cov && (in_rsv.calc_cov == false) && (in_rsv.counter.value() > T(0))), "running_stat_vec::merge(): given object does not have covariance calculation enabled" );
+  
+  if(this != &in_rsv)
+    {
+    running_stat_vec_aux::merge_stats(*this, in_rsv);
+    }
+  else
+    {
+    const running_stat_vec<obj_type> tmp(in_rsv);
+    
+    running_stat_vec_aux::merge_stats(*this, tmp);
+    }
+  }
+
+
+
 //! set all statistics to zero
 template<typename obj_type>
 inline
@@ -633,4 +689,541 @@ running_stat_vec_aux::update_stats
 
 
 
+//! update statistics to reflect a batch of samples;
+//! large batches are split into chunks of samples which are processed in parallel and then merged
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_update
+  (
+  running_stat_vec<obj_type>& x,
+  const Mat<typename running_stat_vec<obj_type>::eT>& X,
+  const bool samples_in_rows
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  if(samples_in_rows)
+    {
+    const Mat<eT> Xt = strans(X);
+    
+    running_stat_vec_aux::batch_update(x, Xt, false);
+    
+    return;
+    }
+  
+  if(X.is_empty())  { return; }
+  
+  const uword n_dim     = X.n_rows;
+  const uword n_samples = X.n_cols;
+  
+  const bool x_is_empty = (x.counter.value() == T(0));
+  
+  arma_debug_check( ((x_is_empty == false) && (x.r_mean.n_elem != n_dim)), "running_stat_vec::batch(): dimensionality mismatch" );
+  
+  const bool out_is_row = (x_is_empty) ? is_Row<typename running_stat_vec<obj_type>::return_type1>::value : (x.r_mean.n_rows == 1);
+  
+  const SizeMat out_size = (out_is_row) ? SizeMat(1, n_dim) : SizeMat(n_dim, 1);
+  
+  if(X.is_finite() == false)
+    {
+    // process each sample separately, so that only the non-finite samples are ignored
+    
+    for(uword col=0; col < n_samples; ++col)
+      {
+      x( Mat<eT>(const_cast<eT*>(X.colptr(col)), out_size.n_rows, out_size.n_cols, false, true) );
+      }
+    
+    return;
+    }
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(X.n_elem) && (n_samples >= uword(mp_thread_limit::get())) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = n_samples / n_threads_use;
+      
+      std::vector< running_stat_vec<obj_type> > partial_stats(n_threads_use, running_stat_vec<obj_type>(x.calc_cov));
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = thread_id * chunk_size;
+        const uword count = ((thread_id+1) < n_threads_use) ? chunk_size : (n_samples - start);
+        
+        running_stat_vec_aux::batch_stats(partial_stats[thread_id], X, start, count, out_size);
+        }
+      
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)  { x.merge(partial_stats[thread_id]); }
+      }
+    #endif
+    }
+  else
+    {
+    running_stat_vec<obj_type> tmp_stats(x.calc_cov);
+    
+    running_stat_vec_aux::batch_stats(tmp_stats, X, 0, n_samples, out_size);
+    
+    x.merge(tmp_stats);
+    }
+  }
+
+
+
+//! update statistics to reflect a batch of samples (version for non-complex numbers, complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_update
+  (
+  running_stat_vec<obj_type>& x,
+  const          Mat<std::complex< typename running_stat_vec<obj_type>::T > >& X,
+  const bool                                                                    samples_in_rows,
+  const typename       arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec_aux::batch_update(x, conv_to< Mat<eT> >::from(X), samples_in_rows);
+  }
+
+
+
+//! update statistics to reflect a batch of samples (version for complex numbers, non-complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_update
+  (
+  running_stat_vec<obj_type>& x,
+  const                  Mat< typename running_stat_vec<obj_type>::T >& X,
+  const bool                                                           samples_in_rows,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec_aux::batch_update(x, conv_to< Mat<eT> >::from(X), samples_in_rows);
+  }
+
+
+
+//! compute statistics of the samples stored in columns [col_start, col_start+n_samples) of X (version for non-complex numbers);
+//! the given object is assumed to be freshly constructed or reset
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_stats
+  (
+  running_stat_vec<obj_type>& x,
+  const                  Mat<typename running_stat_vec<obj_type>::eT>& X,
+  const uword                                                          col_start,
+  const uword                                                          n_samples,
+  const SizeMat&                                                       out_size,
+  const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  if(n_samples == 0)  { return; }
+  
+  const uword n_dim   = X.n_rows;
+  const uword col_end = col_start + n_samples - 1;
+  const T     N       = T(n_samples);
+  
+  x.r_mean.zeros(out_size.n_rows, out_size.n_cols);
+  x.r_var.zeros(out_size.n_rows, out_size.n_cols);
+  
+  x.min_val.set_size(out_size.n_rows, out_size.n_cols);
+  x.max_val.set_size(out_size.n_rows, out_size.n_cols);
+  
+  eT* r_mean_mem  = x.r_mean.memptr();
+   T* r_var_mem   = x.r_var.memptr();
+  eT* min_val_mem = x.min_val.memptr();
+  eT* max_val_mem = x.max_val.memptr();
+  
+  arrayops::copy(min_val_mem, X.colptr(col_start), n_dim);
+  arrayops::copy(max_val_mem, X.colptr(col_start), n_dim);
+  
+  for(uword col=col_start; col <= col_end; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+    
+    for(uword i=0; i < n_dim; ++i)
+      {
+      const eT val = X_colptr[i];
+      
+      r_mean_mem[i] += val;
+      
+      if(val < min_val_mem[i])  { min_val_mem[i] = val; }
+      if(val > max_val_mem[i])  { max_val_mem[i] = val; }
+      }
+    }
+  
+  arrayops::inplace_div(r_mean_mem, eT(N), n_dim);
+  
+  for(uword col=col_start; col <= col_end; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+    
+    for(uword i=0; i < n_dim; ++i)
+      {
+      const eT tmp = X_colptr[i] - r_mean_mem[i];
+      
+      r_var_mem[i] += tmp*tmp;
+      }
+    }
+  
+  if(n_samples > 1)  { arrayops::inplace_div(r_var_mem, (N - T(1)), n_dim); }
+  
+  if(x.calc_cov)
+    {
+    if(n_samples > 1)
+      {
+      Mat<eT>& tmp1 = x.tmp1;
+      
+      tmp1 = X.cols(col_start, col_end);
+      
+      tmp1.each_col() -= Col<eT>(r_mean_mem, n_dim, false, true);
+      
+      x.r_cov = tmp1 * trans(tmp1);
+      
+      x.r_cov /= (N - T(1));
+      
+      tmp1.reset();
+      }
+    else
+      {
+      x.r_cov.zeros(n_dim, n_dim);
+      }
+    }
+  
+  x.counter += n_samples;
+  }
+
+
+
+//! compute statistics of the samples stored in columns [col_start, col_start+n_samples) of X (version for complex numbers);
+//! the given object is assumed to be freshly constructed or reset
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_stats
+  (
+  running_stat_vec<obj_type>& x,
+  const                   Mat<typename running_stat_vec<obj_type>::eT>& X,
+  const uword                                                           col_start,
+  const uword                                                           n_samples,
+  const SizeMat&                                                        out_size,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  if(n_samples == 0)  { return; }
+  
+  const uword n_dim   = X.n_rows;
+  const uword col_end = col_start + n_samples - 1;
+  const T     N       = T(n_samples);
+  
+  x.r_mean.zeros(out_size.n_rows, out_size.n_cols);
+  x.r_var.zeros(out_size.n_rows, out_size.n_cols);
+  
+  x.min_val.set_size(out_size.n_rows, out_size.n_cols);
+  x.max_val.set_size(out_size.n_rows, out_size.n_cols);
+  
+  x.min_val_norm.set_size(out_size.n_rows, out_size.n_cols);
+  x.max_val_norm.set_size(out_size.n_rows, out_size.n_cols);
+  
+  eT* r_mean_mem       = x.r_mean.memptr();
+   T* r_var_mem        = x.r_var.memptr();
+  eT* min_val_mem      = x.min_val.memptr();
+  eT* max_val_mem      = x.max_val.memptr();
+   T* min_val_norm_mem = x.min_val_norm.memptr();
+   T* max_val_norm_mem = x.max_val_norm.memptr();
+  
+  arrayops::copy(min_val_mem, X.colptr(col_start), n_dim);
+  arrayops::copy(max_val_mem, X.colptr(col_start), n_dim);
+  
+  for(uword i=0; i < n_dim; ++i)
+    {
+    min_val_norm_mem[i] = std::norm(min_val_mem[i]);
+    max_val_norm_mem[i] = min_val_norm_mem[i];
+    }
+  
+  for(uword col=col_start; col <= col_end; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+    
+    for(uword i=0; i < n_dim; ++i)
+      {
+      const eT& val      = X_colptr[i];
+      const  T  val_norm = std::norm(val);
+      
+      r_mean_mem[i] += val;
+      
+      if(val_norm < min_val_norm_mem[i])
+        {
+        min_val_norm_mem[i] = val_norm;
+        min_val_mem[i]      = val;
+        }
+      
+      if(val_norm > max_val_norm_mem[i])
+        {
+        max_val_norm_mem[i] = val_norm;
+        max_val_mem[i]      = val;
+        }
+      }
+    }
+  
+  arrayops::inplace_div(r_mean_mem, eT(N), n_dim);
+  
+  for(uword col=col_start; col <= col_end; ++col)
+    {
+    const eT* X_colptr = X.colptr(col);
+    
+    for(uword i=0; i < n_dim; ++i)  { r_var_mem[i] += std::norm(X_colptr[i] - r_mean_mem[i]); }
+    }
+  
+  if(n_samples > 1)  { arrayops::inplace_div(r_var_mem, (N - T(1)), n_dim); }
+  
+  if(x.calc_cov)
+    {
+    if(n_samples > 1)
+      {
+      Mat<eT>& tmp1 = x.tmp1;
+      
+      tmp1 = X.cols(col_start, col_end);
+      
+      tmp1.each_col() -= Col<eT>(r_mean_mem, n_dim, false, true);
+      
+      x.r_cov = arma::conj(tmp1) * strans(tmp1);
+      
+      x.r_cov /= (N - T(1));
+      
+      tmp1.reset();
+      }
+    else
+      {
+      x.r_cov.zeros(n_dim, n_dim);
+      }
+    }
+  
+  x.counter += n_samples;
+  }
+
+
+
+//! combine two sets of statistics, using the pairwise update of Chan et al (version for non-complex numbers)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::merge_stats
+  (
+  running_stat_vec<obj_type>& x,
+  const running_stat_vec<obj_type>& y,
+  const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  const T x_N = x.counter.value();
+  const T y_N = y.counter.value();
+  
+  if(y_N == T(0))  { return; }
+  
+  if(x_N == T(0))
+    {
+    x.counter = y.counter;
+    x.r_mean  = y.r_mean;
+    x.r_var   = y.r_var;
+    x.min_val = y.min_val;
+    x.max_val = y.max_val;
+    
+    if(x.calc_cov)  { x.r_cov = y.r_cov; }
+    
+    return;
+    }
+  
+  arma_debug_assert_same_size(x.r_mean, y.r_mean, "running_stat_vec::merge(): dimensionality mismatch");
+  
+  const uword n_elem = x.r_mean.n_elem;
+  
+  const T N         = x_N + y_N;
+  const T x_N_m1    = x.counter.value_minus_1();
+  const T y_N_m1    = y.counter.value_minus_1();
+  const T delta_w   = (x_N/N) * y_N;
+  const T mean_w    = y_N/N;
+  
+  Mat<eT>& delta = x.tmp1;
+  
+  delta.set_size(n_elem, 1);
+  
+  eT* delta_mem = delta.memptr();
+  
+  const eT* y_r_mean_mem  = y.r_mean.memptr();
+  const  T* y_r_var_mem   = y.r_var.memptr();
+  const eT* y_min_val_mem = y.min_val.memptr();
+  const eT* y_max_val_mem = y.max_val.memptr();
+  
+  eT* r_mean_mem  = x.r_mean.memptr();
+   T* r_var_mem   = x.r_var.memptr();
+  eT* min_val_mem = x.min_val.memptr();
+  eT* max_val_mem = x.max_val.memptr();
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT tmp = y_r_mean_mem[i] - r_mean_mem[i];
+    
+    delta_mem[i] = tmp;
+    
+    r_var_mem[i] = (x_N_m1 * r_var_mem[i] + y_N_m1 * y_r_var_mem[i] + (tmp*tmp) * delta_w) / (N - T(1));
+    
+    r_mean_mem[i] += tmp * mean_w;
+    
+    if(y_min_val_mem[i] < min_val_mem[i])  { min_val_mem[i] = y_min_val_mem[i]; }
+    if(y_max_val_mem[i] > max_val_mem[i])  { max_val_mem[i] = y_max_val_mem[i]; }
+    }
+  
+  if(x.calc_cov)
+    {
+    Mat<eT>& tmp2 = x.tmp2;
+    
+    tmp2 = delta * trans(delta);
+    
+    x.r_cov = (x_N_m1 * x.r_cov + y_N_m1 * y.r_cov + delta_w * tmp2) / (N - T(1));
+    }
+  
+  x.counter += y.counter;
+  }
+
+
+
+//! combine two sets of statistics, using the pairwise update of Chan et al (version for complex numbers)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::merge_stats
+  (
+  running_stat_vec<obj_type>& x,
+  const running_stat_vec<obj_type>& y,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  const T x_N = x.counter.value();
+  const T y_N = y.counter.value();
+  
+  if(y_N == T(0))  { return; }
+  
+  if(x_N == T(0))
+    {
+    x.counter      = y.counter;
+    x.r_mean       = y.r_mean;
+    x.r_var        = y.r_var;
+    x.min_val      = y.min_val;
+    x.max_val      = y.max_val;
+    x.min_val_norm = y.min_val_norm;
+    x.max_val_norm = y.max_val_norm;
+    
+    if(x.calc_cov)  { x.r_cov = y.r_cov; }
+    
+    return;
+    }
+  
+  arma_debug_assert_same_size(x.r_mean, y.r_mean, "running_stat_vec::merge(): dimensionality mismatch");
+  
+  const uword n_elem = x.r_mean.n_elem;
+  
+  const T N         = x_N + y_N;
+  const T x_N_m1    = x.counter.value_minus_1();
+  const T y_N_m1    = y.counter.value_minus_1();
+  const T delta_w   = (x_N/N) * y_N;
+  const T mean_w    = y_N/N;
+  
+  Mat<eT>& delta = x.tmp1;
+  
+  delta.set_size(n_elem, 1);
+  
+  eT* delta_mem = delta.memptr();
+  
+  const eT* y_r_mean_mem       = y.r_mean.memptr();
+  const  T* y_r_var_mem        = y.r_var.memptr();
+  const eT* y_min_val_mem      = y.min_val.memptr();
+  const eT* y_max_val_mem      = y.max_val.memptr();
+  const  T* y_min_val_norm_mem = y.min_val_norm.memptr();
+  const  T* y_max_val_norm_mem = y.max_val_norm.memptr();
+  
+  eT* r_mean_mem       = x.r_mean.memptr();
+   T* r_var_mem        = x.r_var.memptr();
+  eT* min_val_mem      = x.min_val.memptr();
+  eT* max_val_mem      = x.max_val.memptr();
+   T* min_val_norm_mem = x.min_val_norm.memptr();
+   T* max_val_norm_mem = x.max_val_norm.memptr();
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT tmp = y_r_mean_mem[i] - r_mean_mem[i];
+    
+    delta_mem[i] = tmp;
+    
+    r_var_mem[i] = (x_N_m1 * r_var_mem[i] + y_N_m1 * y_r_var_mem[i] + std::norm(tmp) * delta_w) / (N - T(1));
+    
+    r_mean_mem[i] += tmp * mean_w;
+    
+    if(y_min_val_norm_mem[i] < min_val_norm_mem[i])
+      {
+      min_val_norm_mem[i] = y_min_val_norm_mem[i];
+      min_val_mem[i]      = y_min_val_mem[i];
+      }
+    
+    if(y_max_val_norm_mem[i] > max_val_norm_mem[i])
+      {
+      max_val_norm_mem[i] = y_max_val_norm_mem[i];
+      max_val_mem[i]      = y_max_val_mem[i];
+      }
+    }
+  
+  if(x.calc_cov)
+    {
+    Mat<eT>& tmp2 = x.tmp2;
+    
+    tmp2 = arma::conj(delta) * strans(delta);
+    
+    x.r_cov = (x_N_m1 * x.r_cov + y_N_m1 * y.r_cov + delta_w * tmp2) / (N - T(1));
+    }
+  
+  x.counter += y.counter;
+  }
+
+
+
 //! @}
@@ -0,0 +1,63 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup scan_engine
+//! @{
+
+
+//! binary operations for scan_engine
+
+struct scan_engine_plus
+  {
+  template<typename eT> arma_inline static eT neutral()                    { return eT(0); }
+  template<typename eT> arma_inline static eT apply(const eT a, const eT b) { return a + b; }
+  };
+
+struct scan_engine_times
+  {
+  template<typename eT> arma_inline static eT neutral()                    { return eT(1); }
+  template<typename eT> arma_inline static eT apply(const eT a, const eT b) { return a * b; }
+  };
+
+
+
+//! Inclusive prefix scans, as used by cumsum() and cumprod().
+//! With OpenMP enabled, long vectors are scanned in two passes over chunks:
+//! the total of each chunk is found in parallel, followed by a parallel scan of each chunk
+//! which starts from the combined totals of the preceding chunks.
+//! Matrices are scanned in parallel across columns (dim=0) or across blocks of rows (dim=1).
+class scan_engine
+  {
+  public:
+  
+  static const uword mp_n_elem_min = 65536;  //!< minimum number of elements for using multiple threads
+  
+  template<typename eT> inline static bool use_mp(const uword n_elem);
+  
+  template<typename op_type, typename eT> arma_hot inline static eT reduce_serial(const eT* X, const uword N);
+  template<typename op_type, typename eT> arma_hot inline static eT   scan_serial(eT* out, const eT* X, const uword N, const eT init);
+  
+  template<typename op_type, typename eT> inline static void scan(eT* out, const eT* X, const uword N);
+  
+  template<typename op_type, typename eT> inline static void scan_cols(Mat<eT>& out, const Mat<eT>& X);
+  template<typename op_type, typename eT> inline static void scan_rows(Mat<eT>& out, const Mat<eT>& X);
+  
+  inline static uword exclusive_counts(uword* counts, const uword N);
+  };
+
+
+
+//! @}
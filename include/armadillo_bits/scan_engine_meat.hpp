@@ -0,0 +1,246 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup scan_engine
+//! @{
+
+
+
+template<typename eT>
+inline
+bool
+scan_engine::use_mp(const uword n_elem)
+  {
+  return ( arma_config::openmp && (n_elem >= scan_engine::mp_n_elem_min) && mp_gate<eT>::eval(n_elem) );
+  }
+
+
+
+template<typename op_type, typename eT>
+arma_hot
+inline
+eT
+scan_engine::reduce_serial(const eT* X, const uword N)
+  {
+  eT acc = op_type::template neutral<eT>();
+  
+  for(uword i=0; i < N; ++i)  { acc = op_type::apply(acc, X[i]); }
+  
+  return acc;
+  }
+
+
+
+//! scan N elements of X into out, starting from init; returns the last value; out may be equal to X
+template<typename op_type, typename eT>
+arma_hot
+inline
+eT
+scan_engine::scan_serial(eT* out, const eT* X, const uword N, const eT init)
+  {
+  eT acc = init;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    acc = op_type::apply(acc, X[i]);
+    
+    out[i] = acc;
+    }
+  
+  return acc;
+  }
+
+
+
+template<typename op_type, typename eT>
+inline
+void
+scan_engine::scan(eT* out, const eT* X, const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(scan_engine::use_mp<eT>(N))
+      {
+      const uword n_chunks  = uword(mp_thread_limit::get());
+      const uword chunk_len = N / n_chunks;
+      
+      podarray<eT> totals(n_chunks);
+      
+      eT* totals_mem = totals.memptr();
+      
+      // pass 1: total of each chunk
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_chunks))
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword start = chunk * chunk_len;
+        const uword len   = (chunk == (n_chunks-1)) ? (N - start) : chunk_len;
+        
+        totals_mem[chunk] = scan_engine::reduce_serial<op_type>(&(X[start]), len);
+        }
+      
+      // convert to the combined totals of the preceding chunks, in a fixed order
+      
+      eT acc = op_type::template neutral<eT>();
+      
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const eT tmp = totals_mem[chunk];
+        
+        totals_mem[chunk] = acc;
+        
+        acc = op_type::apply(acc, tmp);
+        }
+      
+      // pass 2: scan of each chunk, starting from the preceding totals
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_chunks))
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword start = chunk * chunk_len;
+        const uword len   = (chunk == (n_chunks-1)) ? (N - start) : chunk_len;
+        
+        scan_engine::scan_serial<op_type>(&(out[start]), &(X[start]), len, totals_mem[chunk]);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  scan_engine::scan_serial<op_type>(out, X, N, op_type::template neutral<eT>());
+  }
+
+
+
+//! scan each column of X; out must have the same size as X
+template<typename op_type, typename eT>
+inline
+void
+scan_engine::scan_cols(Mat<eT>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_rows = X.n_rows;
+  const uword n_cols = X.n_cols;
+  
+  if(n_cols == 1)  { scan_engine::scan<op_type>(out.memptr(), X.memptr(), n_rows); return; }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    if( scan_engine::use_mp<eT>(X.n_elem) && (n_cols >= uword(n_threads)) )
+      {
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < n_cols; ++col)
+        {
+        scan_engine::scan_serial<op_type>(out.colptr(col), X.colptr(col), n_rows, op_type::template neutral<eT>());
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  // few long columns are each scanned in parallel
+  
+  for(uword col=0; col < n_cols; ++col)
+    {
+    scan_engine::scan<op_type>(out.colptr(col), X.colptr(col), n_rows);
+    }
+  }
+
+
+
+//! scan each row of X; out must have the same size as X
+template<typename op_type, typename eT>
+inline
+void
+scan_engine::scan_rows(Mat<eT>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_rows = X.n_rows;
+  const uword n_cols = X.n_cols;
+  
+  if(n_rows == 1)  { scan_engine::scan<op_type>(out.memptr(), X.memptr(), n_cols); return; }
+  
+  if(n_cols == 0)  { return; }
+  
+  uword n_chunks = 1;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword n_threads = uword(mp_thread_limit::get());
+    
+    // each chunk of rows should span at least one cache line in each column
+    if( scan_engine::use_mp<eT>(X.n_elem) && (n_rows >= (n_threads * (uword(64) / sizeof(eT)))) )  { n_chunks = n_threads; }
+    }
+  #endif
+  
+  const uword chunk_len = n_rows / n_chunks;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_chunks)) if(n_chunks > 1)
+  #endif
+  for(uword chunk=0; chunk < n_chunks; ++chunk)
+    {
+    const uword row_start = chunk * chunk_len;
+    const uword len       = (chunk == (n_chunks-1)) ? (n_rows - row_start) : chunk_len;
+    
+    arrayops::copy( out.colptr(0) + row_start, X.colptr(0) + row_start, len );
+    
+    for(uword col=1; col < n_cols; ++col)
+      {
+      const eT* out_colmem_prev = out.colptr(col-1) + row_start;
+            eT* out_colmem      = out.colptr(col  ) + row_start;
+      const eT*   X_colmem      =   X.colptr(col  ) + row_start;
+      
+      for(uword row=0; row < len; ++row)
+        {
+        out_colmem[row] = op_type::apply(out_colmem_prev[row], X_colmem[row]);
+        }
+      }
+    }
+  }
+
+
+
+//! convert counts into offsets (exclusive prefix sum); returns the total count
+inline
+uword
+scan_engine::exclusive_counts(uword* counts, const uword N)
+  {
+  uword acc = 0;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword tmp = counts[i];
+    
+    counts[i] = acc;
+    
+    acc += tmp;
+    }
+  
+  return acc;
+  }
+
+
+
+//! @}
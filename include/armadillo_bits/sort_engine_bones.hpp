@@ -0,0 +1,88 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sort_engine
+//! @{
+
+
+//! unsigned integer type used for the radix sort keys of elements with the given size (in bytes)
+template<uword N> struct sort_engine_uint    { typedef uword result; static const bool ok = false; };
+template<>        struct sort_engine_uint<1> { typedef u8    result; static const bool ok = true;  };
+template<>        struct sort_engine_uint<2> { typedef u16   result; static const bool ok = true;  };
+template<>        struct sort_engine_uint<4> { typedef u32   result; static const bool ok = true;  };
+
+#if defined(ARMA_USE_U64S64)
+template<>        struct sort_engine_uint<8> { typedef u64   result; static const bool ok = true;  };
+#endif
+
+
+
+//! Mapping of elements to unsigned integer keys which have the same ordering as the elements.
+//! For IEEE floating point numbers, the sign bit is flipped for positive numbers,
+//! and all bits are flipped for negative numbers.
+//! For signed integers, the sign bit is flipped.
+template<typename eT>
+struct sort_engine_key
+  {
+  static const bool is_int = std::numeric_limits<eT>::is_integer;
+  
+  static const bool supported = (is_real<eT>::value || is_int) && sort_engine_uint<sizeof(eT)>::ok;
+  
+  typedef typename sort_engine_uint<sizeof(eT)>::result key_type;
+  
+  arma_inline static key_type msb()   { return key_type( key_type(1) << (8*sizeof(key_type) - 1) ); }
+  arma_inline static key_type flip(const uword sort_type) { return (sort_type == 0) ? key_type(0) : key_type(~key_type(0)); }
+  
+  arma_inline static key_type to_key  (const eT       val);
+  arma_inline static eT       from_key(const key_type key);
+  };
+
+
+
+class sort_engine
+  {
+  public:
+  
+  //! arrays with fewer elements than this are sorted directly via std::sort()
+  static const uword threshold = 4096;
+  
+  template<typename eT>
+  inline static void sort(eT* X, const uword n_elem, const uword sort_type, const typename enable_if<sort_engine_key<eT>::supported == true >::result* junk = 0);
+  
+  template<typename eT>
+  inline static void sort(eT* X, const uword n_elem, const uword sort_type, const typename enable_if<sort_engine_key<eT>::supported == false>::result* junk = 0);
+  
+  template<typename eT>
+  inline static bool sort_index(uword* out, const eT* X, const uword n_elem, const uword sort_type, const bool stable, const typename enable_if<sort_engine_key<eT>::supported == true >::result* junk = 0);
+  
+  template<typename eT>
+  inline static bool sort_index(uword* out, const eT* X, const uword n_elem, const uword sort_type, const bool stable, const typename enable_if<sort_engine_key<eT>::supported == false>::result* junk = 0);
+  
+  template<typename eT>
+  inline static bool sort_index_packets(uword* out, const eT* X, const uword n_elem, const uword sort_type, const bool stable);
+  
+  template<typename key_type>
+  inline static void radix_sort(key_type* keys, uword* indices, const uword n_elem);
+  
+  template<typename eT, typename comparator_type>
+  inline static void merge_sort(eT* X, const uword n_elem, const comparator_type& comparator, const bool stable);
+  
+  inline static uword get_n_threads(const uword n_elem);
+  };
+
+
+
+//! @}
@@ -0,0 +1,458 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sort_engine
+//! @{
+
+
+
+template<typename eT>
+arma_inline
+typename sort_engine_key<eT>::key_type
+sort_engine_key<eT>::to_key(const eT val)
+  {
+  key_type key;
+  
+  if(is_int)
+    {
+    key = key_type(val);
+    
+    if(std::numeric_limits<eT>::is_signed)  { key ^= msb(); }
+    }
+  else
+    {
+    std::memcpy(&key, &val, sizeof(key_type));
+    
+    key = (key & msb()) ? key_type(~key) : key_type(key | msb());
+    }
+  
+  return key;
+  }
+
+
+
+template<typename eT>
+arma_inline
+eT
+sort_engine_key<eT>::from_key(const key_type key)
+  {
+  eT val;
+  
+  if(is_int)
+    {
+    val = eT( (std::numeric_limits<eT>::is_signed) ? key_type(key ^ msb()) : key );
+    }
+  else
+    {
+    const key_type tmp = (key & msb()) ? key_type(key ^ msb()) : key_type(~key);
+    
+    std::memcpy(&val, &tmp, sizeof(key_type));
+    }
+  
+  return val;
+  }
+
+
+
+//! number of threads to use for processing an array with the given number of elements
+inline
+uword
+sort_engine::get_n_threads(const uword n_elem)
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (n_elem >= sort_engine::threshold) && mp_gate<double>::eval(n_elem) )
+      {
+      const uword n_threads_max = uword(mp_thread_limit::get());
+      
+      return (std::min)(n_threads_max, (std::max)(uword(1), uword(n_elem / sort_engine::threshold)));
+      }
+    }
+  #else
+    {
+    arma_ignore(n_elem);
+    }
+  #endif
+  
+  return uword(1);
+  }
+
+
+
+//! stable least-significant-digit radix sort, using 8 bit digits;
+//! if 'indices' is not NULL, the indices are permuted along with the keys.
+//! each thread histograms its own chunk of the keys, and then scatters its chunk
+//! into the region of each bucket that follows the regions of the preceding threads,
+//! which keeps the sort stable irrespective of the number of threads
+template<typename key_type>
+inline
+void
+sort_engine::radix_sort(key_type* keys, uword* indices, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(n_elem < 2)  { return; }
+  
+  const uword n_threads = sort_engine::get_n_threads(n_elem);
+  const uword n_buckets = 256;
+  const uword n_passes  = sizeof(key_type);
+  
+  const bool use_indices = (indices != NULL);
+  
+  podarray<key_type> keys_tmp(n_elem);
+  podarray<uword>    indices_tmp( (use_indices) ? n_elem : uword(0) );
+  
+  podarray<uword> counts(n_threads * n_buckets);
+  podarray<uword> bounds(n_threads + 1);
+  
+  for(uword t=0; t <= n_threads; ++t)  { bounds[t] = (n_elem / n_threads) * t + (std::min)(t, n_elem % n_threads); }
+  
+  key_type* src_keys    = keys;
+  key_type* dst_keys    = keys_tmp.memptr();
+  uword*    src_indices = indices;
+  uword*    dst_indices = indices_tmp.memptr();
+  
+  for(uword pass=0; pass < n_passes; ++pass)
+    {
+    const uword shift = 8*pass;
+    
+    counts.zeros();
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+    #endif
+    for(uword t=0; t < n_threads; ++t)
+      {
+      uword* counts_t = counts.memptr() + t*n_buckets;
+      
+      const uword start = bounds[t];
+      const uword endp1 = bounds[t+1];
+      
+      for(uword i=start; i < endp1; ++i)  { ++counts_t[ uword(src_keys[i] >> shift) & 0xFF ]; }
+      }
+    
+    // skip the pass if all keys have the same digit
+    
+    bool skip_pass = false;
+    
+    uword offset = 0;
+    
+    for(uword b=0; b < n_buckets; ++b)
+      {
+      const uword offset_start = offset;
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        uword& count = counts[t*n_buckets + b];
+        
+        const uword tmp = count;
+        
+        count   = offset;
+        offset += tmp;
+        }
+      
+      if( (offset - offset_start) == n_elem )  { skip_pass = true; break; }
+      }
+    
+    if(skip_pass)  { continue; }
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+    #endif
+    for(uword t=0; t < n_threads; ++t)
+      {
+      uword* pos_t = counts.memptr() + t*n_buckets;
+      
+      const uword start = bounds[t];
+      const uword endp1 = bounds[t+1];
+      
+      if(use_indices)
+        {
+        for(uword i=start; i < endp1; ++i)
+          {
+          const key_type key = src_keys[i];
+          const uword    pos = pos_t[ uword(key >> shift) & 0xFF ]++;
+          
+          dst_keys[pos]    = key;
+          dst_indices[pos] = src_indices[i];
+          }
+        }
+      else
+        {
+        for(uword i=start; i < endp1; ++i)
+          {
+          const key_type key = src_keys[i];
+          
+          dst_keys[ pos_t[ uword(key >> shift) & 0xFF ]++ ] = key;
+          }
+        }
+      }
+    
+    std::swap(src_keys,    dst_keys   );
+    std::swap(src_indices, dst_indices);
+    }
+  
+  if(src_keys != keys)
+    {
+    arrayops::copy(keys, src_keys, n_elem);
+    
+    if(use_indices)  { arrayops::copy(indices, src_indices, n_elem); }
+    }
+  }
+
+
+
+//! chunks of the array are sorted in parallel, followed by rounds of pairwise merging of the chunks
+template<typename eT, typename comparator_type>
+inline
+void
+sort_engine::merge_sort(eT* X, const uword n_elem, const comparator_type& comparator, const bool stable)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_threads = sort_engine::get_n_threads(n_elem);
+  
+  if(n_threads <= 1)
+    {
+    if(stable)  { std::stable_sort(X, X + n_elem, comparator); }
+    else        { std::sort       (X, X + n_elem, comparator); }
+    
+    return;
+    }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    podarray<uword> bounds(n_threads + 1);
+    
+    for(uword t=0; t <= n_threads; ++t)  { bounds[t] = (n_elem / n_threads) * t + (std::min)(t, n_elem % n_threads); }
+    
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+    for(uword t=0; t < n_threads; ++t)
+      {
+      if(stable)  { std::stable_sort(X + bounds[t], X + bounds[t+1], comparator); }
+      else        { std::sort       (X + bounds[t], X + bounds[t+1], comparator); }
+      }
+    
+    std::vector<eT> buffer(n_elem);
+    
+    eT* src = X;
+    eT* dst = &(buffer[0]);
+    
+    for(uword width=1; width < n_threads; width *= 2)
+      {
+      const uword n_pairs = (n_threads + 2*width - 1) / (2*width);
+      
+      #pragma omp parallel for schedule(static) num_threads(int((std::min)(n_pairs, n_threads)))
+      for(uword p=0; p < n_pairs; ++p)
+        {
+        const uword start = bounds[ p*2*width ];
+        const uword mid   = bounds[ (std::min)(p*2*width +   width, n_threads) ];
+        const uword endp1 = bounds[ (std::min)(p*2*width + 2*width, n_threads) ];
+        
+        // std::merge() takes equivalent elements from the first range first, so stability is retained
+        std::merge(src + start, src + mid, src + mid, src + endp1, dst + start, comparator);
+        }
+      
+      std::swap(src, dst);
+      }
+    
+    if(src != X)  { std::copy(src, src + n_elem, X); }
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+void
+sort_engine::sort(eT* X, const uword n_elem, const uword sort_type, const typename enable_if<sort_engine_key<eT>::supported == true>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  if(n_elem < sort_engine::threshold)
+    {
+    if(sort_type == 0)
+      {
+      arma_ascend_sort_helper<eT>  comparator;
+      
+      std::sort(X, X + n_elem, comparator);
+      }
+    else
+      {
+      arma_descend_sort_helper<eT> comparator;
+      
+      std::sort(X, X + n_elem, comparator);
+      }
+    
+    return;
+    }
+  
+  typedef typename sort_engine_key<eT>::key_type key_type;
+  
+  const key_type flip      = sort_engine_key<eT>::flip(sort_type);
+  const uword    n_threads = sort_engine::get_n_threads(n_elem);
+  
+  podarray<key_type> keys(n_elem);
+  
+  key_type* keys_mem = keys.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+  #endif
+  for(uword i=0; i < n_elem; ++i)  { keys_mem[i] = key_type(sort_engine_key<eT>::to_key(X[i]) ^ flip); }
+  
+  sort_engine::radix_sort(keys_mem, (uword*)(NULL), n_elem);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1)
+  #endif
+  for(uword i=0; i < n_elem; ++i)  { X[i] = sort_engine_key<eT>::from_key( key_type(keys_mem[i] ^ flip) ); }
+  
+  arma_ignore(n_threads);
+  }
+
+
+
+template<typename eT>
+inline
+void
+sort_engine::sort(eT* X, const uword n_elem, const uword sort_type, const typename enable_if<sort_engine_key<eT>::supported == false>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  if(sort_type == 0)
+    {
+    arma_ascend_sort_helper<eT>  comparator;
+    
+    sort_engine::merge_sort(X, n_elem, comparator, false);
+    }
+  else
+    {
+    arma_descend_sort_helper<eT> comparator;
+    
+    sort_engine::merge_sort(X, n_elem, comparator, false);
+    }
+  }
+
+
+
+//! the radix sort is stable, so both stable and unstable sorts are handled via the same code;
+//! returns false if any element is NaN
+template<typename eT>
+inline
+bool
+sort_engine::sort_index(uword* out, const eT* X, const uword n_elem, const uword sort_type, const bool stable, const typename enable_if<sort_engine_key<eT>::supported == true>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  if(n_elem < sort_engine::threshold)  { return sort_engine::sort_index_packets(out, X, n_elem, sort_type, stable); }
+  
+  typedef typename sort_engine_key<eT>::key_type key_type;
+  
+  const key_type flip      = sort_engine_key<eT>::flip(sort_type);
+  const uword    n_threads = sort_engine::get_n_threads(n_elem);
+  
+  podarray<key_type> keys(n_elem);
+  
+  key_type* keys_mem = keys.memptr();
+  
+  bool all_non_nan = true;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(n_threads > 1) reduction(&&:all_non_nan)
+  #endif
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT val = X[i];
+    
+    if(arma_isnan(val))  { all_non_nan = false; }
+    
+    // -0 and +0 are equivalent, so they must map to the same key to keep the original order of equal elements
+    keys_mem[i] = key_type(sort_engine_key<eT>::to_key( (val == eT(0)) ? eT(0) : val ) ^ flip);
+    
+    out[i] = i;
+    }
+  
+  if(all_non_nan == false)  { return false; }
+  
+  sort_engine::radix_sort(keys_mem, out, n_elem);
+  
+  arma_ignore(n_threads);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sort_engine::sort_index(uword* out, const eT* X, const uword n_elem, const uword sort_type, const bool stable, const typename enable_if<sort_engine_key<eT>::supported == false>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  return sort_engine::sort_index_packets(out, X, n_elem, sort_type, stable);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sort_engine::sort_index_packets(uword* out, const eT* X, const uword n_elem, const uword sort_type, const bool stable)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(n_elem == 0)  { return true; }
+  
+  std::vector< arma_sort_index_packet<eT> > packet_vec(n_elem);
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT val = X[i];
+    
+    if(arma_isnan(val))  { return false; }
+    
+    packet_vec[i].val   = val;
+    packet_vec[i].index = i;
+    }
+  
+  if(sort_type == 0)
+    {
+    arma_sort_index_helper_ascend<eT>  comparator;
+    
+    sort_engine::merge_sort(&(packet_vec[0]), n_elem, comparator, stable);
+    }
+  else
+    {
+    arma_sort_index_helper_descend<eT> comparator;
+    
+    sort_engine::merge_sort(&(packet_vec[0]), n_elem, comparator, stable);
+    }
+  
+  for(uword i=0; i < n_elem; ++i)  { out[i] = packet_vec[i].index; }
+  
+  return true;
+  }
+
+
+
+//! @}
@@ -53,6 +53,10 @@ class subview : public Base<eT, subview<eT> >
   template<typename op_type, typename T1> inline void inplace_op(const Base<eT,T1>& x,   const char* identifier);
   template<typename op_type             > inline void inplace_op(const subview<eT>& x,   const char* identifier);
   
+  template<typename op_type, typename T1                                  > inline bool inplace_op_direct(const T1& x);
+  template<typename op_type, typename T1, typename eop_type               > inline bool inplace_op_direct(const eOp<T1, eop_type>& x);
+  template<typename op_type, typename T1, typename T2, typename eglue_type> inline bool inplace_op_direct(const eGlue<T1, T2, eglue_type>& x);
+  
   // deliberately returning void
   
   inline void operator=  (const eT val);
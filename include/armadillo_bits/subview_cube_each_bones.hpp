@@ -49,11 +49,13 @@ class subview_cube_each1 : public subview_cube_each_common<eT>
   {
   protected:
   
-  arma_inline subview_cube_each1(const Cube<eT>& in_p);
+  arma_inline subview_cube_each1(const Cube<eT>& in_p, const bool in_P_is_tmp = false);
   
   
   public:
   
+  const bool P_is_tmp;  //!< true if the parent is a temporary cube, whose memory can be reused by the arithmetic operators
+  
   inline ~subview_cube_each1();
   
   // deliberately returning void
@@ -106,6 +108,12 @@ class subview_cube_each1_aux
   {
   public:
   
+  template<typename eT>
+  static inline bool steal_parent(Cube<eT>& out, const subview_cube_each1<eT>& X, const Mat<eT>& A);
+  
+  template<typename eglue_type, typename eT>
+  static inline Cube<eT> apply(const subview_cube_each1<eT>& X, const Mat<eT>& A, const bool reverse);
+  
   template<typename eT, typename T2>
   static inline Cube<eT> operator_plus(const subview_cube_each1<eT>& X, const Base<eT,T2>& Y);
     
@@ -80,8 +80,9 @@ subview_cube_each1<eT>::~subview_cube_each1()
 
 template<typename eT>
 inline
-subview_cube_each1<eT>::subview_cube_each1(const Cube<eT>& in_p)
+subview_cube_each1<eT>::subview_cube_each1(const Cube<eT>& in_p, const bool in_P_is_tmp)
   : subview_cube_each_common<eT>::subview_cube_each_common(in_p)
+  , P_is_tmp(in_P_is_tmp)
   {
   arma_extra_debug_sigprint();
   }
@@ -128,12 +129,19 @@ subview_cube_each1<eT>::operator+= (const Base<eT,T1>& in)
   
   subview_cube_each_common<eT>::check_size(A);
   
-  const uword p_n_slices     = p.n_slices;
-  const uword p_n_elem_slice = p.n_elem_slice;
+  // A may be a slice of p; the slices are processed in parallel, so a copy of A is required
+  const bool is_alias = (A.memptr() >= p.memptr()) && (A.memptr() < (p.memptr() + p.n_elem));
   
-  const eT* A_mem = A.memptr();
+  if(is_alias)
+    {
+    const Mat<eT> A_copy(A);
     
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_plus( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+    each_engine::apply_cube<eglue_plus>(p, p, A_copy.memptr());
+    }
+  else
+    {
+    each_engine::apply_cube<eglue_plus>(p, p, A.memptr());
+    }
   }
 
 
@@ -153,12 +161,18 @@ subview_cube_each1<eT>::operator-= (const Base<eT,T1>& in)
   
   subview_cube_each_common<eT>::check_size(A);
   
-  const uword p_n_slices     = p.n_slices;
-  const uword p_n_elem_slice = p.n_elem_slice;
+  const bool is_alias = (A.memptr() >= p.memptr()) && (A.memptr() < (p.memptr() + p.n_elem));
   
-  const eT* A_mem = A.memptr();
-  
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_minus( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  if(is_alias)
+    {
+    const Mat<eT> A_copy(A);
+    
+    each_engine::apply_cube<eglue_minus>(p, p, A_copy.memptr());
+    }
+  else
+    {
+    each_engine::apply_cube<eglue_minus>(p, p, A.memptr());
+    }
   }
 
 
@@ -178,12 +192,18 @@ subview_cube_each1<eT>::operator%= (const Base<eT,T1>& in)
   
   subview_cube_each_common<eT>::check_size(A);
   
-  const uword p_n_slices     = p.n_slices;
-  const uword p_n_elem_slice = p.n_elem_slice;
+  const bool is_alias = (A.memptr() >= p.memptr()) && (A.memptr() < (p.memptr() + p.n_elem));
   
-  const eT* A_mem = A.memptr();
-  
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_mul( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  if(is_alias)
+    {
+    const Mat<eT> A_copy(A);
+    
+    each_engine::apply_cube<eglue_schur>(p, p, A_copy.memptr());
+    }
+  else
+    {
+    each_engine::apply_cube<eglue_schur>(p, p, A.memptr());
+    }
   }
 
 
@@ -203,12 +223,18 @@ subview_cube_each1<eT>::operator/= (const Base<eT,T1>& in)
   
   subview_cube_each_common<eT>::check_size(A);
   
-  const uword p_n_slices     = p.n_slices;
-  const uword p_n_elem_slice = p.n_elem_slice;
-  
-  const eT* A_mem = A.memptr();
+  const bool is_alias = (A.memptr() >= p.memptr()) && (A.memptr() < (p.memptr() + p.n_elem));
   
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_div( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  if(is_alias)
+    {
+    const Mat<eT> A_copy(A);
+    
+    each_engine::apply_cube<eglue_div>(p, p, A_copy.memptr());
+    }
+  else
+    {
+    each_engine::apply_cube<eglue_div>(p, p, A.memptr());
+    }
   }
 
 
@@ -465,36 +491,58 @@ subview_cube_each2<eT,TB>::operator/= (const Base<eT,T1>& in)
 
 
 
-template<typename eT, typename T2>
+//! if the parent of X is a temporary cube which owns its memory and does not share it with A,
+//! move its memory into out, so that the operation can be done in-place without allocating a new cube
+template<typename eT>
 inline
-Cube<eT>
-subview_cube_each1_aux::operator_plus
-  (
-  const subview_cube_each1<eT>& X,
-  const Base<eT,T2>&            Y
-  )
+bool
+subview_cube_each1_aux::steal_parent(Cube<eT>& out, const subview_cube_each1<eT>& X, const Mat<eT>& A)
   {
   arma_extra_debug_sigprint();
   
-  const Cube<eT>& p = X.P;
+  const Cube<eT>& P = X.P;
   
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
-  const uword p_n_slices = p.n_slices;
+  if(X.P_is_tmp == false)  { return false; }
   
-  Cube<eT> out(p_n_rows, p_n_cols, p_n_slices);
+  if( (P.mem_state != 0) || (P.n_elem <= Cube_prealloc::mem_n_elem) )  { return false; }
   
-  const unwrap<T2>   tmp(Y.get_ref());
-  const Mat<eT>& A = tmp.M;
+  const eT* A_mem = A.memptr();
+  const eT* P_mem = P.memptr();
   
-  X.check_size(A);
+  const bool overlap = (A_mem < (P_mem + P.n_elem)) && (P_mem < (A_mem + A.n_elem));
+  
+  if(overlap)  { return false; }
+  
+  arma_extra_debug_print("subview_cube_each1_aux::steal_parent(): reusing memory of temporary cube");
+  
+  out.steal_mem( access::rw(P) );
+  
+  return true;
+  }
+
+
+
+//! out = X.P (op) A for each slice, or A (op) X.P if reverse is true
+template<typename eglue_type, typename eT>
+inline
+Cube<eT>
+subview_cube_each1_aux::apply(const subview_cube_each1<eT>& X, const Mat<eT>& A, const bool reverse)
+  {
+  arma_extra_debug_sigprint();
+  
+  const Cube<eT>& p = X.P;
   
-  for(uword i=0; i < p_n_slices; ++i)
+  Cube<eT> out;
+  
+  if(subview_cube_each1_aux::steal_parent(out, X, A))
+    {
+    each_engine::apply_cube<eglue_type>(out, out, A.memptr(), reverse);
+    }
+  else
     {
-          Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
+    out.set_size(p.n_rows, p.n_cols, p.n_slices);
     
-    out_slice = p_slice + A;
+    each_engine::apply_cube<eglue_type>(out, p, A.memptr(), reverse);
     }
   
   return out;
@@ -505,7 +553,7 @@ subview_cube_each1_aux::operator_plus
 template<typename eT, typename T2>
 inline
 Cube<eT>
-subview_cube_each1_aux::operator_minus
+subview_cube_each1_aux::operator_plus
   (
   const subview_cube_each1<eT>& X,
   const Base<eT,T2>&            Y
@@ -513,28 +561,33 @@ subview_cube_each1_aux::operator_minus
   {
   arma_extra_debug_sigprint();
   
-  const Cube<eT>& p = X.P;
+  const unwrap<T2>   tmp(Y.get_ref());
+  const Mat<eT>& A = tmp.M;
   
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
-  const uword p_n_slices = p.n_slices;
+  X.check_size(A);
   
-  Cube<eT> out(p_n_rows, p_n_cols, p_n_slices);
+  return subview_cube_each1_aux::apply<eglue_plus>(X, A, false);
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+Cube<eT>
+subview_cube_each1_aux::operator_minus
+  (
+  const subview_cube_each1<eT>& X,
+  const Base<eT,T2>&            Y
+  )
+  {
+  arma_extra_debug_sigprint();
   
   const unwrap<T2>   tmp(Y.get_ref());
   const Mat<eT>& A = tmp.M;
   
   X.check_size(A);
   
-  for(uword i=0; i < p_n_slices; ++i)
-    {
-          Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = p_slice - A;
-    }
-  
-  return out;
+  return subview_cube_each1_aux::apply<eglue_minus>(X, A, false);
   }
 
 
@@ -550,28 +603,12 @@ subview_cube_each1_aux::operator_minus
   {
   arma_extra_debug_sigprint();
   
-  const Cube<eT>& p = Y.P;
-  
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
-  const uword p_n_slices = p.n_slices;
-  
-  Cube<eT> out(p_n_rows, p_n_cols, p_n_slices);
-  
   const unwrap<T1>   tmp(X.get_ref());
   const Mat<eT>& A = tmp.M;
   
   Y.check_size(A);
   
-  for(uword i=0; i < p_n_slices; ++i)
-    {
-          Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = A - p_slice;
-    }
-  
-  return out;
+  return subview_cube_each1_aux::apply<eglue_minus>(Y, A, true);
   }
 
 
@@ -587,28 +624,12 @@ subview_cube_each1_aux::operator_schur
   {
   arma_extra_debug_sigprint();
   
-  const Cube<eT>& p = X.P;
-  
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
-  const uword p_n_slices = p.n_slices;
-  
-  Cube<eT> out(p_n_rows, p_n_cols, p_n_slices);
-  
   const unwrap<T2>   tmp(Y.get_ref());
   const Mat<eT>& A = tmp.M;
   
   X.check_size(A);
   
-  for(uword i=0; i < p_n_slices; ++i)
-    {
-          Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = p_slice % A;
-    }
-  
-  return out;
+  return subview_cube_each1_aux::apply<eglue_schur>(X, A, false);
   }
 
 
@@ -624,28 +645,12 @@ subview_cube_each1_aux::operator_div
   {
   arma_extra_debug_sigprint();
   
-  const Cube<eT>& p = X.P;
-  
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
-  const uword p_n_slices = p.n_slices;
-  
-  Cube<eT> out(p_n_rows, p_n_cols, p_n_slices);
-  
   const unwrap<T2>   tmp(Y.get_ref());
   const Mat<eT>& A = tmp.M;
   
   X.check_size(A);
   
-  for(uword i=0; i < p_n_slices; ++i)
-    {
-          Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = p_slice / A;
-    }
-  
-  return out;
+  return subview_cube_each1_aux::apply<eglue_div>(X, A, false);
   }
 
 
@@ -661,28 +666,12 @@ subview_cube_each1_aux::operator_div
   {
   arma_extra_debug_sigprint();
   
-  const Cube<eT>& p = Y.P;
-  
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
-  const uword p_n_slices = p.n_slices;
-  
-  Cube<eT> out(p_n_rows, p_n_cols, p_n_slices);
-  
   const unwrap<T1>   tmp(X.get_ref());
   const Mat<eT>& A = tmp.M;
   
   Y.check_size(A);
   
-  for(uword i=0; i < p_n_slices; ++i)
-    {
-          Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = A / p_slice;
-    }
-  
-  return out;
+  return subview_cube_each1_aux::apply<eglue_div>(Y, A, true);
   }
 
 
@@ -56,13 +56,15 @@ class subview_each1 : public subview_each_common<parent, mode>
   {
   protected:
   
-  arma_inline subview_each1(const parent& in_P);
+  arma_inline subview_each1(const parent& in_P, const bool in_P_is_tmp = false);
   
   
   public:
   
   typedef typename parent::elem_type eT;
   
+  const bool P_is_tmp;  //!< true if the parent is a temporary matrix, whose memory can be reused by the arithmetic operators
+  
   inline ~subview_each1();
   
   // deliberately returning void
@@ -118,6 +120,15 @@ class subview_each1_aux
   {
   public:
   
+  template<typename parent, unsigned int mode>
+  static inline bool steal_parent(Mat<typename parent::elem_type>& out, const subview_each1<parent,mode>& X, const Mat<typename parent::elem_type>& A);
+  
+  template<typename eT, unsigned int mode>
+  static inline bool steal_parent(Mat<eT>& out, const subview_each1<Mat<eT>,mode>& X, const Mat<eT>& A);
+  
+  template<typename eglue_type, typename parent, unsigned int mode>
+  static inline Mat<typename parent::elem_type> apply(const subview_each1<parent,mode>& X, const Mat<typename parent::elem_type>& A, const bool reverse);
+  
   template<typename parent, unsigned int mode, typename T2>
   static inline Mat<typename parent::elem_type> operator_plus(const subview_each1<parent,mode>& X, const Base<typename parent::elem_type,T2>& Y);
     
@@ -127,8 +127,9 @@ subview_each1<parent,mode>::~subview_each1()
 
 template<typename parent, unsigned int mode>
 inline
-subview_each1<parent,mode>::subview_each1(const parent& in_P)
+subview_each1<parent,mode>::subview_each1(const parent& in_P, const bool in_P_is_tmp)
   : subview_each_common<parent,mode>::subview_each_common(in_P)
+  , P_is_tmp(in_P_is_tmp)
   {
   arma_extra_debug_sigprint();
   }
@@ -187,24 +188,7 @@ subview_each1<parent,mode>::operator+= (const Base<eT,T1>& in)
   
   subview_each_common<parent,mode>::check_size(A);
   
-  const eT*   A_mem    = A.memptr();
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-    
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_plus( p.colptr(i), A_mem, p_n_rows );
-      }
-    }
-  else // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_plus( p.colptr(i), A_mem[i], p_n_rows);
-      }
-    }
+  each_engine::apply_mat<eglue_plus>(p, p, A.memptr(), mode);
   }
 
 
@@ -224,24 +208,7 @@ subview_each1<parent,mode>::operator-= (const Base<eT,T1>& in)
   
   subview_each_common<parent,mode>::check_size(A);
   
-  const eT*   A_mem    = A.memptr();
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-    
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_minus( p.colptr(i), A_mem, p_n_rows );
-      }
-    }
-  else // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_minus( p.colptr(i), A_mem[i], p_n_rows);
-      }
-    }
+  each_engine::apply_mat<eglue_minus>(p, p, A.memptr(), mode);
   }
 
 
@@ -261,24 +228,7 @@ subview_each1<parent,mode>::operator%= (const Base<eT,T1>& in)
   
   subview_each_common<parent,mode>::check_size(A);
   
-  const eT*   A_mem    = A.memptr();
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_mul( p.colptr(i), A_mem, p_n_rows );
-      }
-    }
-  else // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_mul( p.colptr(i), A_mem[i], p_n_rows);
-      }
-    }
+  each_engine::apply_mat<eglue_schur>(p, p, A.memptr(), mode);
   }
 
 
@@ -298,24 +248,7 @@ subview_each1<parent,mode>::operator/= (const Base<eT,T1>& in)
   
   subview_each_common<parent,mode>::check_size(A);
   
-  const eT*   A_mem    = A.memptr();
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_div( p.colptr(i), A_mem, p_n_rows );
-      }
-    }
-  else // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      arrayops::inplace_div( p.colptr(i), A_mem[i], p_n_rows);
-      }
-    }
+  each_engine::apply_mat<eglue_div>(p, p, A.memptr(), mode);
   }
 
 
@@ -636,61 +569,76 @@ subview_each2<parent,mode,TB>::operator/= (const Base<eT,T1>& in)
 
 
 
-template<typename parent, unsigned int mode, typename T2>
+template<typename parent, unsigned int mode>
 inline
-Mat<typename parent::elem_type>
-subview_each1_aux::operator_plus
-  (
-  const subview_each1<parent,mode>&          X,
-  const Base<typename parent::elem_type,T2>& Y
-  )
+bool
+subview_each1_aux::steal_parent(Mat<typename parent::elem_type>& out, const subview_each1<parent,mode>& X, const Mat<typename parent::elem_type>& A)
+  {
+  arma_ignore(out);
+  arma_ignore(X);
+  arma_ignore(A);
+  
+  return false;
+  }
+
+
+
+//! if the parent of X is a temporary matrix which owns its memory and does not share it with A,
+//! move its memory into out, so that the operation can be done in-place without allocating a new matrix
+template<typename eT, unsigned int mode>
+inline
+bool
+subview_each1_aux::steal_parent(Mat<eT>& out, const subview_each1<Mat<eT>,mode>& X, const Mat<eT>& A)
   {
   arma_extra_debug_sigprint();
   
-  typedef typename parent::elem_type eT;
+  const Mat<eT>& P = X.P;
   
-  const parent& p = X.P;
+  if( (X.P_is_tmp == false) || (&A == &P) )  { return false; }
   
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
+  // only memory owned by the parent and allocated on the heap is taken over;
+  // external memory (eg. from an advanced constructor) must not be overwritten
+  if( (P.mem_state != 0) || (P.n_elem <= arma_config::mat_prealloc) )  { return false; }
   
-  Mat<eT> out(p_n_rows, p_n_cols);
+  const eT* A_mem = A.memptr();
+  const eT* P_mem = P.memptr();
   
-  const quasi_unwrap<T2> tmp(Y.get_ref());
-  const Mat<eT>& A     = tmp.M;
+  const bool overlap = (A_mem < (P_mem + P.n_elem)) && (P_mem < (A_mem + A.n_elem));
   
-  X.check_size(A);
+  if(overlap)  { return false; }
   
-  const eT* A_mem = A.memptr();
+  arma_extra_debug_print("subview_each1_aux::steal_parent(): reusing memory of temporary matrix");
   
-  if(mode == 0) // each column
+  out.steal_mem( access::rw(P) );
+  
+  return true;
+  }
+
+
+
+//! out = X.P (op) A, or A (op) X.P if reverse is true, with A broadcast along the columns or rows
+template<typename eglue_type, typename parent, unsigned int mode>
+inline
+Mat<typename parent::elem_type>
+subview_each1_aux::apply(const subview_each1<parent,mode>& X, const Mat<typename parent::elem_type>& A, const bool reverse)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename parent::elem_type eT;
+  
+  const parent& p = X.P;
+  
+  Mat<eT> out;
+  
+  if(subview_each1_aux::steal_parent(out, X, A))
     {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] + A_mem[row];
-        }
-      }
+    each_engine::apply_mat<eglue_type>(out, out, A.memptr(), mode, reverse);
     }
-  
-  if(mode == 1) // each row
+  else
     {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      const eT A_val = A_mem[i];
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] + A_val;
-        }
-      }
+    out.set_size(p.n_rows, p.n_cols);
+    
+    each_engine::apply_mat<eglue_type>(out, p, A.memptr(), mode, reverse);
     }
   
   return out;
@@ -701,7 +649,7 @@ subview_each1_aux::operator_plus
 template<typename parent, unsigned int mode, typename T2>
 inline
 Mat<typename parent::elem_type>
-subview_each1_aux::operator_minus
+subview_each1_aux::operator_plus
   (
   const subview_each1<parent,mode>&          X,
   const Base<typename parent::elem_type,T2>& Y
@@ -709,53 +657,31 @@ subview_each1_aux::operator_minus
   {
   arma_extra_debug_sigprint();
   
-  typedef typename parent::elem_type eT;
-  
-  const parent& p = X.P;
-  
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  Mat<eT> out(p_n_rows, p_n_cols);
-  
   const quasi_unwrap<T2> tmp(Y.get_ref());
-  const Mat<eT>& A     = tmp.M;
   
-  X.check_size(A);
+  X.check_size(tmp.M);
   
-  const eT* A_mem = A.memptr();
+  return subview_each1_aux::apply<eglue_plus>(X, tmp.M, false);
+  }
+
+
+
+template<typename parent, unsigned int mode, typename T2>
+inline
+Mat<typename parent::elem_type>
+subview_each1_aux::operator_minus
+  (
+  const subview_each1<parent,mode>&          X,
+  const Base<typename parent::elem_type,T2>& Y
+  )
+  {
+  arma_extra_debug_sigprint();
   
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] - A_mem[row];
-        }
-      }
-    }
+  const quasi_unwrap<T2> tmp(Y.get_ref());
   
-  if(mode == 1) // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      const eT A_val = A_mem[i];
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] - A_val;
-        }
-      }
-    }
+  X.check_size(tmp.M);
   
-  return out;
+  return subview_each1_aux::apply<eglue_minus>(X, tmp.M, false);
   }
 
 
@@ -771,53 +697,11 @@ subview_each1_aux::operator_minus
   {
   arma_extra_debug_sigprint();
   
-  typedef typename parent::elem_type eT;
-  
-  const parent& p = Y.P;
-  
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  Mat<eT> out(p_n_rows, p_n_cols);
-  
   const quasi_unwrap<T1> tmp(X.get_ref());
-  const Mat<eT>& A     = tmp.M;
-  
-  Y.check_size(A);
-  
-  const eT* A_mem = A.memptr();
-  
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = A_mem[row] - p_mem[row];
-        }
-      }
-    }
   
-  if(mode == 1) // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      const eT A_val = A_mem[i];
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = A_val - p_mem[row];
-        }
-      }
-    }
+  Y.check_size(tmp.M);
   
-  return out;
+  return subview_each1_aux::apply<eglue_minus>(Y, tmp.M, true);
   }
 
 
@@ -833,53 +717,11 @@ subview_each1_aux::operator_schur
   {
   arma_extra_debug_sigprint();
   
-  typedef typename parent::elem_type eT;
-  
-  const parent& p = X.P;
-  
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  Mat<eT> out(p_n_rows, p_n_cols);
-  
   const quasi_unwrap<T2> tmp(Y.get_ref());
-  const Mat<eT>& A     = tmp.M;
   
-  X.check_size(A);
-  
-  const eT* A_mem = A.memptr();
-  
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] * A_mem[row];
-        }
-      }
-    }
-  
-  if(mode == 1) // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      const eT A_val = A_mem[i];
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] * A_val;
-        }
-      }
-    }
+  X.check_size(tmp.M);
   
-  return out;
+  return subview_each1_aux::apply<eglue_schur>(X, tmp.M, false);
   }
 
 
@@ -895,53 +737,11 @@ subview_each1_aux::operator_div
   {
   arma_extra_debug_sigprint();
   
-  typedef typename parent::elem_type eT;
-  
-  const parent& p = X.P;
-  
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  Mat<eT> out(p_n_rows, p_n_cols);
-  
   const quasi_unwrap<T2> tmp(Y.get_ref());
-  const Mat<eT>& A     = tmp.M;
-  
-  X.check_size(A);
-  
-  const eT* A_mem = A.memptr();
   
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] / A_mem[row];
-        }
-      }
-    }
-  
-  if(mode == 1) // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      const eT A_val = A_mem[i];
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = p_mem[row] / A_val;
-        }
-      }
-    }
+  X.check_size(tmp.M);
   
-  return out;
+  return subview_each1_aux::apply<eglue_div>(X, tmp.M, false);
   }
 
 
@@ -957,53 +757,11 @@ subview_each1_aux::operator_div
   {
   arma_extra_debug_sigprint();
   
-  typedef typename parent::elem_type eT;
-  
-  const parent& p = Y.P;
-  
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
-  Mat<eT> out(p_n_rows, p_n_cols);
-  
   const quasi_unwrap<T1> tmp(X.get_ref());
-  const Mat<eT>& A     = tmp.M;
   
-  Y.check_size(A);
-  
-  const eT* A_mem = A.memptr();
+  Y.check_size(tmp.M);
   
-  if(mode == 0) // each column
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = A_mem[row] / p_mem[row];
-        }
-      }
-    }
-  
-  if(mode == 1) // each row
-    {
-    for(uword i=0; i < p_n_cols; ++i)
-      {
-      const eT*   p_mem =   p.colptr(i);
-            eT* out_mem = out.colptr(i);
-      
-      const eT A_val = A_mem[i];
-      
-      for(uword row=0; row < p_n_rows; ++row)
-        {
-        out_mem[row] = A_val / p_mem[row];
-        }
-      }
-    }
-  
-  return out;
+  return subview_each1_aux::apply<eglue_div>(Y, tmp.M, true);
   }
 
 
@@ -134,7 +134,9 @@ subview<eT>::inplace_op(const Base<eT,T1>& in, const char* identifier)
   
   if(has_overlap)  { arma_extra_debug_print("aliasing or overlap detected"); }
   
-  if( (is_Mat<typename Proxy<T1>::stored_type>::value) || (use_mp) || (has_overlap) )
+  if( (has_overlap == false) && (s.template inplace_op_direct<op_type>(P.Q)) )  { return; }
+  
+  if( (is_Mat<typename Proxy<T1>::stored_type>::value) || (has_overlap) )
     {
     const unwrap_check<typename Proxy<T1>::stored_type> tmp(P.Q, has_overlap);
     const Mat<eT>& B = tmp.M;
@@ -219,35 +221,29 @@ subview<eT>::inplace_op(const Base<eT,T1>& in, const char* identifier)
       }
     else  // not a row vector
       {
+      // each column of the submatrix is evaluated by a separate loop;
+      // the columns of large submatrices are evaluated in parallel
+      
+      arma_ignore(use_mp);
+      
       if(Proxy<T1>::use_at)
         {
+        #if defined(ARMA_USE_OPENMP)
+          #pragma omp parallel for schedule(static) num_threads(mp_thread_limit::get()) if(use_mp)
+        #endif
         for(uword ucol=0; ucol < s_n_cols; ++ucol)
           {
           eT* s_col_data = s.colptr(ucol);
           
-          uword jj;
-          for(jj=1; jj < s_n_rows; jj+=2)
+          for(uword urow=0; urow < s_n_rows; ++urow)
             {
-            const uword ii = (jj-1);
-            
-            const eT tmp1 = P.at(ii,ucol);
-            const eT tmp2 = P.at(jj,ucol);
+            const eT val = P.at(urow,ucol);
             
-            if(is_same_type<op_type, op_internal_equ  >::yes)  { (*s_col_data) =  tmp1; s_col_data++;  (*s_col_data) =  tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_plus >::yes)  { (*s_col_data) += tmp1; s_col_data++;  (*s_col_data) += tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_minus>::yes)  { (*s_col_data) -= tmp1; s_col_data++;  (*s_col_data) -= tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_schur>::yes)  { (*s_col_data) *= tmp1; s_col_data++;  (*s_col_data) *= tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_div  >::yes)  { (*s_col_data) /= tmp1; s_col_data++;  (*s_col_data) /= tmp2; s_col_data++; }
-            }
-          
-          const uword ii = (jj-1);
-          if(ii < s_n_rows)
-            {
-            if(is_same_type<op_type, op_internal_equ  >::yes)  { (*s_col_data) =  P.at(ii,ucol); }
-            if(is_same_type<op_type, op_internal_plus >::yes)  { (*s_col_data) += P.at(ii,ucol); }
-            if(is_same_type<op_type, op_internal_minus>::yes)  { (*s_col_data) -= P.at(ii,ucol); }
-            if(is_same_type<op_type, op_internal_schur>::yes)  { (*s_col_data) *= P.at(ii,ucol); }
-            if(is_same_type<op_type, op_internal_div  >::yes)  { (*s_col_data) /= P.at(ii,ucol); }
+            if(is_same_type<op_type, op_internal_equ  >::yes)  { s_col_data[urow] =  val; }
+            if(is_same_type<op_type, op_internal_plus >::yes)  { s_col_data[urow] += val; }
+            if(is_same_type<op_type, op_internal_minus>::yes)  { s_col_data[urow] -= val; }
+            if(is_same_type<op_type, op_internal_schur>::yes)  { s_col_data[urow] *= val; }
+            if(is_same_type<op_type, op_internal_div  >::yes)  { s_col_data[urow] /= val; }
             }
           }
         }
@@ -255,32 +251,24 @@ subview<eT>::inplace_op(const Base<eT,T1>& in, const char* identifier)
         {
         typename Proxy<T1>::ea_type Pea = P.get_ea();
         
-        uword count = 0;
-        
+        #if defined(ARMA_USE_OPENMP)
+          #pragma omp parallel for schedule(static) num_threads(mp_thread_limit::get()) if(use_mp)
+        #endif
         for(uword ucol=0; ucol < s_n_cols; ++ucol)
           {
           eT* s_col_data = s.colptr(ucol);
           
-          uword jj;
-          for(jj=1; jj < s_n_rows; jj+=2)
-            {
-            const eT tmp1 = Pea[count];  count++;
-            const eT tmp2 = Pea[count];  count++;
-            
-            if(is_same_type<op_type, op_internal_equ  >::yes)  { (*s_col_data) =  tmp1; s_col_data++;  (*s_col_data) =  tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_plus >::yes)  { (*s_col_data) += tmp1; s_col_data++;  (*s_col_data) += tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_minus>::yes)  { (*s_col_data) -= tmp1; s_col_data++;  (*s_col_data) -= tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_schur>::yes)  { (*s_col_data) *= tmp1; s_col_data++;  (*s_col_data) *= tmp2; s_col_data++; }
-            if(is_same_type<op_type, op_internal_div  >::yes)  { (*s_col_data) /= tmp1; s_col_data++;  (*s_col_data) /= tmp2; s_col_data++; }
-            }
+          const uword offset = ucol * s_n_rows;
           
-          if((jj-1) < s_n_rows)
+          for(uword urow=0; urow < s_n_rows; ++urow)
             {
-            if(is_same_type<op_type, op_internal_equ  >::yes)  { (*s_col_data) =  Pea[count];  count++; }
-            if(is_same_type<op_type, op_internal_plus >::yes)  { (*s_col_data) += Pea[count];  count++; }
-            if(is_same_type<op_type, op_internal_minus>::yes)  { (*s_col_data) -= Pea[count];  count++; }
-            if(is_same_type<op_type, op_internal_schur>::yes)  { (*s_col_data) *= Pea[count];  count++; }
-            if(is_same_type<op_type, op_internal_div  >::yes)  { (*s_col_data) /= Pea[count];  count++; }
+            const eT val = Pea[offset + urow];
+            
+            if(is_same_type<op_type, op_internal_equ  >::yes)  { s_col_data[urow] =  val; }
+            if(is_same_type<op_type, op_internal_plus >::yes)  { s_col_data[urow] += val; }
+            if(is_same_type<op_type, op_internal_minus>::yes)  { s_col_data[urow] -= val; }
+            if(is_same_type<op_type, op_internal_schur>::yes)  { s_col_data[urow] *= val; }
+            if(is_same_type<op_type, op_internal_div  >::yes)  { s_col_data[urow] /= val; }
             }
           }
         }
@@ -290,6 +278,71 @@ subview<eT>::inplace_op(const Base<eT,T1>& in, const char* identifier)
 
 
 
+template<typename eT>
+template<typename op_type, typename T1>
+inline
+bool
+subview<eT>::inplace_op_direct(const T1& x)
+  {
+  arma_ignore(x);
+  
+  return false;
+  }
+
+
+
+//! if the submatrix occupies a contiguous block of memory (eg. a range of whole columns),
+//! evaluate the expression directly into the block by eop_core, including its OpenMP and aligned code paths
+template<typename eT>
+template<typename op_type, typename T1, typename eop_type>
+inline
+bool
+subview<eT>::inplace_op_direct(const eOp<T1, eop_type>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  subview<eT>& s = *this;
+  
+  if( (s.n_elem == 0) || ((s.n_cols != 1) && (s.n_rows != s.m.n_rows)) )  { return false; }
+  
+  Mat<eT> tmp(s.colptr(0), s.n_rows, s.n_cols, false, true);
+  
+  if(is_same_type<op_type, op_internal_equ  >::yes)  { eop_type::apply(tmp, x);               }
+  if(is_same_type<op_type, op_internal_plus >::yes)  { eop_type::apply_inplace_plus (tmp, x); }
+  if(is_same_type<op_type, op_internal_minus>::yes)  { eop_type::apply_inplace_minus(tmp, x); }
+  if(is_same_type<op_type, op_internal_schur>::yes)  { eop_type::apply_inplace_schur(tmp, x); }
+  if(is_same_type<op_type, op_internal_div  >::yes)  { eop_type::apply_inplace_div  (tmp, x); }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+template<typename op_type, typename T1, typename T2, typename eglue_type>
+inline
+bool
+subview<eT>::inplace_op_direct(const eGlue<T1, T2, eglue_type>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  subview<eT>& s = *this;
+  
+  if( (s.n_elem == 0) || ((s.n_cols != 1) && (s.n_rows != s.m.n_rows)) )  { return false; }
+  
+  Mat<eT> tmp(s.colptr(0), s.n_rows, s.n_cols, false, true);
+  
+  if(is_same_type<op_type, op_internal_equ  >::yes)  { eglue_type::apply(tmp, x);               }
+  if(is_same_type<op_type, op_internal_plus >::yes)  { eglue_type::apply_inplace_plus (tmp, x); }
+  if(is_same_type<op_type, op_internal_minus>::yes)  { eglue_type::apply_inplace_minus(tmp, x); }
+  if(is_same_type<op_type, op_internal_schur>::yes)  { eglue_type::apply_inplace_schur(tmp, x); }
+  if(is_same_type<op_type, op_internal_div  >::yes)  { eglue_type::apply_inplace_div  (tmp, x); }
+  
+  return true;
+  }
+
+
+
 template<typename eT>
 template<typename op_type>
 inline
@@ -0,0 +1,100 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sum_engine
+//! @{
+
+
+//! element accessors for sum_engine
+
+template<typename T1>
+struct sum_engine_at_col
+  {
+  typedef typename T1::elem_type eT;
+  
+  const Proxy<T1>& P;
+  const uword      col;
+  
+  inline sum_engine_at_col(const Proxy<T1>& in_P, const uword in_col) : P(in_P), col(in_col) {}
+  
+  arma_inline eT operator[](const uword i) const { return P.at(i,col); }
+  };
+
+
+
+template<typename T1>
+struct sum_engine_at_row
+  {
+  typedef typename T1::elem_type eT;
+  
+  const Proxy<T1>& P;
+  
+  inline sum_engine_at_row(const Proxy<T1>& in_P) : P(in_P) {}
+  
+  arma_inline eT operator[](const uword i) const { return P.at(0,i); }
+  };
+
+
+
+template<typename eT, typename ea_type1, typename ea_type2>
+struct sum_engine_prod
+  {
+  const ea_type1& A;
+  const ea_type2& B;
+  
+  inline sum_engine_prod(const ea_type1& in_A, const ea_type2& in_B) : A(in_A), B(in_B) {}
+  
+  arma_inline eT operator[](const uword i) const { return eT(A[i]) * eT(B[i]); }
+  };
+
+
+
+//! Compensated summation, where the rounding error of each addition is found via the TwoSum algorithm;
+//! used by accu(), sum(), mean() and dot() when ARMA_USE_COMPENSATED_SUM is defined.
+//! The elements are split into blocks of fixed size, independent of the number of threads.
+//! Each block is summed with several independent compensated accumulators,
+//! and the block totals are combined in order, also with compensation.
+//! The result is hence the same with and without OpenMP, and for any number of threads.
+class sum_engine
+  {
+  public:
+  
+  static const uword block_size = 8192;
+  
+  template<typename eT> inline static bool use_mp(const uword n_elem);
+  
+  template<typename eT> arma_inline static void add(eT& s, eT& c, const eT x);
+  template<typename  T> arma_inline static void add(std::complex<T>& s, std::complex<T>& c, const std::complex<T>& x);
+  
+  template<typename eT> arma_inline static eT finish(const eT s, const eT c);
+  template<typename  T> arma_inline static std::complex<T> finish(const std::complex<T>& s, const std::complex<T>& c);
+  
+  template<typename eT, typename ea_type> arma_hot inline static void block(eT& s, eT& c, const ea_type& X, const uword start, const uword end);
+  
+  template<typename eT, typename ea_type> inline static eT accumulate(const ea_type& X, const uword N, const bool allow_mp = true);
+  
+  template<typename T1> inline static typename T1::elem_type accumulate_at(const Proxy<T1>& P);
+  
+  template<typename eT> arma_hot inline static void inplace_plus(eT* s, eT* c, const eT* X, const uword N);
+  
+  template<typename eT> inline static void sum_rows(eT* out, const Mat<eT>& X);
+  
+  template<typename eT> inline static eT dot(const uword N, const eT* A, const eT* B);
+  };
+
+
+
+//! @}
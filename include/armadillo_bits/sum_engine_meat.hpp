@@ -0,0 +1,301 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sum_engine
+//! @{
+
+
+
+template<typename eT>
+inline
+bool
+sum_engine::use_mp(const uword n_elem)
+  {
+  return ( arma_config::openmp && (n_elem >= 2*sum_engine::block_size) && mp_gate<eT>::eval(n_elem) );
+  }
+
+
+
+//! add x to the running sum s, accumulating the rounding error in c
+template<typename eT>
+arma_inline
+void
+sum_engine::add(eT& s, eT& c, const eT x)
+  {
+  // error-free transformation of s + x (Knuth's TwoSum), which needs neither comparisons nor branches
+  
+  const eT t = s + x;
+  const eT z = t - s;
+  
+  c += (s - (t - z)) + (x - z);
+  
+  s = t;
+  }
+
+
+
+template<typename T>
+arma_inline
+void
+sum_engine::add(std::complex<T>& s, std::complex<T>& c, const std::complex<T>& x)
+  {
+  T s_real = s.real();  T c_real = c.real();
+  T s_imag = s.imag();  T c_imag = c.imag();
+  
+  sum_engine::add(s_real, c_real, x.real());
+  sum_engine::add(s_imag, c_imag, x.imag());
+  
+  s = std::complex<T>(s_real, s_imag);
+  c = std::complex<T>(c_real, c_imag);
+  }
+
+
+
+//! combine the sum and the compensation;
+//! the compensation is ignored when the sum is not finite, as it is NaN in that case
+template<typename eT>
+arma_inline
+eT
+sum_engine::finish(const eT s, const eT c)
+  {
+  return arma_isfinite(s) ? (s + c) : s;
+  }
+
+
+
+template<typename T>
+arma_inline
+std::complex<T>
+sum_engine::finish(const std::complex<T>& s, const std::complex<T>& c)
+  {
+  return std::complex<T>( sum_engine::finish(s.real(), c.real()), sum_engine::finish(s.imag(), c.imag()) );
+  }
+
+
+
+//! add elements [start, end) of X to the running sum s and compensation c
+template<typename eT, typename ea_type>
+arma_hot
+inline
+void
+sum_engine::block(eT& s, eT& c, const ea_type& X, const uword start, const uword end)
+  {
+  // independent accumulators allow the operations to be pipelined and vectorised
+  
+  eT s_lane[8];
+  eT c_lane[8];
+  
+  for(uword k=0; k < 8; ++k)  { s_lane[k] = eT(0); c_lane[k] = eT(0); }
+  
+  uword i = start;
+  
+  for(; (i+8) <= end; i+=8)
+    {
+    for(uword k=0; k < 8; ++k)  { sum_engine::add(s_lane[k], c_lane[k], eT(X[i+k])); }
+    }
+  
+  for(; i < end; ++i)
+    {
+    sum_engine::add(s_lane[0], c_lane[0], eT(X[i]));
+    }
+  
+  for(uword k=0; k < 8; ++k)  { sum_engine::add(s, c, s_lane[k]); }
+  for(uword k=0; k < 8; ++k)  { c += c_lane[k]; }
+  }
+
+
+
+template<typename eT, typename ea_type>
+inline
+eT
+sum_engine::accumulate(const ea_type& X, const uword N, const bool allow_mp)
+  {
+  arma_extra_debug_sigprint();
+  
+  eT s = eT(0);
+  eT c = eT(0);
+  
+  if(N <= sum_engine::block_size)
+    {
+    sum_engine::block(s, c, X, 0, N);
+    
+    return sum_engine::finish(s, c);
+    }
+  
+  const uword n_blocks = (N + sum_engine::block_size - 1) / sum_engine::block_size;
+  
+  podarray<eT> block_s(n_blocks);
+  podarray<eT> block_c(n_blocks);
+  
+  eT* block_s_mem = block_s.memptr();
+  eT* block_c_mem = block_c.memptr();
+  
+  const bool use_mp = allow_mp && sum_engine::use_mp<eT>(N);
+  
+  arma_ignore(use_mp);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(mp_thread_limit::get()) if(use_mp)
+  #endif
+  for(uword b=0; b < n_blocks; ++b)
+    {
+    const uword start = b * sum_engine::block_size;
+    const uword end   = (std::min)(start + sum_engine::block_size, N);
+    
+    eT block_sum  = eT(0);
+    eT block_comp = eT(0);
+    
+    sum_engine::block(block_sum, block_comp, X, start, end);
+    
+    block_s_mem[b] = block_sum;
+    block_c_mem[b] = block_comp;
+    }
+  
+  for(uword b=0; b < n_blocks; ++b)
+    {
+    sum_engine::add(s, c, block_s_mem[b]);
+    
+    c += block_c_mem[b];
+    }
+  
+  return sum_engine::finish(s, c);
+  }
+
+
+
+//! sum of all elements accessed via P.at(); the columns are summed separately (in parallel if possible) and then combined in order
+template<typename T1>
+inline
+typename T1::elem_type
+sum_engine::accumulate_at(const Proxy<T1>& P)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword n_rows = P.get_n_rows();
+  const uword n_cols = P.get_n_cols();
+  
+  if(n_rows == 1)  { return sum_engine::accumulate<eT>(sum_engine_at_row<T1>(P),    n_cols, Proxy<T1>::use_mp); }
+  if(n_cols == 1)  { return sum_engine::accumulate<eT>(sum_engine_at_col<T1>(P, 0), n_rows, Proxy<T1>::use_mp); }
+  
+  podarray<eT> col_s(n_cols);
+  podarray<eT> col_c(n_cols);
+  
+  eT* col_s_mem = col_s.memptr();
+  eT* col_c_mem = col_c.memptr();
+  
+  const bool use_mp = Proxy<T1>::use_mp && sum_engine::use_mp<eT>(P.get_n_elem());
+  
+  arma_ignore(use_mp);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(mp_thread_limit::get()) if(use_mp)
+  #endif
+  for(uword col=0; col < n_cols; ++col)
+    {
+    eT col_sum  = eT(0);
+    eT col_comp = eT(0);
+    
+    sum_engine::block(col_sum, col_comp, sum_engine_at_col<T1>(P, col), 0, n_rows);
+    
+    col_s_mem[col] = col_sum;
+    col_c_mem[col] = col_comp;
+    }
+  
+  eT s = eT(0);
+  eT c = eT(0);
+  
+  for(uword col=0; col < n_cols; ++col)
+    {
+    sum_engine::add(s, c, col_s_mem[col]);
+    
+    c += col_c_mem[col];
+    }
+  
+  return sum_engine::finish(s, c);
+  }
+
+
+
+//! element-wise compensated addition of X to the running sums s, with compensations c;
+//! used for row-wise sums, where each column is added in turn
+template<typename eT>
+arma_hot
+inline
+void
+sum_engine::inplace_plus(eT* s, eT* c, const eT* X, const uword N)
+  {
+  for(uword i=0; i < N; ++i)  { sum_engine::add(s[i], c[i], X[i]); }
+  }
+
+
+
+//! sum of each row of X; blocks of rows are processed in parallel, without affecting the order of additions within each row
+template<typename eT>
+inline
+void
+sum_engine::sum_rows(eT* out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  podarray<eT> comp(X_n_rows);
+  
+  eT* comp_mem = comp.memptr();
+  
+  arrayops::fill_zeros(out,      X_n_rows);
+  arrayops::fill_zeros(comp_mem, X_n_rows);
+  
+  const uword n_blocks  = mp_reduce<eT>::n_row_blocks(X_n_rows, X_n_cols);
+  const uword block_len = X_n_rows / n_blocks;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_blocks)) if(n_blocks > 1)
+  #endif
+  for(uword block=0; block < n_blocks; ++block)
+    {
+    const uword row_start = block * block_len;
+    const uword len       = (block == (n_blocks-1)) ? (X_n_rows - row_start) : block_len;
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      sum_engine::inplace_plus( out + row_start, comp_mem + row_start, X.colptr(col) + row_start, len );
+      }
+    }
+  
+  for(uword row=0; row < X_n_rows; ++row)  { out[row] = sum_engine::finish(out[row], comp_mem[row]); }
+  }
+
+
+
+template<typename eT>
+inline
+eT
+sum_engine::dot(const uword N, const eT* A, const eT* B)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef const eT* ea_type;
+  
+  return sum_engine::accumulate<eT>( sum_engine_prod<eT, ea_type, ea_type>(A, B), N );
+  }
+
+
+
+//! @}
@@ -28,6 +28,22 @@ struct get_pod_type< std::complex<T2> >
 
 
 
+//! element type with half the precision, used for mixed-precision solvers;
+//! 'value' is false when no such type is supported by LAPACK
+template<typename T1>
+struct get_lower_prec_type
+  { typedef T1 result; static const bool value = false; };
+
+template<>
+struct get_lower_prec_type< double >
+  { typedef float result; static const bool value = true; };
+
+template<>
+struct get_lower_prec_type< std::complex<double> >
+  { typedef std::complex<float> result; static const bool value = true; };
+
+
+
 template<typename T>
 struct is_Mat_fixed_only
   {
@@ -76,6 +92,33 @@ struct is_Mat_fixed
 
 
 
+//! compile-time dimensions of fixed-size matrices and vectors;
+//! is_small indicates that the dimensions are suitable for the fixed-size kernels (up to 16x16);
+//! small_sq_N is the size of small square matrices, and 1 otherwise (so that the kernels can always be instantiated)
+template<typename T, bool is_fixed = is_Mat_fixed<T>::value>
+struct fixed_dims
+  {
+  static const uword n_rows = 0;
+  static const uword n_cols = 0;
+  
+  static const bool  is_small    = false;
+  static const bool  is_small_sq = false;
+  static const uword small_sq_N  = 1;
+  };
+
+template<typename T>
+struct fixed_dims<T, true>
+  {
+  static const uword n_rows = T::n_rows;
+  static const uword n_cols = T::n_cols;
+  
+  static const bool  is_small    = (n_rows >= 1) && (n_rows <= 16) && (n_cols >= 1) && (n_cols <= 16);
+  static const bool  is_small_sq = is_small && (n_rows == n_cols);
+  static const uword small_sq_N  = (is_small_sq) ? n_rows : 1;
+  };
+
+
+
 template<typename T>
 struct is_Mat_only
   { static const bool value = is_Mat_fixed_only<T>::value; };
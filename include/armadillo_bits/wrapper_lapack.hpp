@@ -440,6 +440,40 @@ namespace lapack
   
   
   
+  template<typename eT>
+  inline
+  void
+  potrs(char* uplo, blas_int* n, blas_int* nrhs, const eT* a, blas_int* lda, eT* b, blas_int* ldb, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    if(is_float<eT>::value)
+      {
+      typedef float T;
+      arma_fortran(arma_spotrs)(uplo, n, nrhs, (T*)a, lda, (T*)b, ldb, info);
+      }
+    else
+    if(is_double<eT>::value)
+      {
+      typedef double T;
+      arma_fortran(arma_dpotrs)(uplo, n, nrhs, (T*)a, lda, (T*)b, ldb, info);
+      }
+    else
+    if(is_supported_complex_float<eT>::value)
+      {
+      typedef std::complex<float> T;
+      arma_fortran(arma_cpotrs)(uplo, n, nrhs, (T*)a, lda, (T*)b, ldb, info);
+      }
+    else
+    if(is_supported_complex_double<eT>::value)
+      {
+      typedef std::complex<double> T;
+      arma_fortran(arma_zpotrs)(uplo, n, nrhs, (T*)a, lda, (T*)b, ldb, info);
+      }
+    }
+  
+  
+  
   template<typename eT>
   inline
   void
@@ -1301,6 +1335,54 @@ namespace lapack
   
   
   
+  template<typename eT>
+  inline
+  void
+  pocon(char* uplo, blas_int* n, const eT* a, blas_int* lda, eT* anorm, eT* rcond, eT* work, blas_int* iwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    if(is_float<eT>::value)
+      {
+      typedef float T;
+      arma_fortran(arma_spocon)(uplo, n, (T*)a, lda, (T*)anorm, (T*)rcond, (T*)work, iwork, info);
+      }
+    else
+    if(is_double<eT>::value)
+      {
+      typedef double T;
+      arma_fortran(arma_dpocon)(uplo, n, (T*)a, lda, (T*)anorm, (T*)rcond, (T*)work, iwork, info);
+      }
+    }
+  
+  
+  
+  template<typename T>
+  inline
+  void
+  cx_pocon(char* uplo, blas_int* n, const std::complex<T>* a, blas_int* lda, T* anorm, T* rcond, std::complex<T>* work, T* rwork, blas_int* info)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    if(is_supported_complex_float<eT>::value)
+      {
+      typedef float                    pod_T;
+      typedef typename std::complex<T>  cx_T;
+      arma_fortran(arma_cpocon)(uplo, n, (cx_T*)a, lda, (pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info);
+      }
+    else
+    if(is_supported_complex_double<eT>::value)
+      {
+      typedef double                   pod_T;
+      typedef typename std::complex<T>  cx_T;
+      arma_fortran(arma_zpocon)(uplo, n, (cx_T*)a, lda, (pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info);
+      }
+    }
+  
+  
+  
   inline
   blas_int
   laenv(blas_int* ispec, char* name, char* opts, blas_int* n1, blas_int* n2, blas_int* n3, blas_int* n4)
@@ -1347,32 +1429,32 @@ namespace lapack
   template<typename eT>
   inline
   void
-  getrs(char* trans, blas_int* n, blas_int* nrhs, eT* a, blas_int* lda, blas_int* ipiv, eT* b, blas_int* ldb, blas_int* info)
+  getrs(char* trans, blas_int* n, blas_int* nrhs, const eT* a, blas_int* lda, const blas_int* ipiv, eT* b, blas_int* ldb, blas_int* info)
     {
     arma_type_check(( is_supported_blas_type<eT>::value == false ));
     
     if(is_float<eT>::value)
       {
       typedef float T;
-      arma_fortran(arma_sgetrs)(trans, n, nrhs, (T*)a, lda, ipiv, (T*)b, ldb, info);
+      arma_fortran(arma_sgetrs)(trans, n, nrhs, (T*)a, lda, (blas_int*)ipiv, (T*)b, ldb, info);
       }
     else
     if(is_double<eT>::value)
       {
       typedef double T;
-      arma_fortran(arma_dgetrs)(trans, n, nrhs, (T*)a, lda, ipiv, (T*)b, ldb, info);
+      arma_fortran(arma_dgetrs)(trans, n, nrhs, (T*)a, lda, (blas_int*)ipiv, (T*)b, ldb, info);
       }
     else
     if(is_supported_complex_float<eT>::value)
       {
       typedef std::complex<float> T;
-      arma_fortran(arma_cgetrs)(trans, n, nrhs, (T*)a, lda, ipiv, (T*)b, ldb, info);
+      arma_fortran(arma_cgetrs)(trans, n, nrhs, (T*)a, lda, (blas_int*)ipiv, (T*)b, ldb, info);
       }
     else
     if(is_supported_complex_double<eT>::value)
       {
       typedef std::complex<double> T;
-      arma_fortran(arma_zgetrs)(trans, n, nrhs, (T*)a, lda, ipiv, (T*)b, ldb, info);
+      arma_fortran(arma_zgetrs)(trans, n, nrhs, (T*)a, lda, (blas_int*)ipiv, (T*)b, ldb, info);
       }
     }
   
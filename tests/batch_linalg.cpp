@@ -0,0 +1,130 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("batch_linalg_tiny")
+  {
+  // slices up to 8x8 use the fixed-size kernels
+  
+  for(uword N=1; N <= 9; ++N)
+    {
+    cube A(N, N, 20, fill::randu);
+    cube B(N, 3, 20, fill::randu);
+    cube P(N, N, 20);
+    
+    for(uword s=0; s < A.n_slices; ++s)
+      {
+      A.slice(s) += double(2*N) * eye<mat>(N, N);
+      P.slice(s)  = A.slice(s).t() * A.slice(s);
+      }
+    
+    mat F(N, N, fill::randu);
+    
+    cube Ai = inv(A);
+    cube X  = solve(A, B);
+    vec  d  = det(A);
+    cube U  = chol(P);
+    cube L  = chol(P, "lower");
+    cube M1 = mul_slices(A, B);
+    cube M2 = mul_slices(F, A);
+    cube M3 = mul_slices(A, F);
+    
+    REQUIRE( Ai.n_slices == A.n_slices );
+    REQUIRE( d.n_elem    == A.n_slices );
+    
+    for(uword s=0; s < A.n_slices; ++s)
+      {
+      REQUIRE( accu(abs(Ai.slice(s) - inv(A.slice(s))))            == Approx(0.0) );
+      REQUIRE( accu(abs(X.slice(s)  - solve(A.slice(s), B.slice(s)))) == Approx(0.0) );
+      REQUIRE( d(s)                                                 == Approx(det(A.slice(s))) );
+      REQUIRE( accu(abs(U.slice(s)  - chol(P.slice(s))))            == Approx(0.0) );
+      REQUIRE( accu(abs(L.slice(s)  - chol(P.slice(s), "lower")))   == Approx(0.0) );
+      REQUIRE( accu(abs(M1.slice(s) - A.slice(s) * B.slice(s)))     == Approx(0.0) );
+      REQUIRE( accu(abs(M2.slice(s) - F * A.slice(s)))              == Approx(0.0) );
+      REQUIRE( accu(abs(M3.slice(s) - A.slice(s) * F))              == Approx(0.0) );
+      }
+    
+    // only the triangle given by the layout is used
+    
+    cube T = P;
+    
+    T.tube(0, N-1) += 0.5;
+    
+    cube UT = chol(T);
+    cube LT = chol(T, "lower");
+    
+    for(uword s=0; s < T.n_slices; ++s)
+      {
+      REQUIRE( accu(abs(UT.slice(s) - chol(T.slice(s))))          == Approx(0.0) );
+      REQUIRE( accu(abs(LT.slice(s) - chol(T.slice(s), "lower"))) == Approx(0.0) );
+      }
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_cx")
+  {
+  cx_cube A(4, 4, 10, fill::randu);
+  cx_cube P(4, 4, 10);
+  
+  for(uword s=0; s < A.n_slices; ++s)
+    {
+    A.slice(s) += 8.0 * eye<cx_mat>(4, 4);
+    P.slice(s)  = A.slice(s).t() * A.slice(s);
+    }
+  
+  cx_cube Ai = inv(A);
+  cx_cube U  = chol(P);
+  cx_vec  d  = det(A);
+  
+  for(uword s=0; s < A.n_slices; ++s)
+    {
+    REQUIRE( accu(abs(Ai.slice(s) - inv(A.slice(s))))  == Approx(0.0) );
+    REQUIRE( accu(abs(U.slice(s)  - chol(P.slice(s)))) == Approx(0.0) );
+    REQUIRE( std::abs(d(s) - det(A.slice(s)))          == Approx(0.0) );
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_fail")
+  {
+  cube A(3, 3, 4, fill::randu);
+  
+  A.slice(2).zeros();
+  
+  cube B;
+  
+  REQUIRE( inv(B, A) == false );
+  REQUIRE( B.n_elem == 0 );
+  
+  REQUIRE( det(A)(2) == Approx(0.0) );
+  
+  REQUIRE_THROWS( B = inv(A) );
+  
+  // non-square slices
+  
+  cube C(3, 4, 2, fill::randu);
+  
+  REQUIRE_THROWS( B = inv(C) );
+  }
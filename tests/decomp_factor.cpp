@@ -0,0 +1,173 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("decomp_factor_lu")
+  {
+  arma_rng::set_seed(123);
+  
+  mat A = randu<mat>(50,50) - 0.5;
+  
+  lu_factor<double> F(A);
+  
+  REQUIRE( F.n_rows() == 50 );
+  
+  for(uword i=0; i < 3; ++i)
+    {
+    mat B = randu<mat>(50, i+1);
+    
+    mat X1 = solve(A, B);
+    mat X2 = F.solve(B);
+    
+    REQUIRE( norm(X1 - X2, "inf") <= 1e-10 * norm(X1, "inf") );
+    }
+  
+  REQUIRE( F.det()   == Approx(det(A))   );
+  REQUIRE( F.rcond() == Approx(rcond(A)) );
+  
+  double val1, sign1;
+  double val2, sign2;
+  
+  log_det(val1, sign1, A);
+  F.log_det(val2, sign2);
+  
+  REQUIRE( val2  == Approx(val1)  );
+  REQUIRE( sign2 == Approx(sign1) );
+  
+  mat Z(10,10, fill::zeros);
+  
+  REQUIRE( F.compute(Z) == false );
+  REQUIRE( F.is_empty() );
+  
+  cx_mat C = randu<cx_mat>(20,20);
+  cx_vec b = randu<cx_vec>(20);
+  
+  lu_factor<cx_double> G(C);
+  
+  REQUIRE( norm(G.solve(b) - solve(C,b)) <= 1e-10 * norm(solve(C,b)) );
+  REQUIRE( std::abs(G.det() - det(C)) <= 1e-10 * std::abs(det(C)) );
+  }
+
+
+
+TEST_CASE("decomp_factor_chol")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword N = 40;
+  
+  mat X = randu<mat>(100,N);
+  mat A = X.t() * X;
+  mat B = randu<mat>(N,2);
+  
+  chol_factor<double> F;
+  
+  REQUIRE( F.compute(A) );
+  
+  REQUIRE( norm(F.solve(B) - solve(A,B), "inf") <= 1e-10 * norm(solve(A,B), "inf") );
+  
+  REQUIRE( F.det()   == Approx(det(A))   );
+  REQUIRE( F.rcond() == Approx(rcond(A)) );
+  
+  double val, sign;
+  F.log_det(val, sign);
+  
+  REQUIRE( val  == Approx(std::log(det(A))) );
+  REQUIRE( sign == Approx(1.0) );
+  
+  // rank-1 updates and downdates
+  
+  vec x = randu<vec>(N);
+  vec y = randu<vec>(N);
+  
+  REQUIRE( F.update(x) );
+  REQUIRE( F.update(2.0*y) );
+  
+  mat A2 = A + x*x.t() + 4.0*y*y.t();
+  
+  REQUIRE( norm(F.solve(B) - solve(A2,B), "inf") <= 1e-9 * norm(solve(A2,B), "inf") );
+  REQUIRE( F.det() == Approx(det(A2)) );
+  
+  REQUIRE( F.downdate(x) );
+  
+  mat A3 = A + 4.0*y*y.t();
+  
+  REQUIRE( norm(F.solve(B) - solve(A3,B), "inf") <= 1e-9 * norm(solve(A3,B), "inf") );
+  
+  // downdate leading to a matrix that is not positive definite: the decomposition is unchanged
+  
+  REQUIRE( F.downdate(100.0*x) == false );
+  
+  REQUIRE( norm(F.solve(B) - solve(A3,B), "inf") <= 1e-9 * norm(solve(A3,B), "inf") );
+  
+  REQUIRE( F.compute(-A) == false );
+  REQUIRE( F.is_empty() );
+  
+  // complex
+  
+  cx_mat C = randu<cx_mat>(60,20);
+  cx_mat H = C.t() * C;
+  cx_vec z = randu<cx_vec>(20);
+  cx_vec b = randu<cx_vec>(20);
+  
+  chol_factor<cx_double> G(H);
+  
+  REQUIRE( G.update(z) );
+  
+  cx_mat H2 = H + z*z.t();
+  
+  REQUIRE( norm(G.solve(b) - solve(H2,b)) <= 1e-9 * norm(solve(H2,b)) );
+  
+  REQUIRE( G.downdate(z) );
+  
+  REQUIRE( norm(G.solve(b) - solve(H,b)) <= 1e-9 * norm(solve(H,b)) );
+  }
+
+
+
+TEST_CASE("decomp_factor_qr")
+  {
+  arma_rng::set_seed(123);
+  
+  mat A = randu<mat>(80,30);
+  mat B = randu<mat>(80,3);
+  
+  qr_factor<double> F(A);
+  
+  REQUIRE( F.n_rows() == 80 );
+  REQUIRE( F.n_cols() == 30 );
+  
+  mat X1 = solve(A, B);
+  mat X2 = F.solve(B);
+  
+  REQUIRE( X2.n_rows == 30 );
+  REQUIRE( X2.n_cols ==  3 );
+  
+  REQUIRE( norm(X1 - X2, "inf") <= 1e-10 * norm(X1, "inf") );
+  
+  mat S = randu<mat>(10,10);
+  vec s = randu<vec>(10);
+  
+  REQUIRE( F.compute(S) );
+  
+  REQUIRE( norm(F.solve(s) - solve(S,s)) <= 1e-10 * norm(solve(S,s)) );
+  }
@@ -51,3 +51,96 @@ TEST_CASE("expr_misc_1")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("expr_misc_subview_1")
+  {
+  mat A = randu<mat>(300, 200);
+  mat B = randu<mat>(300, 200) + 1.0;
+  
+  mat X = randu<mat>(300, 250);
+  mat Y = X;
+  
+  // contiguous destinations: range of whole columns, single column
+  
+  X.cols(10,209)  = A + B*2.0;
+  Y.cols(10,209)  = mat(A + B*2.0);
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X.cols(20,219) += exp(A) % B;
+  Y.cols(20,219) += mat(exp(A) % B);
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X.cols(5,204) /= sqrt(B);
+  Y.cols(5,204) /= mat(sqrt(B));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X.col(3) -= 2.0 * A.col(7);
+  Y.col(3) -= vec(2.0 * A.col(7));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  // strided destinations
+  
+  X.submat(10,20,209,219) = A.rows(0,199) - B.rows(50,249);
+  Y.submat(10,20,209,219) = mat(A.rows(0,199) - B.rows(50,249));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X.submat(50,0,249,199) %= cos(A.rows(100,299));
+  Y.submat(50,0,249,199) %= mat(cos(A.rows(100,299)));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X.row(7).head(200) = 3.0 * B.row(9) + 1.0;
+  Y.row(7).head(200) = rowvec(3.0 * B.row(9) + 1.0);
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("expr_misc_subview_2")
+  {
+  // expressions which refer to the destination matrix
+  
+  mat A = randu<mat>(100, 80);
+  
+  mat X = A;
+  mat Y = A;
+  
+  X.cols(1,79) = X.cols(0,78) + 1.0;
+  Y.cols(1,79) = mat(A.cols(0,78) + 1.0);
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X = A;
+  Y = A;
+  
+  X.cols(0,39) = 2.0 * X.cols(40,79);
+  Y.cols(0,39) = mat(2.0 * A.cols(40,79));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X = A;
+  Y = A;
+  
+  X.rows(1,99) += X.rows(0,98) % X.rows(0,98);
+  Y.rows(1,99) += mat(A.rows(0,98) % A.rows(0,98));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  X = A;
+  Y = A;
+  
+  X.col(5) = X.col(5) * 2.0 + X.col(6);
+  Y.col(5) = vec(A.col(5) * 2.0 + A.col(6));
+  
+  REQUIRE( accu(abs(X - Y)) == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE_THROWS( X.cols(0,9) = A + 1.0 );
+  }
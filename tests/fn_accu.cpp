@@ -118,6 +118,80 @@ TEST_CASE("fn_accu_4")
 
 
 
+TEST_CASE("fn_accu_compensated")
+  {
+  // the summation engine used when ARMA_USE_COMPENSATED_SUM is defined
+  
+  const uword N = 100003;
+  
+  fvec x(N);
+  
+  x.fill(0.1f);
+  x(0) = 1e7f;
+  
+  double ref = 1e7;
+  for(uword i=1; i < N; ++i)  { ref += double(0.1f); }
+  
+  const float val = sum_engine::accumulate<float>(x.memptr(), N);
+  
+  REQUIRE( double(val) == Approx(ref).epsilon(1e-7) );
+  
+  if(arma_config::compensated_sum)
+    {
+    REQUIRE( accu(x) == val );
+    }
+  else
+    {
+    // plain float summation loses the small elements
+    REQUIRE( std::abs(double(accu(x)) - ref) > std::abs(double(val) - ref) );
+    }
+  
+  // complex elements, and elements from expressions
+  
+  cx_vec y(N);
+  
+  y.fill(cx_double(1e-8, -1e-8));
+  y(1) = cx_double(1e8, -1e8);
+  
+  const cx_double y_val = sum_engine::accumulate<cx_double>(y.memptr(), N);
+  
+  REQUIRE( y_val.real() == Approx( 1e8 + (N-1)*1e-8) );
+  REQUIRE( y_val.imag() == Approx(-1e8 - (N-1)*1e-8) );
+  
+  vec a = randu<vec>(N);
+  vec b = randu<vec>(N);
+  
+  REQUIRE( sum_engine::dot(N, a.memptr(), b.memptr()) == Approx(dot(a,b)) );
+  
+  // non-finite elements
+  
+  vec z = randu<vec>(N);
+  
+  z(7) = datum::inf;
+  REQUIRE( sum_engine::accumulate<double>(z.memptr(), N) == datum::inf );
+  
+  z(N-1) = -datum::inf;
+  REQUIRE( std::isnan(sum_engine::accumulate<double>(z.memptr(), N)) );
+  
+  // columns of a submatrix
+  
+  mat A = randu<mat>(300, 200);
+  
+  const subview<double> S = A.submat(1, 1, 298, 198);
+  
+  const Proxy< subview<double> > P(S);
+  
+  REQUIRE( sum_engine::accumulate_at(P) == Approx(accu(S)) );
+  
+  vec row_sums(A.n_rows);
+  
+  sum_engine::sum_rows(row_sums.memptr(), A);
+  
+  REQUIRE( approx_equal(row_sums, vec(sum(A,1)), "absdiff", 1e-10) );
+  }
+
+
+
 TEST_CASE("fn_accu_spmat")
   {
   SpMat<unsigned int> b(4, 4);
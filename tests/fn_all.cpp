@@ -92,3 +92,42 @@ TEST_CASE("fn_all_3")
   }
 
 
+
+
+
+TEST_CASE("fn_all_4")
+  {
+  // relational expressions evaluated in blocks; sizes are not multiples of the block size
+  
+  mat A(67, 5, fill::ones);
+  mat B(67, 5, fill::zeros);
+  
+  A(66,4) = -1.0;
+  A(64,1) = -1.0;
+  
+  REQUIRE( all(vectorise(A) > 0.0) == false );
+  REQUIRE( all(vectorise(A) > -2.0) == true );
+  REQUIRE( all(vectorise(A) > vectorise(B)) == false );
+  REQUIRE( all(vectorise(A) < vectorise(B) + 2.0) == true );
+  
+  REQUIRE( all(abs(vectorise(A - B)) < 1.5) == true );
+  
+  REQUIRE( accu( all(A > 0.0)    == urowvec({1, 0, 1, 1, 0}) ) == 5 );
+  REQUIRE( accu( all(A > B)      == urowvec({1, 0, 1, 1, 0}) ) == 5 );
+  REQUIRE( accu( all(A > 0.0, 1) == 0 ) == 2 );
+  REQUIRE( uvec(all(A > 0.0, 1))(64) == 0 );
+  REQUIRE( uvec(all(A > 0.0, 1))(66) == 0 );
+  
+  REQUIRE( accu( all(A.cols(1,3) > 0.0) == urowvec({0, 1, 1}) ) == 3 );
+  
+  cx_vec C(100, fill::zeros);  C(99) = cx_double(0.0, 1.0);
+  
+  REQUIRE( all(C == cx_double(0.0, 0.0)) == false );
+  REQUIRE( all(C != cx_double(1.0, 0.0)) == true  );
+  
+  umat U(3, 4, fill::ones);  U(1,2) = 0;
+  
+  U = all(U > 0);
+  
+  REQUIRE( accu( U == urowvec({1, 1, 0, 1}) ) == 4 );
+  }
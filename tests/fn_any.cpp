@@ -92,3 +92,42 @@ TEST_CASE("fn_any_3")
   }
 
 
+
+
+
+TEST_CASE("fn_any_4")
+  {
+  // relational expressions evaluated in blocks; sizes are not multiples of the block size
+  
+  mat A(67, 5, fill::zeros);
+  mat B(67, 5, fill::zeros);
+  
+  A(66,4) = 2.0;
+  A(64,1) = 2.0;
+  
+  REQUIRE( any(vectorise(A) > 1.0) == true  );
+  REQUIRE( any(vectorise(A) > 2.0) == false );
+  REQUIRE( any(vectorise(A) > vectorise(B)) == true  );
+  REQUIRE( any(vectorise(A) < vectorise(B)) == false );
+  
+  REQUIRE( any(abs(vectorise(A - B)) > 1.0) == true );
+  
+  REQUIRE( accu( any(A > 1.0)    == urowvec({0, 1, 0, 0, 1}) ) == 5 );
+  REQUIRE( accu( any(A > B)      == urowvec({0, 1, 0, 0, 1}) ) == 5 );
+  REQUIRE( accu( any(A > 1.0, 1) != 0 ) == 2 );
+  REQUIRE( uvec(any(A > 1.0, 1))(64) == 1 );
+  REQUIRE( uvec(any(A > 1.0, 1))(66) == 1 );
+  
+  REQUIRE( accu( any(A.cols(1,3) > 1.0) == urowvec({1, 0, 0}) ) == 3 );
+  
+  cx_vec C(100, fill::zeros);  C(99) = cx_double(0.0, 1.0);
+  
+  REQUIRE( any(C == cx_double(0.0, 1.0)) == true  );
+  REQUIRE( any(C == cx_double(1.0, 0.0)) == false );
+  
+  umat U(3, 4, fill::zeros);  U(1,2) = 5;
+  
+  U = any(U > 1);
+  
+  REQUIRE( accu( U == urowvec({0, 0, 1, 0}) ) == 4 );
+  }
@@ -66,3 +66,31 @@ TEST_CASE("fn_cumprod_2")
 
 
 
+TEST_CASE("fn_cumprod_3")
+  {
+  // long input, which may be scanned in parallel chunks; the values are +1 or -1, so that the results are exact
+  
+  vec x = sign(randn<vec>(200003));
+  
+  x.replace(0.0, 1.0);
+  
+  vec ref(x.n_elem);
+  
+  double acc = 1.0;
+  
+  for(uword i=0; i < x.n_elem; ++i)  { acc *= x(i);  ref(i) = acc; }
+  
+  REQUIRE( all(cumprod(x) == ref) );
+  
+  mat A = reshape(x.head(200000), 200, 1000);
+  
+  mat A1(size(A));
+  
+  for(uword c=0; c < A.n_cols; ++c)
+  for(uword r=0; r < A.n_rows; ++r)
+    {
+    A1(r,c) = (c > 0) ? A1(r,c-1) * A(r,c) : A(r,c);
+    }
+  
+  REQUIRE( all(vectorise(cumprod(A,1) == A1)) );
+  }
@@ -65,3 +65,53 @@ TEST_CASE("fn_cumsum_2")
 
 
 
+TEST_CASE("fn_cumsum_3")
+  {
+  // long inputs, which may be scanned in parallel chunks;
+  // integer values are used so that the results are exact regardless of the order of additions
+  
+  vec x = round(10.0 * randu<vec>(200003));
+  
+  vec ref(x.n_elem);
+  
+  double acc = 0.0;
+  
+  for(uword i=0; i < x.n_elem; ++i)  { acc += x(i);  ref(i) = acc; }
+  
+  REQUIRE( all(cumsum(x) == ref) );
+  REQUIRE( all(cumsum(x.t()) == ref.t()) );
+  
+  mat A = round(10.0 * randu<mat>(300, 1001));
+  mat B = round(10.0 * randu<mat>(100003, 3));
+  
+  mat A0(size(A));
+  mat A1(size(A));
+  mat B0(size(B));
+  
+  for(uword c=0; c < A.n_cols; ++c)
+  for(uword r=0; r < A.n_rows; ++r)
+    {
+    A0(r,c) = (r > 0) ? A0(r-1,c) + A(r,c) : A(r,c);
+    A1(r,c) = (c > 0) ? A1(r,c-1) + A(r,c) : A(r,c);
+    }
+  
+  for(uword c=0; c < B.n_cols; ++c)
+  for(uword r=0; r < B.n_rows; ++r)
+    {
+    B0(r,c) = (r > 0) ? B0(r-1,c) + B(r,c) : B(r,c);
+    }
+  
+  REQUIRE( all(vectorise(cumsum(A,0) == A0)) );
+  REQUIRE( all(vectorise(cumsum(A,1) == A1)) );
+  REQUIRE( all(vectorise(cumsum(B,0) == B0)) );
+  
+  ivec y = randi<ivec>(150001, distr_param(-5, 5));
+  
+  ivec y_ref(y.n_elem);
+  
+  sword y_acc = 0;
+  
+  for(uword i=0; i < y.n_elem; ++i)  { y_acc += y(i);  y_ref(i) = y_acc; }
+  
+  REQUIRE( all(cumsum(y) == y_ref) );
+  }
@@ -59,3 +59,127 @@ TEST_CASE("fn_find_1")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("fn_find_2")
+  {
+  // sizes which are not multiples of the bitmask word size
+  mat A = randn<mat>(37, 11);
+  mat B = randn<mat>(37, 11);
+  
+  uvec ref_gt;
+  uvec ref_lt;
+  uvec ref_nz;
+  
+  uword n_gt = 0;
+  uword n_lt = 0;
+  
+  for(uword i=0; i < A.n_elem; ++i)  { if(A[i] >  0.5 ) { n_gt++; } }
+  for(uword i=0; i < A.n_elem; ++i)  { if(A[i] <  B[i]) { n_lt++; } }
+  
+  ref_gt.set_size(n_gt);
+  ref_lt.set_size(n_lt);
+  
+  n_gt = 0;
+  n_lt = 0;
+  
+  for(uword i=0; i < A.n_elem; ++i)  { if(A[i] >  0.5 ) { ref_gt[n_gt++] = i; } }
+  for(uword i=0; i < A.n_elem; ++i)  { if(A[i] <  B[i]) { ref_lt[n_lt++] = i; } }
+  
+  REQUIRE( all(find(A > 0.5) == ref_gt) );
+  REQUIRE( all(find(A < B)   == ref_lt) );
+  
+  REQUIRE( accu(A > 0.5) == ref_gt.n_elem );
+  REQUIRE( accu(A < B)   == ref_lt.n_elem );
+  
+  uvec first_3 = find(A > 0.5, 3);
+  
+  REQUIRE( first_3.n_elem == (std::min)(uword(3), ref_gt.n_elem) );
+  
+  // non-contiguous source
+  mat C = A.submat(3, 2, 33, 9);
+  
+  REQUIRE( all(find(A.submat(3, 2, 33, 9) > 0.5) == find(C > 0.5)) );
+  REQUIRE( all(find(A.submat(3, 2, 33, 9))       == find(C      )) );
+  REQUIRE( accu(A.submat(3, 2, 33, 9) > 0.5)     == accu(C > 0.5)  );
+  
+  vec x(130, fill::zeros);
+  x(0) = 1.0; x(63) = 2.0; x(64) = 3.0; x(129) = 4.0;
+  
+  uvec ref_x = { 0, 63, 64, 129 };
+  
+  REQUIRE( all(find(x) == ref_x) );
+  REQUIRE( all(find(x != 0.0) == ref_x) );
+  REQUIRE( uvec(find(x == 5.0)).n_elem == 0 );
+  
+  cx_vec y(70, fill::zeros);
+  y(69) = cx_double(0.0, 1.0);
+  
+  REQUIRE( accu(y == cx_double(0.0, 1.0)) == 1 );
+  REQUIRE( uvec(find(y != cx_double(0.0, 0.0))).n_elem == 1 );
+  
+  REQUIRE_THROWS( uvec(find(A < B.t())) );
+  }
+
+
+
+TEST_CASE("fn_find_3")
+  {
+  vec x(200, fill::zeros);
+  
+  x(3) = 1.0;  x(70) = 1.0;  x(130) = 1.0;  x(199) = 1.0;
+  
+  uvec ref_first2 = { 3, 70 };
+  uvec ref_last3  = { 70, 130, 199 };
+  uvec ref_all    = { 3, 70, 130, 199 };
+  
+  REQUIRE( all(uvec(find(x > 0.5, 2))          == ref_first2) );
+  REQUIRE( all(uvec(find(x > 0.5, 3, "last"))  == ref_last3 ) );
+  REQUIRE( all(uvec(find(x > 0.5, 9))          == ref_all   ) );
+  REQUIRE( all(uvec(find(x > 0.5, 9, "last"))  == ref_all   ) );
+  REQUIRE( all(uvec(find(x, 2))                == ref_first2) );
+  REQUIRE( all(uvec(find(x, 3, "last"))        == ref_last3 ) );
+  
+  REQUIRE( uvec(find(x > 2.0, 1)).n_elem == 0 );
+  REQUIRE( uvec(find(x > 2.0, 1, "last")).n_elem == 0 );
+  
+  // non-contiguous source
+  mat A = reshape(x, 20, 10);
+  
+  REQUIRE( all(uvec(find(A.cols(0,9) > 0.5, 2, "last")) == ref_last3.tail(2) ) );
+  REQUIRE( all(uvec(find(A.rows(0,19) > 0.5, 2)) == ref_first2) );
+  REQUIRE( all(uvec(find(A.submat(0,3,19,9) > 0.5, 2, "last")) == uvec({ 70, 139 })) );
+  }
+
+
+
+TEST_CASE("fn_find_4")
+  {
+  // long input, which may be processed in parallel chunks
+  
+  vec x = randu<vec>(300007);
+  
+  x(17) = datum::nan;  x(300006) = datum::inf;
+  
+  uword n_gt = 0;
+  
+  for(uword i=0; i < x.n_elem; ++i)  { if(x(i) > 0.5) { n_gt++; } }
+  
+  uvec ref(n_gt);
+  
+  n_gt = 0;
+  
+  for(uword i=0; i < x.n_elem; ++i)  { if(x(i) > 0.5) { ref(n_gt++) = i; } }
+  
+  uvec indices = find(x > 0.5);
+  
+  REQUIRE( indices.n_elem == ref.n_elem );
+  REQUIRE( all(indices == ref) );
+  REQUIRE( accu(x > 0.5) == ref.n_elem );
+  
+  uvec ref_nonfinite = { 17, 300006 };
+  
+  REQUIRE( all(uvec(find_nonfinite(x)) == ref_nonfinite) );
+  REQUIRE( uvec(find_finite(x)).n_elem == (x.n_elem - 2) );
+  }
@@ -0,0 +1,94 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_hist_1")
+  {
+  vec x = { -datum::inf, -2.0, -0.5, 0.0, 0.25, 0.5, 0.75, 1.0, 3.0, datum::inf, datum::nan };
+  
+  vec centers = { -1.0, 0.0, 1.0 };
+  
+  uvec h = hist(x, centers);
+  
+  // values halfway between two centers are placed in the lower bin
+  
+  REQUIRE( h(0) == 3 );
+  REQUIRE( h(1) == 3 );
+  REQUIRE( h(2) == 4 );
+  
+  vec centers2 = { -1.0, 0.0, 0.1, 1.0 };
+  
+  uvec h2 = hist(x, centers2);
+  
+  REQUIRE( h2(0) == 3 );
+  REQUIRE( h2(1) == 1 );
+  REQUIRE( h2(2) == 2 );
+  REQUIRE( h2(3) == 4 );
+  }
+
+
+
+TEST_CASE("fn_hist_2")
+  {
+  mat X = randn<mat>(1000, 5);
+  
+  vec centers = linspace<vec>(-2, 2, 41);
+  
+  umat H1 = hist(X, centers);
+  umat H2 = hist(X.t(), centers, 1);
+  
+  REQUIRE( H1.n_rows == 41 );
+  REQUIRE( H1.n_cols == 5  );
+  
+  REQUIRE( accu(H1 != H2.t()) == 0 );
+  REQUIRE( accu(H1) == X.n_elem );
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    // each sample is counted in the bin with the nearest center
+    
+    REQUIRE( H1(20,col) == uword(accu( abs(X.col(col)) <= 0.05 )) );
+    }
+  }
+
+
+
+TEST_CASE("fn_histc_1")
+  {
+  vec x = { -1.0, 0.0, 0.5, 1.0, 1.5, 2.0, 3.0, datum::nan };
+  
+  vec edges = { 0.0, 1.0, 2.0 };
+  
+  uvec h = histc(x, edges);
+  
+  REQUIRE( h(0) == 2 );
+  REQUIRE( h(1) == 2 );
+  REQUIRE( h(2) == 1 );
+  
+  vec edges2 = { 0.0, 0.5, 2.0 };
+  
+  uvec h2 = histc(x, edges2);
+  
+  REQUIRE( h2(0) == 1 );
+  REQUIRE( h2(1) == 3 );
+  REQUIRE( h2(2) == 1 );
+  }
+
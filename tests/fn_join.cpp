@@ -0,0 +1,138 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_join_1")
+  {
+  mat A = randu<mat>(7,3);
+  mat B = randu<mat>(7,4);
+  mat C = randu<mat>(5,3);
+
+  mat AB = join_rows(A,B);
+  mat AC = join_cols(A,C);
+
+  REQUIRE( accu(join_rows(A,B)) == Approx(accu(AB)) );
+  REQUIRE( accu(join_cols(A,C)) == Approx(accu(AC)) );
+
+  REQUIRE( accu(abs( (2*join_rows(A,B) + 1) - (2*AB + 1) )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( sum(join_cols(A,C),0)  - sum(AC,0)    )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( sum(join_cols(A,C),1)  - sum(AC,1)    )) == Approx(0.0).epsilon(0.01) );
+
+  mat R = repmat(A.col(1), 2, 3);
+
+  REQUIRE( R.n_rows == 14 );
+  REQUIRE( R.n_cols == 3  );
+
+  REQUIRE( accu(abs( (R + 1) - (repmat(mat(A.col(1)), 2, 3) + 1) )) == Approx(0.0).epsilon(0.01) );
+  }
+
+
+
+TEST_CASE("fn_join_2")
+  {
+  mat A = randu<mat>(7,3);
+  mat B = randu<mat>(7,4);
+  mat C = randu<mat>(7,2);
+  mat D = randu<mat>(5,9);
+
+  vec    w = randu<vec>(9);
+  mat    W = randu<mat>(9,4);
+  rowvec r = randu<rowvec>(12);
+  mat    P = randu<mat>(6,12);
+
+  mat ABC = join_rows(join_rows(A,B),C);
+  mat ABD = join_cols(ABC,D);
+
+  REQUIRE( accu(abs( join_rows(join_rows(A,B),C) * w - ABC * w )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( join_rows(join_rows(A,B),C) * W - ABC * W )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( join_cols(ABC,D)            * w - ABD * w )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( join_cols(ABC,D)            * W - ABD * W )) == Approx(0.0).epsilon(0.01) );
+
+  REQUIRE( accu(abs( r * join_cols(ABC,D) - r * ABD )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( P * join_cols(ABC,D) - P * ABD )) == Approx(0.0).epsilon(0.01) );
+
+  REQUIRE( accu(abs( W.t() * join_rows(W, W.cols(1,2)) - W.t() * join_rows(W, mat(W.cols(1,2))) )) == Approx(0.0).epsilon(0.01) );
+
+  mat E;
+
+  REQUIRE( accu(abs( join_rows(E,A) * w.head(3) - A * w.head(3) )) == Approx(0.0).epsilon(0.01) );
+
+  mat F;
+
+  REQUIRE_THROWS( F = join_rows(A,D) * w );
+  REQUIRE_THROWS( F = join_rows(A,B) * w );
+  }
+
+
+
+TEST_CASE("fn_join_3")
+  {
+  mat X = randu<mat>(4,4);
+  mat Y = randu<mat>(4,4);
+
+  mat X0 = X;
+
+  X = join_rows(X,Y) * join_cols(X,Y);
+
+  REQUIRE( accu(abs( X - (X0*X0 + Y*Y) )) == Approx(0.0).epsilon(0.01) );
+
+  X = X0;
+  X = 2 * join_rows(X,Y);
+
+  REQUIRE( X.n_cols == 8 );
+  REQUIRE( accu(abs( X - 2*join_rows(X0,Y) )) == Approx(0.0).epsilon(0.01) );
+
+  X = X0;
+  X.cols(1,3) = repmat(X.col(0), 1, 3);
+
+  REQUIRE( accu(abs( X.cols(1,3) - repmat(X0.col(0), 1, 3) )) == Approx(0.0).epsilon(0.01) );
+  }
+
+
+
+TEST_CASE("fn_join_4")
+  {
+  mat A = randu<mat>(5,4);
+
+  mat R  = repmat(A, 3, 2);
+  mat R0 = repmat(A, 0, 2);
+
+  REQUIRE( accu(repmat(A, 3, 2)) == Approx(accu(R)) );
+  REQUIRE( accu(repmat(A, 0, 2)) == Approx(0.0)     );
+
+  REQUIRE( accu(abs( sum(repmat(A, 3, 2), 0) - sum(R, 0) )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( accu(abs( sum(repmat(A, 3, 2), 1) - sum(R, 1) )) == Approx(0.0).epsilon(0.01) );
+
+  REQUIRE( accu(abs( sum(repmat(A, 0, 2), 0) - sum(R0, 0) )) == Approx(0.0).epsilon(0.01) );
+  REQUIRE( size(sum(repmat(A, 0, 2), 1)) == size(sum(R0, 1)) );
+
+  REQUIRE( accu(abs( max(repmat(A.cols(1,2), 2, 3)) - max(repmat(mat(A.cols(1,2)), 2, 3)) )) == Approx(0.0).epsilon(0.01) );
+
+  mat X = A;
+
+  X = sum(repmat(X, 3, 2), 1);
+
+  REQUIRE( accu(abs( X - sum(R, 1) )) == Approx(0.0).epsilon(0.01) );
+
+  imat B = randi<imat>(4, 3, distr_param(-9, 9));
+
+  REQUIRE( accu(repmat(B, 2, 5)) == 10*accu(B) );
+  }
@@ -450,3 +450,57 @@ TEST_CASE("fn_min_sp_cx_incomplete_subview_row_min_test")
       }
     }
   }
+
+
+
+TEST_CASE("fn_min_dense_dim_test")
+  {
+  // sizes large enough for the multi-threaded paths, and not multiples of the unrolling factors
+  
+  mat X(1031, 517, fill::randu);
+  
+  // ties: the lowest index wins
+  
+  X(17,3) = X(18,3) = X(700,3) = -1.0;
+  X(9,10) = X(9,400) = -1.0;
+  
+  rowvec ref_col_vals(X.n_cols);  urowvec ref_col_idx(X.n_cols);
+  colvec ref_row_vals(X.n_rows);  ucolvec ref_row_idx(X.n_rows);
+  
+  for(uword c=0; c < X.n_cols; ++c)
+    {
+    uword best = 0;
+    
+    for(uword r=1; r < X.n_rows; ++r)  { if(X(r,c) < X(best,c))  { best = r; } }
+    
+    ref_col_vals(c) = X(best,c);  ref_col_idx(c) = best;
+    }
+  
+  for(uword r=0; r < X.n_rows; ++r)
+    {
+    uword best = 0;
+    
+    for(uword c=1; c < X.n_cols; ++c)  { if(X(r,c) < X(r,best))  { best = c; } }
+    
+    ref_row_vals(r) = X(r,best);  ref_row_idx(r) = best;
+    }
+  
+  REQUIRE( all(min(X,0) == ref_col_vals) );
+  REQUIRE( all(min(X,1) == ref_row_vals) );
+  
+  REQUIRE( all(index_min(X,0) == ref_col_idx) );
+  REQUIRE( all(index_min(X,1) == ref_row_idx) );
+  
+  REQUIRE( ref_col_idx(3) == 17 );
+  REQUIRE( ref_row_idx(9) == 10 );
+  
+  REQUIRE( index_min(X.col(3)) == X.col(3).index_min() );
+  REQUIRE( min(vectorise(X)) == min(min(X,1)) );
+  
+  // NaN as the first element is skipped by the index functions
+  
+  mat Y = { { datum::nan, 2.0, 1.0, 3.0, -1.0 } };
+  
+  REQUIRE( umat(index_min(Y,1))(0)     == 4 );
+  REQUIRE( umat(index_min(Y.t(),0))(0) == 4 );
+  }
@@ -0,0 +1,207 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_qmul_1")
+  {
+  // products of s8 values accumulate beyond the range of s8
+  
+  Mat<s8> A(37, 70);  A.fill(s8(100));
+  Mat<s8> B(70, 45);  B.fill(s8(-100));
+  
+  A(3,4) = s8(-128);
+  B(4,5) = s8(127);
+  
+  Mat<s32> C = qmul(A, B);
+  
+  Mat<s32> C_ref = conv_to< Mat<s32> >::from( conv_to<mat>::from(A) * conv_to<mat>::from(B) );
+  
+  REQUIRE( C.n_rows == 37 );
+  REQUIRE( C.n_cols == 45 );
+  
+  REQUIRE( accu(C != C_ref) == uword(0) );
+  }
+
+
+
+TEST_CASE("fn_qmul_2")
+  {
+  // u8 x s8, with sizes that are not multiples of the internal block sizes
+  
+  imat A_tmp = randi<imat>(131, 77, distr_param(0,    255));
+  imat B_tmp = randi<imat>( 77, 29, distr_param(-128, 127));
+  
+  Mat<u8> A = conv_to< Mat<u8> >::from(A_tmp);
+  Mat<s8> B = conv_to< Mat<s8> >::from(B_tmp);
+  
+  Mat<s32> C = qmul(A, B);
+  
+  Mat<s32> C_ref = conv_to< Mat<s32> >::from( conv_to<mat>::from(A) * conv_to<mat>::from(B) );
+  
+  REQUIRE( accu(C != C_ref) == uword(0) );
+  
+  Mat<s32> D = qmul(A.cols(0,9), B.rows(0,9));
+  
+  Mat<s32> D_ref = conv_to< Mat<s32> >::from( conv_to<mat>::from(A.cols(0,9)) * conv_to<mat>::from(B.rows(0,9)) );
+  
+  REQUIRE( accu(D != D_ref) == uword(0) );
+  }
+
+
+
+TEST_CASE("fn_qmul_3")
+  {
+  // s16 x s16 with worst-case values; the sums exceed the range of s32
+  
+  Mat<s16> A(3, 4);  A.fill(s16(-32768));
+  Mat<s16> B(4, 2);  B.fill(s16(-32768));
+  
+  B(0,1) = s16(32767);
+  B(1,1) = s16(32767);
+  B(2,1) = s16(32767);
+  B(3,1) = s16(32767);
+  
+  Mat<s32> C = qmul(A, B);
+  
+  REQUIRE( accu(C.col(0) != std::numeric_limits<s32>::max()) == uword(0) );
+  REQUIRE( accu(C.col(1) != std::numeric_limits<s32>::min()) == uword(0) );
+  
+  mat D = qmul(A, mat(1,1,fill::ones), B, mat(1,1,fill::ones));
+  
+  REQUIRE( D(0,0) == Approx( 4.0 * 32768.0 *  32768.0) );
+  REQUIRE( D(2,1) == Approx(-4.0 * 32768.0 *  32767.0) );
+  
+  imat A_tmp = randi<imat>(40, 57, distr_param(-32768, 32767));
+  imat B_tmp = randi<imat>(57, 11, distr_param(-10,    10   ));
+  
+  Mat<s16> E = conv_to< Mat<s16> >::from(A_tmp);
+  Mat<s16> F = conv_to< Mat<s16> >::from(B_tmp);
+  
+  Mat<s32> G     = qmul(E, F);
+  Mat<s32> G_ref = conv_to< Mat<s32> >::from( conv_to<mat>::from(E) * conv_to<mat>::from(F) );
+  
+  REQUIRE( accu(G != G_ref) == uword(0) );
+  }
+
+
+
+TEST_CASE("fn_qmul_4")
+  {
+  // u8 x u8 with an inner dimension beyond 33025; the sums of 255*255 exceed the range of s32
+  
+  const uword K = 40000;
+  
+  Mat<u8> A(2, K);  A.fill(u8(255));
+  Mat<u8> B(K, 2);  B.fill(u8(255));
+  
+  A.row(1).fill(u8(1));
+  
+  Mat<s32> C = qmul(A, B);
+  
+  REQUIRE( C(0,0) == std::numeric_limits<s32>::max() );
+  REQUIRE( C(1,0) == s32(K * 255)                     );
+  
+  mat D = qmul(A, mat(1,1,fill::ones), B, mat(1,1,fill::ones));
+  
+  REQUIRE( D(0,1) == Approx(double(K) * 255.0 * 255.0) );
+  REQUIRE( D(1,1) == Approx(double(K) * 255.0)         );
+  }
+
+
+TEST_CASE("fn_quantise_1")
+  {
+  fmat X = randn<fmat>(40, 12);
+  
+  Mat<s8> Q;
+  fmat    scales;
+  
+  REQUIRE( quantise(Q, scales, X) );
+  
+  REQUIRE( scales.n_rows == 1  );
+  REQUIRE( scales.n_cols == 12 );
+  
+  fmat Y = dequantise(Q, scales);
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    REQUIRE( max(abs(Q.col(col))) == s8(127) );
+    REQUIRE( max(abs(X.col(col) - Y.col(col))) <= (0.501f * scales(col)) );
+    }
+  }
+
+
+
+TEST_CASE("fn_quantise_2")
+  {
+  mat X = randu<mat>(10, 30) - 0.25;
+  
+  Mat<u8>  Q;
+  mat      scales;
+  Mat<s32> zero_points;
+  
+  REQUIRE( quantise(Q, scales, zero_points, X, 1) );
+  
+  REQUIRE( scales.n_rows      == 10 );
+  REQUIRE( scales.n_cols      == 1  );
+  REQUIRE( zero_points.n_rows == 10 );
+  
+  mat Y = dequantise(Q, scales, zero_points, 1);
+  
+  for(uword row=0; row < X.n_rows; ++row)
+    {
+    REQUIRE( max(abs(X.row(row) - Y.row(row))) <= (0.501 * scales(row)) );
+    }
+  
+  X(3,3) = datum::nan;
+  
+  REQUIRE( quantise(Q, scales, zero_points, X) == false );
+  }
+
+
+
+TEST_CASE("fn_qmul_dequant_1")
+  {
+  fmat X = randu<fmat>(20, 64);
+  fmat W = randn<fmat>(64, 15);
+  
+  Mat<u8>  QX;  fmat X_scales;  Mat<s32> X_zero_points;
+  Mat<s8>  QW;  fmat W_scales;
+  
+  REQUIRE( quantise(QX, X_scales, X_zero_points, X, 1) );
+  REQUIRE( quantise(QW, W_scales, W) );
+  
+  fmat C = qmul(QX, X_scales, X_zero_points, QW, W_scales, Mat<s32>());
+  
+  fmat C_ref = dequantise(QX, X_scales, X_zero_points, 1) * dequantise(QW, W_scales);
+  
+  REQUIRE( C.n_rows == 20 );
+  REQUIRE( C.n_cols == 15 );
+  
+  REQUIRE( max(max(abs(C - C_ref))) <= 1e-3f * max(max(abs(C_ref))) );
+  
+  fmat D = qmul(QW.t(), fmat(W_scales.t()), QW, W_scales);
+  
+  fmat D_ref = dequantise(QW, W_scales).t() * dequantise(QW, W_scales);
+  
+  REQUIRE( max(max(abs(D - D_ref))) <= 1e-3f * max(max(abs(D_ref))) );
+  
+  REQUIRE( max(max(abs(C - X*W))) <= 0.05f * max(max(abs(X*W))) );
+  }
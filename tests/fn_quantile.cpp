@@ -0,0 +1,70 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_quantile_1")
+  {
+  vec V = { 3, 1, 4, 1, 5, 9, 2, 6 };
+  vec P = { 0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0 };
+  
+  vec Q = { 1.0, 1.0, 1.5, 3.5, 5.5, 8.1, 9.0 };
+  
+  REQUIRE( accu(abs(quantile(V,     P    ) - Q    )) == Approx(0.0) );
+  REQUIRE( accu(abs(quantile(V.t(), P.t()) - Q.t())) == Approx(0.0) );
+  
+  REQUIRE( as_scalar(quantile(V, vec{0.5})) == Approx(median(V)) );
+  
+  rowvec R;
+  REQUIRE_THROWS( R = quantile(V, P) );
+  }
+
+
+
+TEST_CASE("fn_quantile_2")
+  {
+  mat A =
+    {
+    { -0.78838,  0.69298,  0.41084,  0.90142 },
+    {  0.49345, -0.12020,  0.78987,  0.53124 },
+    {  0.73573,  0.52104, -0.22263,  0.40163 },
+    { -0.04591,  0.19283,  0.37021, -0.88231 }
+    };
+  
+  vec P = { 0.0, 0.5, 1.0 };
+  
+  mat Q0 = quantile(A, P);
+  mat Q1 = quantile(A, P, 1);
+  
+  REQUIRE( Q0.n_rows == 3 );
+  REQUIRE( Q0.n_cols == 4 );
+  REQUIRE( Q1.n_rows == 4 );
+  REQUIRE( Q1.n_cols == 3 );
+  
+  REQUIRE( accu(abs(Q0.row(0) - min(A)   )) == Approx(0.0) );
+  REQUIRE( accu(abs(Q0.row(1) - median(A))) == Approx(0.0) );
+  REQUIRE( accu(abs(Q0.row(2) - max(A)   )) == Approx(0.0) );
+  
+  REQUIRE( accu(abs(Q1.col(0) - min(A,1)   )) == Approx(0.0) );
+  REQUIRE( accu(abs(Q1.col(1) - median(A,1))) == Approx(0.0) );
+  REQUIRE( accu(abs(Q1.col(2) - max(A,1)   )) == Approx(0.0) );
+  
+  REQUIRE_THROWS( Q0 = quantile(A, vec{1.5}) );
+  }
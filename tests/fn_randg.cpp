@@ -0,0 +1,119 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("fn_randg_1")
+  {
+  const uword N = 100000;
+  
+  vec a = randg<vec>(N, distr_param(2.5, 1.5));
+  vec b = randg<vec>(N, distr_param(0.5, 2.0));
+  
+  REQUIRE( a.min() > 0.0 );
+  REQUIRE( b.min() > 0.0 );
+  
+  REQUIRE( mean(a) == Approx(2.5*1.5    ).epsilon(0.02) );
+  REQUIRE( var(a)  == Approx(2.5*1.5*1.5).epsilon(0.05) );
+  
+  REQUIRE( mean(b) == Approx(0.5*2.0    ).epsilon(0.03) );
+  REQUIRE( var(b)  == Approx(0.5*2.0*2.0).epsilon(0.08) );
+  
+  fcube c = randg<fcube>(20, 30, 40, distr_param(3.0, 1.0));
+  
+  REQUIRE( mean(vectorise(c)) == Approx(3.0f).epsilon(0.03) );
+  
+  // the same seed gives the same values
+  
+  arma_rng::set_seed(7);  vec x = randg<vec>(10000);
+  arma_rng::set_seed(7);  vec y = randg<vec>(10000);
+  
+  REQUIRE( accu(x != y) == 0 );
+  }
+
+
+
+TEST_CASE("fn_chi2rnd_1")
+  {
+  const uword N = 100000;
+  
+  vec a = chi2rnd(4.0, N, 1);
+  
+  REQUIRE( mean(a) == Approx(4.0).epsilon(0.02) );
+  REQUIRE( var(a)  == Approx(8.0).epsilon(0.05) );
+  
+  vec df = linspace<vec>(1, 10, N);
+  
+  vec b = chi2rnd(df);
+  
+  REQUIRE( b.min() > 0.0 );
+  REQUIRE( mean(b) == Approx(mean(df)).epsilon(0.02) );
+  
+  vec c = chi2rnd( vec({ 2.0, -1.0, 0.0, 3.0 }) );
+  
+  REQUIRE( std::isfinite(c(0)) );
+  REQUIRE( std::isnan   (c(1)) );
+  REQUIRE( std::isnan   (c(2)) );
+  REQUIRE( std::isfinite(c(3)) );
+  }
+
+
+
+TEST_CASE("fn_mvnrnd_1")
+  {
+  vec M = { 1.0, -2.0, 3.0 };
+  
+  mat B = { { 1.0, 0.0, 0.0 }, { 0.5, 2.0, 0.0 }, { -0.3, 0.2, 0.7 } };
+  mat C = B * B.t();
+  mat D = chol(C);
+  
+  arma_rng::set_seed(11);  mat X = mvnrnd(M, C, 1000);
+  arma_rng::set_seed(11);  mat Y = mvnrnd(M, C, 1000, D);
+  
+  REQUIRE( Y.n_rows == 3    );
+  REQUIRE( Y.n_cols == 1000 );
+  
+  REQUIRE( norm(X - Y, "inf") == Approx(0.0).margin(1e-10) );
+  
+  mat Z;
+  
+  REQUIRE( mvnrnd(Z, M, C, 100000, D) );
+  
+  REQUIRE( norm(mean(Z,1) - M, "inf") < 0.05 );
+  REQUIRE( norm(cov(Z.t()) - C, "inf") < 0.05 );
+  }
+
+
+
+TEST_CASE("fn_wishrnd_1")
+  {
+  mat S = { { 2.0, 0.5 }, { 0.5, 1.0 } };
+  
+  const double df = 5.5;
+  
+  mat acc(2, 2, fill::zeros);
+  
+  const uword n = 20000;
+  
+  for(uword i=0; i < n; ++i)  { acc += wishrnd(S, df); }
+  
+  REQUIRE( norm(acc/double(n) - df*S, "inf") < 0.15 );
+  }
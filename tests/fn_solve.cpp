@@ -0,0 +1,183 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("fn_solve_mixed_1")
+  {
+  const uword N = 300;
+  
+  arma_rng::set_seed(123);
+  
+  mat A = randu<mat>(N,N);
+  A.diag() += double(N);
+  
+  mat B = randu<mat>(N,4);
+  
+  mat X1 = solve(A, B);
+  mat X2 = solve(A, B, solve_opts::mixed);
+  
+  REQUIRE( X2.n_rows == N );
+  REQUIRE( X2.n_cols == 4 );
+  
+  REQUIRE( norm(X1 - X2, "inf") <= 1e-12 * norm(X1, "inf") );
+  
+  // symmetric positive definite: Cholesky decomposition in lower precision
+  
+  mat S = A.t() * A;
+  
+  mat Y1 = solve(S, B);
+  mat Y2 = solve(S, B, solve_opts::mixed + solve_opts::fast);
+  mat Y3 = solve(S, B, solve_opts::mixed + solve_opts::no_sympd);
+  
+  REQUIRE( norm(Y1 - Y2, "inf") <= 1e-12 * norm(Y1, "inf") );
+  REQUIRE( norm(Y1 - Y3, "inf") <= 1e-12 * norm(Y1, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_mixed_2")
+  {
+  const uword N = 200;
+  
+  arma_rng::set_seed(123);
+  
+  cx_mat A = randu<cx_mat>(N,N);
+  A.diag() += cx_double(N);
+  
+  cx_mat B = randu<cx_mat>(N,2);
+  
+  cx_mat X1 = solve(A, B);
+  cx_mat X2 = solve(A, B, solve_opts::mixed);
+  
+  REQUIRE( norm(X1 - X2, "inf") <= 1e-12 * norm(X1, "inf") );
+  
+  cx_mat H = A.t() * A;
+  
+  cx_mat Y1 = solve(H, B);
+  cx_mat Y2 = solve(H, B, solve_opts::mixed);
+  
+  REQUIRE( norm(Y1 - Y2, "inf") <= 1e-12 * norm(Y1, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_mixed_3")
+  {
+  // Hilbert matrix: too poorly conditioned for single precision,
+  // so the system must be solved in double precision instead
+  
+  const uword N = 10;
+  
+  mat A(N,N);
+  
+  for(uword col=0; col < N; ++col)
+  for(uword row=0; row < N; ++row)
+    {
+    A(row,col) = 1.0 / double(row + col + 1);
+    }
+  
+  vec b = ones<vec>(N);
+  
+  vec x1 = solve(A, b, solve_opts::fast);
+  vec x2 = solve(A, b, solve_opts::fast + solve_opts::mixed);
+  
+  REQUIRE( norm(x1 - x2) <= 1e-10 * norm(x1) );
+  
+  // aliasing, and float elements (no lower precision available)
+  
+  mat C = 2.0 * eye<mat>(N,N);
+  mat D = ones<mat>(N,3);
+  
+  D = solve(C, D, solve_opts::mixed);
+  
+  REQUIRE( accu(abs(D - 0.5)) == Approx(0.0) );
+  
+  fmat E = 4.0 * eye<fmat>(N,N);
+  fvec e = ones<fvec>(N);
+  
+  fvec y = solve(E, e, solve_opts::mixed);
+  
+  REQUIRE( accu(abs(y - 0.25)) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("fn_solve_mixed_4")
+  {
+  // Wilkinson-type matrix: the growth of the LU factors in single precision
+  // stalls the refinement, so the system is solved again in double precision;
+  // when B is an alias of the output, this must not see a partially computed solution
+  
+  const uword N = 60;
+  
+  mat A = eye<mat>(N,N);
+  
+  for(uword col=0; col < N; ++col)
+  for(uword row=col+1; row < N; ++row)
+    {
+    A(row,col) = -1.0;
+    }
+  
+  A.col(N-1).ones();
+  
+  arma_rng::set_seed(123);
+  
+  mat B = randu<mat>(N,2);
+  
+  mat X1 = solve(A, B);
+  mat X2 = B;
+  
+  X2 = solve(A, X2, solve_opts::mixed);
+  
+  REQUIRE( norm(X1 - X2, "inf") <= 1e-12 * norm(X1, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_mixed_5")
+  {
+  const uword N = 200;
+  
+  arma_rng::set_seed(123);
+  
+  mat A = randu<mat>(N,N);
+  A.diag() += double(N);
+  
+  vec b = randu<vec>(N);
+  
+  vec    x;
+  double rcond  = 0.0;
+  uword  n_iter = 0;
+  
+  REQUIRE( solve(x, rcond, n_iter, A, b, solve_opts::mixed) );
+  
+  REQUIRE( rcond  >  0.0    );
+  REQUIRE( n_iter >  0      );
+  REQUIRE( n_iter <= 30     );
+  
+  REQUIRE( norm(A*x - b) <= 1e-10 * norm(b) );
+  
+  REQUIRE( solve(x, rcond, n_iter, A, b) );
+  
+  REQUIRE( rcond  >  0.0    );
+  REQUIRE( n_iter == 0      );
+  }
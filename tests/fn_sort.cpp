@@ -0,0 +1,75 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_sort_1")
+  {
+  vec x = linspace<vec>(-1, 1, 10001);
+  
+  vec y = shuffle(x);
+  
+  REQUIRE( accu(abs(sort(y) - x)) == Approx(0.0) );
+  
+  REQUIRE( accu(abs(sort(y, "descend") - flipud(x))) == Approx(0.0) );
+  
+  uvec indices = sort_index(y);
+  
+  REQUIRE( accu(abs(y.elem(indices) - x)) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("fn_sort_2")
+  {
+  ivec x = randi<ivec>(20000, distr_param(-50, 50));
+  
+  ivec y = sort(x);
+  
+  for(uword i=1; i < y.n_elem; ++i)  { REQUIRE( y(i-1) <= y(i) ); }
+  
+  uvec indices = stable_sort_index(x);
+  
+  for(uword i=1; i < indices.n_elem; ++i)
+    {
+    const sword a = x(indices(i-1));
+    const sword b = x(indices(i  ));
+    
+    REQUIRE( a <= b );
+    
+    if(a == b)  { REQUIRE( indices(i-1) < indices(i) ); }
+    }
+  
+  REQUIRE( unique(x).eval().n_elem == 101 );
+  }
+
+
+
+TEST_CASE("fn_sort_3")
+  {
+  vec x = randn<vec>(10000);
+  
+  x(123) = datum::nan;
+  
+  uvec indices;
+  
+  REQUIRE_THROWS( indices = sort_index(x) );
+  }
+
@@ -95,6 +95,31 @@ TEST_CASE("sum4")
 
 
 
+TEST_CASE("sum5")
+  {
+  // sizes large enough for the multi-threaded paths, and not multiples of the unrolling factors
+  
+  mat X(1031, 517, fill::randu);
+  
+  rowvec ref_col_sums(X.n_cols, fill::zeros);
+  colvec ref_row_sums(X.n_rows, fill::zeros);
+  
+  for(uword c=0; c < X.n_cols; ++c)
+  for(uword r=0; r < X.n_rows; ++r)
+    {
+    ref_col_sums(c) += X(r,c);
+    ref_row_sums(r) += X(r,c);
+    }
+  
+  REQUIRE( abs(sum(X,0) - ref_col_sums).max() < 1e-9 );
+  REQUIRE( abs(sum(X,1) - ref_row_sums).max() < 1e-9 );
+  
+  REQUIRE( abs(mean(X,0) - ref_col_sums/double(X.n_rows)).max() < 1e-12 );
+  REQUIRE( abs(mean(X,1) - ref_row_sums/double(X.n_cols)).max() < 1e-12 );
+  }
+
+
+
 TEST_CASE("sum_spmat")
   {
   SpCol<double> a(5);
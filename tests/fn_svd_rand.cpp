@@ -0,0 +1,91 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("fn_svd_rand_1")
+  {
+  arma_rng::set_seed(123);
+  
+  // rank 8 matrix: with the default oversampling the range is found exactly
+  
+  mat X = randn<mat>(500,8) * randn<mat>(8,120);
+  
+  vec s0 = svd(X);
+  
+  mat U;
+  vec s;
+  mat V;
+  
+  REQUIRE( svd_rand(U, s, V, X, 5) );
+  
+  REQUIRE( U.n_rows == 500 );
+  REQUIRE( U.n_cols ==   5 );
+  REQUIRE( s.n_elem ==   5 );
+  REQUIRE( V.n_rows == 120 );
+  REQUIRE( V.n_cols ==   5 );
+  
+  REQUIRE( max(abs(s - s0.head(5))) <= 1e-8 * s0(0) );
+  
+  REQUIRE( norm(X*V - U*diagmat(s)) <= 1e-8 * s0(0) );
+  
+  REQUIRE( norm(U.t()*U - eye<mat>(5,5)) <= 1e-10 );
+  
+  vec s1 = svd_rand(X, 3, 10, 0);
+  
+  REQUIRE( max(abs(s1 - s0.head(3))) <= 1e-8 * s0(0) );
+  
+  cx_mat Z = randn<cx_mat>(60,4) * randn<cx_mat>(4,90);
+  
+  vec t0 = svd(Z);
+  vec t1 = svd_rand(Z, 2);
+  
+  REQUIRE( max(abs(t1 - t0.head(2))) <= 1e-8 * t0(0) );
+  }
+
+
+
+TEST_CASE("fn_eig_sym_rand_1")
+  {
+  arma_rng::set_seed(123);
+  
+  mat Y = randn<mat>(200,6);
+  mat A = Y * diagmat(vec({-9.0, -1.0, 2.0, 3.0, 5.0, 7.0})) * Y.t();
+  
+  vec e0 = eig_sym(A);
+  
+  vec e1;
+  mat E1;
+  
+  REQUIRE( eig_sym_rand(e1, E1, A, 3) );
+  
+  REQUIRE( e1.n_elem ==   3 );
+  REQUIRE( E1.n_rows == 200 );
+  REQUIRE( E1.n_cols ==   3 );
+  
+  // largest magnitude, in ascending order: the most negative and the two largest eigenvalues
+  
+  REQUIRE( e1(0) == Approx(e0(0))   );
+  REQUIRE( e1(1) == Approx(e0(198)) );
+  REQUIRE( e1(2) == Approx(e0(199)) );
+  
+  REQUIRE( norm(A*E1 - E1*diagmat(e1)) <= 1e-8 * std::abs(e0(0)) );
+  }
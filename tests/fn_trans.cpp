@@ -619,3 +619,67 @@ TEST_CASE("op_trans_sp_cxmat")
       }
     }
   }
+
+
+TEST_CASE("fn_trans_large")
+  {
+  // sizes large enough to use the tiled transposes, and not multiples of the tile size
+  
+  mat A = randu<mat>(300, 517);
+  
+  mat B = A.t();
+  
+  REQUIRE( B.n_rows == A.n_cols );
+  REQUIRE( B.n_cols == A.n_rows );
+  
+  bool ok = true;
+  
+  for(uword c=0; c < A.n_cols; ++c)
+  for(uword r=0; r < A.n_rows; ++r)
+    {
+    ok = ok && (B(c,r) == A(r,c));
+    }
+  
+  REQUIRE( ok );
+  
+  cx_mat X = randu<cx_mat>(260, 260);
+  cx_mat Y = X;
+  
+  inplace_trans(Y);
+  
+  REQUIRE( accu(Y != trans(X)) == uword(0) );
+  REQUIRE( accu(Y != conj(X.st())) == uword(0) );
+  
+  inplace_strans(Y);
+  
+  REQUIRE( accu(Y != conj(X)) == uword(0) );
+  }
+
+
+
+TEST_CASE("fn_inplace_strans_lowmem")
+  {
+  const uword sizes[][2] = { {1,7}, {7,1}, {4,6}, {6,4}, {5,5}, {12,18}, {9,24}, {24,9}, {17,31}, {64,100} };
+  
+  for(uword i=0; i < sizeof(sizes)/sizeof(sizes[0]); ++i)
+    {
+    mat A = randu<mat>(sizes[i][0], sizes[i][1]);
+    
+    mat B = A;
+    
+    inplace_strans(B, "lowmem");
+    
+    REQUIRE( B.n_rows == A.n_cols );
+    REQUIRE( B.n_cols == A.n_rows );
+    
+    REQUIRE( accu(B != A.t()) == uword(0) );
+    
+    cx_mat X = randu<cx_mat>(sizes[i][0], sizes[i][1]);
+    
+    cx_mat Y = X;
+    
+    inplace_trans(Y, "lowmem");
+    
+    REQUIRE( accu(Y != X.t()) == uword(0) );
+    }
+  }
@@ -547,3 +547,52 @@ TEST_CASE("fn_var_sparse_alias_test")
     REQUIRE( d[i] == Approx((double) s[i]) );
     }
   }
+
+
+
+TEST_CASE("fn_var_dense_test")
+  {
+  // large offset relative to the spread; sizes not multiples of the unrolling factors
+  
+  mat X(517, 1031, fill::randu);
+  
+  X = 1e6 + 1000.0*X;
+  
+  rowvec ref_cols(X.n_cols);
+  colvec ref_rows(X.n_rows);
+  
+  for(uword c=0; c < X.n_cols; ++c)
+    {
+    const vec x = X.col(c);
+    
+    ref_cols(c) = accu(square(x - accu(x)/x.n_elem)) / (x.n_elem-1);
+    }
+  
+  for(uword r=0; r < X.n_rows; ++r)
+    {
+    const rowvec x = X.row(r);
+    
+    ref_rows(r) = accu(square(x - accu(x)/x.n_elem)) / (x.n_elem-1);
+    }
+  
+  REQUIRE( abs(var(X,0,0) - ref_cols).max() < 1e-6 );
+  REQUIRE( abs(var(X,0,1) - ref_rows).max() < 1e-6 );
+  
+  REQUIRE( abs(var(X,1,1) - ref_rows*(double(X.n_cols-1)/X.n_cols)).max() < 1e-6 );
+  
+  REQUIRE( abs(stddev(X,0,1) - sqrt(ref_rows)).max() < 1e-6 );
+  
+  // rows with non-finite intermediate results
+  
+  X(3,7) = datum::inf;
+  X(5,0) = 1e300;
+  X(5,1) = -1e300;
+  
+  const vec v = var(X,0,1);
+  
+  REQUIRE( std::isnan(v(3)) );
+  REQUIRE( std::isfinite(v(5)) == false );
+  REQUIRE( v(4) == Approx(ref_rows(4)) );
+  
+  REQUIRE( accu(abs(var(X.cols(0,0),0,1))) == 0.0 );
+  }
@@ -0,0 +1,186 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("mat_each_col_row_1")
+  {
+  mat A = randu<mat>(300, 200) + 1.0;
+  vec c = randu<vec>(300) + 1.0;
+  rowvec r = randu<rowvec>(200) + 1.0;
+  
+  mat B1 = A.each_col() + c;
+  mat B2 = A.each_col() - c;
+  mat B3 = c - A.each_col();
+  mat B4 = A.each_col() % c;
+  mat B5 = A.each_col() / c;
+  mat B6 = c / A.each_col();
+  
+  mat C1 = A.each_row() + r;
+  mat C2 = A.each_row() - r;
+  mat C3 = r - A.each_row();
+  mat C4 = A.each_row() % r;
+  mat C5 = A.each_row() / r;
+  mat C6 = r / A.each_row();
+  
+  mat Cm = repmat(c, 1, A.n_cols);
+  mat Rm = repmat(r, A.n_rows, 1);
+  
+  REQUIRE( accu(abs(B1 - (A + Cm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(B2 - (A - Cm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(B3 - (Cm - A))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(B4 - (A % Cm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(B5 - (A / Cm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(B6 - (Cm / A))) == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE( accu(abs(C1 - (A + Rm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(C2 - (A - Rm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(C3 - (Rm - A))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(C4 - (A % Rm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(C5 - (A / Rm))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(C6 - (Rm / A))) == Approx(0.0).margin(1e-10) );
+  
+  mat D = A;
+  
+  D.each_col() += c;  REQUIRE( accu(abs(D - B1)) == Approx(0.0).margin(1e-10) );
+  D.each_col() -= c;  REQUIRE( accu(abs(D - A )) == Approx(0.0).margin(1e-10) );
+  D.each_row() %= r;  REQUIRE( accu(abs(D - C4)) == Approx(0.0).margin(1e-10) );
+  D.each_row() /= r;  REQUIRE( accu(abs(D - A )) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("mat_each_col_row_2")
+  {
+  // the temporary result of the first operation is reused by the second
+  
+  mat A = randu<mat>(500, 100);
+  
+  vec mu = mean(A, 1);
+  vec sd = stddev(A, 0, 1);
+  
+  mat B = (A.each_col() - mu).each_col() / sd;
+  mat C = (A - repmat(mu, 1, A.n_cols)) / repmat(sd, 1, A.n_cols);
+  
+  REQUIRE( B.n_rows == A.n_rows );
+  REQUIRE( B.n_cols == A.n_cols );
+  
+  REQUIRE( accu(abs(B - C)) == Approx(0.0).margin(1e-10) );
+  
+  rowvec m2 = mean(A, 0);
+  
+  mat D = (A.each_row() - m2).each_row() % m2;
+  mat E = (A - repmat(m2, A.n_rows, 1)) % repmat(m2, A.n_rows, 1);
+  
+  REQUIRE( accu(abs(D - E)) == Approx(0.0).margin(1e-10) );
+  
+  mat F = mat(2.0 * A).each_col() + mu;
+  mat G = 2.0 * A + repmat(mu, 1, A.n_cols);
+  
+  REQUIRE( accu(abs(F - G)) == Approx(0.0).margin(1e-10) );
+  
+  mat H = mu / mat(A + 1.0).each_col();
+  mat K = repmat(mu, 1, A.n_cols) / (A + 1.0);
+  
+  REQUIRE( accu(abs(H - K)) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("mat_each_col_row_alias")
+  {
+  mat A = randu<mat>(50, 40);
+  
+  mat B = A.each_col() - A.col(0);
+  mat C = A - repmat(A.col(0), 1, A.n_cols);
+  
+  REQUIRE( accu(abs(B - C)) == Approx(0.0).margin(1e-10) );
+  
+  mat D = A;
+  
+  D.each_col() -= D.col(3);
+  
+  REQUIRE( accu(abs(D - (A.each_col() - A.col(3)))) == Approx(0.0).margin(1e-10) );
+  
+  D = A;
+  
+  D.each_row() /= D.row(0);
+  
+  REQUIRE( accu(abs(D - (A.each_row() / A.row(0)))) == Approx(0.0).margin(1e-10) );
+  
+  // temporaries using external memory must not be modified
+  
+  mat E = A;
+  
+  mat F = mat(E.memptr(), E.n_rows, E.n_cols, false, false).each_col() - A.col(0);
+  
+  REQUIRE( F.memptr() != E.memptr() );
+  REQUIRE( accu(abs(E - A)) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(F - C)) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("cube_each_slice_1")
+  {
+  cube Q = randu<cube>(20, 30, 40) + 1.0;
+  mat  M = randu<mat>(20, 30) + 1.0;
+  
+  cube R1 = Q.each_slice() + M;
+  cube R2 = M - Q.each_slice();
+  cube R3 = Q.each_slice() % M;
+  cube R4 = M / Q.each_slice();
+  
+  cube R5 = (Q.each_slice() - M).each_slice() / M;
+  
+  for(uword s=0; s < Q.n_slices; ++s)
+    {
+    REQUIRE( accu(abs(R1.slice(s) - (Q.slice(s) + M))) == Approx(0.0).margin(1e-10) );
+    REQUIRE( accu(abs(R2.slice(s) - (M - Q.slice(s)))) == Approx(0.0).margin(1e-10) );
+    REQUIRE( accu(abs(R3.slice(s) - (Q.slice(s) % M))) == Approx(0.0).margin(1e-10) );
+    REQUIRE( accu(abs(R4.slice(s) - (M / Q.slice(s)))) == Approx(0.0).margin(1e-10) );
+    REQUIRE( accu(abs(R5.slice(s) - ((Q.slice(s) - M) / M))) == Approx(0.0).margin(1e-10) );
+    }
+  
+  cube P = Q;
+  
+  P.each_slice() -= P.slice(2);
+  
+  for(uword s=0; s < Q.n_slices; ++s)
+    {
+    REQUIRE( accu(abs(P.slice(s) - (Q.slice(s) - Q.slice(2)))) == Approx(0.0).margin(1e-10) );
+    }
+  }
+
+
+
+TEST_CASE("cube_each_slice_alias")
+  {
+  // temporaries using external memory must not be modified
+  
+  mat A = randu<mat>(50, 40);
+  
+  cube Q(A.memptr(), 5, 10, 40, false, false);
+  cube R = cube(Q.memptr(), 5, 10, 40, false, false).each_slice() + Q.slice(0);
+  
+  REQUIRE( R.memptr() != Q.memptr() );
+  REQUIRE( accu(abs(Q.slice(1) - reshape(A.col(1), 5, 10))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(R.slice(1) - (Q.slice(1) + Q.slice(0)))) == Approx(0.0).margin(1e-10) );
+  }
@@ -0,0 +1,191 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+template<uword N>
+void
+check_fixed_sq()
+  {
+  typedef typename mat::template fixed<N,N> mat_type;
+  typedef typename vec::template fixed<N>   vec_type;
+  
+  mat_type A;  A.randu();  A.diag() += double(N);
+  mat_type B;  B.randu();
+  vec_type x;  x.randu();
+  
+  const mat AA(A);
+  const mat BB(B);
+  const vec xx(x);
+  
+  mat_type C = A * B;
+  vec_type y = A * x;
+  mat_type D = A.t() * B;
+  mat_type E = A * B.t();
+  mat_type F = A.t();
+  
+  mat_type Ai = inv(A);
+  mat_type X  = solve(A, B, solve_opts::fast);
+  mat_type S  = A.t() * A;
+  mat_type R  = chol(S);
+  mat_type L  = chol(S, "lower");
+  
+  REQUIRE( accu(abs(C - AA*BB))     == Approx(0.0) );
+  REQUIRE( accu(abs(y - AA*xx))     == Approx(0.0) );
+  REQUIRE( accu(abs(D - AA.t()*BB)) == Approx(0.0) );
+  REQUIRE( accu(abs(E - AA*BB.t())) == Approx(0.0) );
+  REQUIRE( accu(abs(F - AA.t()))    == Approx(0.0) );
+  
+  REQUIRE( norm(Ai - inv(AA)) / norm(inv(AA)) == Approx(0.0) );
+  REQUIRE( norm(X - solve(AA,BB)) / norm(X)   == Approx(0.0) );
+  REQUIRE( det(A) / det(AA)                   == Approx(1.0) );
+  REQUIRE( norm(R - chol(mat(S))) / norm(R)   == Approx(0.0) );
+  REQUIRE( norm(L - R.t()) / norm(L)          == Approx(0.0) );
+  
+  // only the triangle given by the layout is used
+  
+  mat_type T = S;
+  
+  T(0,N-1) += 0.5;
+  
+  REQUIRE( norm(mat_type(chol(T))          - chol(mat(T)))          / norm(R) == Approx(0.0) );
+  REQUIRE( norm(mat_type(chol(T, "lower")) - chol(mat(T), "lower")) / norm(L) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("mat_fixed_kernels_real")
+  {
+  check_fixed_sq<5>();
+  check_fixed_sq<6>();
+  check_fixed_sq<7>();
+  check_fixed_sq<12>();
+  check_fixed_sq<16>();
+  }
+
+
+
+TEST_CASE("mat_fixed_kernels_rect")
+  {
+  mat::fixed<3,7> A;  A.randu();
+  mat::fixed<7,5> B;  B.randu();
+  
+  mat::fixed<3,5> C = A * B;
+  mat::fixed<7,3> D = A.t();
+  mat::fixed<5,3> E = B.t() * A.t();
+  
+  rowvec::fixed<7> r;  r.randu();
+  
+  rowvec::fixed<5> s = r * B;
+  
+  REQUIRE( accu(abs(C - mat(A)*mat(B)))             == Approx(0.0) );
+  REQUIRE( accu(abs(D - mat(A).t()))                == Approx(0.0) );
+  REQUIRE( accu(abs(E - mat(B).t()*mat(A).t()))     == Approx(0.0) );
+  REQUIRE( accu(abs(s - rowvec(r)*mat(B)))          == Approx(0.0) );
+  
+  // small products, including transposes and scalar multipliers
+  
+  mat::fixed<4,3> P;  P.randu();
+  vec::fixed<4>   p;  p.randu();
+  vec::fixed<3>   q;  q.randu();
+  
+  vec::fixed<3>   u = P.t() * p;
+  vec::fixed<4>   v = 2.0 * P * q;
+  mat::fixed<3,3> W = P.t() * P;
+  
+  REQUIRE( accu(abs(u - mat(P).t()*vec(p)))     == Approx(0.0) );
+  REQUIRE( accu(abs(v - 2.0*mat(P)*vec(q)))     == Approx(0.0) );
+  REQUIRE( accu(abs(W - mat(P).t()*mat(P)))     == Approx(0.0) );
+  
+  // sizes above 16x16 are handled by the general code
+  
+  mat::fixed<20,20> G;  G.randu();  G.diag() += 20.0;
+  
+  mat::fixed<20,20> H = G * inv(G);
+  
+  REQUIRE( norm(H - eye<mat>(20,20)) == Approx(0.0).epsilon(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("mat_fixed_kernels_cx")
+  {
+  cx_mat::fixed<6,6> A;  A.randu();  A.diag() += cx_double(6.0, 0.0);
+  cx_mat::fixed<6,6> B;  B.randu();
+  
+  const cx_mat AA(A);
+  const cx_mat BB(B);
+  
+  cx_mat::fixed<6,6> C = A.t() * B;
+  cx_mat::fixed<6,6> D = A * B.t();
+  cx_mat::fixed<6,6> E = A.st();
+  cx_mat::fixed<6,6> X = solve(A, B, solve_opts::fast);
+  cx_mat::fixed<6,6> I = inv(A);
+  
+  cx_mat::fixed<3,5> P;  P.randu();
+  cx_vec::fixed<5>   p;  p.randu();
+  cx_vec::fixed<3>   q;  q.randu();
+  
+  cx_vec::fixed<3> u = P * p;
+  cx_vec::fixed<5> v = P.t() * q;
+  cx_mat::fixed<3,3> W = P * P.t();
+  
+  REQUIRE( accu(abs(u - cx_mat(P)*cx_vec(p)))       == Approx(0.0) );
+  REQUIRE( accu(abs(v - cx_mat(P).t()*cx_vec(q)))   == Approx(0.0) );
+  REQUIRE( accu(abs(W - cx_mat(P)*cx_mat(P).t()))   == Approx(0.0) );
+  
+  REQUIRE( accu(abs(C - AA.t()*BB)) == Approx(0.0) );
+  REQUIRE( accu(abs(D - AA*BB.t())) == Approx(0.0) );
+  REQUIRE( accu(abs(E - AA.st()))   == Approx(0.0) );
+  
+  REQUIRE( norm(X - solve(AA,BB)) / norm(X) == Approx(0.0) );
+  REQUIRE( norm(I - inv(AA)) / norm(I)      == Approx(0.0) );
+  REQUIRE( abs(det(A) / det(AA))            == Approx(1.0) );
+  }
+
+
+
+TEST_CASE("mat_fixed_kernels_alias")
+  {
+  mat::fixed<6,6> A;  A.randu();  A.diag() += 6.0;
+  mat::fixed<6,6> B;  B.randu();
+  
+  const mat AA(A);
+  const mat BB(B);
+  
+  B = solve(A, B, solve_opts::fast);
+  
+  REQUIRE( norm(B - solve(AA,BB)) / norm(B) == Approx(0.0) );
+  
+  A = inv(A);
+  
+  REQUIRE( norm(A - inv(AA)) / norm(A) == Approx(0.0) );
+  
+  // singular matrix: the general solver provides an approximate solution
+  
+  mat::fixed<6,6> Z;  Z.zeros();
+  vec::fixed<6>   b;  b.ones();
+  
+  vec x = solve(Z, b, solve_opts::fast);
+  
+  REQUIRE( accu(abs(x)) == Approx(0.0) );
+  
+  REQUIRE_THROWS( x = solve(Z, b, solve_opts::fast + solve_opts::no_approx) );
+  }
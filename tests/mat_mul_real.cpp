@@ -925,3 +925,108 @@ TEST_CASE("mat_mul_real_6")
 
 
 
+TEST_CASE("mat_mul_int_large")
+  {
+  // integer matrices are multiplied via the blocked emulation of gemm()
+  
+  mat A = round(10 * randn<mat>(70, 130));
+  mat B = round(10 * randn<mat>(130, 45));
+  
+  imat IA = conv_to<imat>::from(A);
+  imat IB = conv_to<imat>::from(B);
+  
+  mat C1 = conv_to<mat>::from( IA * IB );
+  mat C2 = conv_to<mat>::from( IA.t() * IA );
+  mat C3 = conv_to<mat>::from( IB * IB.t() );
+  mat C4 = conv_to<mat>::from( 2 * IA * IB );
+  
+  REQUIRE( accu(abs( C1 - A * B     )) == Approx(0.0) );
+  REQUIRE( accu(abs( C2 - A.t() * A )) == Approx(0.0) );
+  REQUIRE( accu(abs( C3 - B * B.t() )) == Approx(0.0) );
+  REQUIRE( accu(abs( C4 - 2 * A * B )) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("mat_mul_int_vec")
+  {
+  // integer matrix-vector products and dot products use the emulated (possibly multi-threaded) kernels
+  
+  mat A = round(10 * randn<mat>(700, 300));
+  vec x = round(10 * randn<vec>(300));
+  vec z = round(10 * randn<vec>(700));
+  
+  imat IA = conv_to<imat>::from(A);
+  ivec ix = conv_to<ivec>::from(x);
+  ivec iz = conv_to<ivec>::from(z);
+  
+  vec y1 = conv_to<vec>::from( IA * ix );
+  vec y2 = conv_to<vec>::from( IA.t() * iz );
+  vec y3 = conv_to<vec>::from( 3 * IA * ix );
+  
+  REQUIRE( accu(abs( y1 - A * x     )) == Approx(0.0) );
+  REQUIRE( accu(abs( y2 - A.t() * z )) == Approx(0.0) );
+  REQUIRE( accu(abs( y3 - 3 * A * x )) == Approx(0.0) );
+  
+  ivec p = randi<ivec>(100000, distr_param(-10,10));
+  ivec q = randi<ivec>(100000, distr_param(-10,10));
+  
+  REQUIRE( double(dot(p,q)) == Approx(double(accu(p % q))) );
+  }
+
+
+
+TEST_CASE("mat_mul_real_chain")
+  {
+  // chains of five or more matrices are ordered at run-time
+  
+  mat A = randu<mat>(30, 40);
+  mat B = randu<mat>(40,  5);
+  mat C = randu<mat>( 5, 50);
+  mat D = randu<mat>(50, 50);
+  vec x = randu<vec>(50);
+  
+  vec d1 = randu<vec>(40);
+  vec d2 = randu<vec>(50);
+  
+  mat S = randu<mat>(50, 50) + 50*eye<mat>(50, 50);
+  
+  mat P1 = A*B*C*D*x;
+  mat P2 = 2.0*A*B*C*D.t()*x;
+  mat P3 = A*diagmat(d1)*B*C*diagmat(d2)*D*x;
+  mat P4 = A*B*C*inv(S)*D*x;
+  mat P5 = A*B*C*D*inv(S)*x;
+  
+  // reference results, using one multiplication per statement
+  
+  mat AB  = A*B;
+  mat ABC = AB*C;
+  
+  mat Q1 = ABC*D;                 Q1 = Q1*x;
+  mat Q2 = ABC*D.t();             Q2 = 2.0*(Q2*x);
+  mat Q3 = A*diagmat(d1);         Q3 = Q3*B;  Q3 = Q3*C;  Q3 = Q3*diagmat(d2);  Q3 = Q3*D;  Q3 = Q3*x;
+  mat Q4 = ABC*solve(S, D*x);
+  mat Q5 = ABC*D;                 Q5 = Q5*solve(S, x);
+  
+  REQUIRE( P1.n_rows == 30 );
+  REQUIRE( P1.n_cols ==  1 );
+  
+  REQUIRE( norm(P1 - Q1) / norm(Q1) == Approx(0.0) );
+  REQUIRE( norm(P2 - Q2) / norm(Q2) == Approx(0.0) );
+  REQUIRE( norm(P3 - Q3) / norm(Q3) == Approx(0.0) );
+  REQUIRE( norm(P4 - Q4) / norm(Q4) == Approx(0.0) );
+  REQUIRE( norm(P5 - Q5) / norm(Q5) == Approx(0.0) );
+  
+  // aliasing between the output and the operands
+  
+  mat X  = randu<mat>(10, 10);
+  mat X0 = X;
+  
+  X = X*X.t()*X*X*X.t();
+  
+  mat Y = X0*X0.t();  Y = Y*X0;  Y = Y*X0;  Y = Y*X0.t();
+  
+  REQUIRE( norm(X - Y) / norm(Y) == Approx(0.0) );
+  
+  REQUIRE_THROWS( P1 = A*B*C*C*D*x );
+  }
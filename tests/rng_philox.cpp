@@ -0,0 +1,140 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("rng_philox_1")
+  {
+  // known answers from the Random123 test vectors for philox4x32-10
+  
+  u32 out[4];
+  
+  arma_rng_philox::gen_block(out, 0, 0, 0, 0);
+  
+  REQUIRE( out[0] == u32(0x6627e8d5) );
+  REQUIRE( out[1] == u32(0xe169c58d) );
+  REQUIRE( out[2] == u32(0xbc57ac4c) );
+  REQUIRE( out[3] == u32(0x9b00dbd8) );
+  
+  arma_rng_philox::gen_block(out, 0xffffffffffffffffULL, 0xffffffff, 0xffffffff, 0xffffffffffffffffULL);
+  
+  REQUIRE( out[0] == u32(0x408f276d) );
+  REQUIRE( out[1] == u32(0x41c83b0e) );
+  REQUIRE( out[2] == u32(0xa20bc7c6) );
+  REQUIRE( out[3] == u32(0x6d5451fd) );
+  
+  arma_rng_philox::gen_block(out, 0x85a308d3243f6a88ULL, 0x03707344, 0x13198a2e, 0x299f31d0a4093822ULL);
+  
+  REQUIRE( out[0] == u32(0xd16cfe09) );
+  REQUIRE( out[1] == u32(0x94fdcceb) );
+  REQUIRE( out[2] == u32(0x5001e420) );
+  REQUIRE( out[3] == u32(0x24126ea1) );
+  
+  // batched generation must match block-wise generation
+  
+  u32 batch[4*arma_rng_philox::batch_size];
+  
+  arma_rng_philox::gen_batch(batch, 0xfffffffffffffffdULL, 7, 3, 12345);
+  
+  for(uword j=0; j < arma_rng_philox::batch_size; ++j)
+    {
+    arma_rng_philox::gen_block(out, 0xfffffffffffffffdULL + u64(j), 7, 3, 12345);
+    
+    REQUIRE( batch[4*j + 0] == out[0] );
+    REQUIRE( batch[4*j + 3] == out[3] );
+    }
+  }
+
+
+
+TEST_CASE("rng_philox_2")
+  {
+  // bulk fills must be identical to fills split into parts,
+  // and hence must not depend on how the work is divided between threads
+  
+  const uword N = 100000;
+  
+  arma_rng_philox A;
+  arma_rng_philox B;
+  
+  A.set_seed(123);
+  B.set_seed(123);
+  
+  vec a(N);
+  vec b(N);
+  
+  A.randn_fill(a.memptr(), N);
+  
+  const uword n_per_batch = 2*arma_rng_philox::batch_size;
+  const uword n_head      = 10 * n_per_batch;
+  
+  B.randn_fill(b.memptr(),          n_head    );
+  B.randn_fill(b.memptr() + n_head, N - n_head);
+  
+  REQUIRE( accu(a != b) == 0 );
+  
+  REQUIRE( mean(a)   == Approx(0.0).margin(0.02) );
+  REQUIRE( stddev(a) == Approx(1.0).epsilon(0.02) );
+  
+  A.randu_fill(a.memptr(), N);
+  
+  REQUIRE( a.min() >= 0.0 );
+  REQUIRE( a.max() <  1.0 );
+  REQUIRE( mean(a) == Approx(0.5).epsilon(0.02) );
+  
+  ivec c(N);
+  
+  A.randi_fill(c.memptr(), N, -3, 5);
+  
+  REQUIRE( c.min() == -3 );
+  REQUIRE( c.max() ==  5 );
+  }
+
+
+
+TEST_CASE("rng_philox_3")
+  {
+  // different streams give different sequences; the same stream is reproducible
+  
+  arma_rng_philox A;
+  arma_rng_philox B;
+  
+  A.set_seed(42);  A.set_stream(1, 0);
+  B.set_seed(42);  B.set_stream(2, 0);
+  
+  vec a(1000);
+  vec b(1000);
+  
+  A.randu_fill(a.memptr(), a.n_elem);
+  B.randu_fill(b.memptr(), b.n_elem);
+  
+  REQUIRE( accu(a == b) == 0 );
+  
+  B.set_stream(1, 0);
+  B.randu_fill(b.memptr(), b.n_elem);
+  
+  REQUIRE( accu(a != b) == 0 );
+  
+  B.set_stream(1, 1);
+  B.randu_fill(b.memptr(), b.n_elem);
+  
+  REQUIRE( accu(a == b) == 0 );
+  }
@@ -0,0 +1,77 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("running_hist_1")
+  {
+  vec x = randn<vec>(10000);
+  
+  running_hist<double> A(50, -2.0, 2.0);
+  running_hist<double> B(50, -2.0, 2.0);
+  
+  A(x.head(3000));
+  
+  for(uword i=3000; i < x.n_elem; ++i)  { B(x(i)); }
+  
+  A.merge(B);
+  
+  REQUIRE( A.count()     == 10000 );
+  REQUIRE( A.underflow() == uword(accu(x < -2.0)) );
+  REQUIRE( A.overflow()  == uword(accu(x >  2.0)) );
+  
+  vec c = A.centers();
+  vec e = A.edges();
+  
+  REQUIRE( c.n_elem == 50 );
+  REQUIRE( e.n_elem == 51 );
+  
+  uvec h = histc(x, e);
+  
+  // histc() places values equal to the last edge into an extra bin
+  
+  REQUIRE( accu(A.counts().head(49) != h.head(49)) == 0 );
+  
+  running_hist<double> C(50, -1.0, 2.0);
+  
+  REQUIRE_THROWS( A.merge(C) );
+  }
+
+
+
+TEST_CASE("running_hist_2")
+  {
+  running_hist<double> A(3, 1.0, 1000.0, true);
+  
+  vec x = { 0.5, 2.0, 20.0, 200.0, 500.0, 2000.0 };
+  
+  A(x);
+  
+  uvec counts = A.counts();
+  
+  REQUIRE( counts(0)     == 1 );
+  REQUIRE( counts(1)     == 1 );
+  REQUIRE( counts(2)     == 2 );
+  REQUIRE( A.underflow() == 1 );
+  REQUIRE( A.overflow()  == 1 );
+  
+  REQUIRE( A.edges()(1) == Approx(10.0) );
+  }
+
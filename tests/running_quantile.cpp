@@ -0,0 +1,66 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("running_quantile_1")
+  {
+  running_quantile<double> A;
+  
+  A(1.0);
+  A(2.0);
+  A(3.0);
+  
+  REQUIRE( A.count()         == Approx(3.0) );
+  REQUIRE( A.min()           == Approx(1.0) );
+  REQUIRE( A.max()           == Approx(3.0) );
+  REQUIRE( A.median()        == Approx(2.0) );
+  REQUIRE( A.quantile(0.0)   == Approx(1.0) );
+  REQUIRE( A.quantile(1.0)   == Approx(3.0) );
+  
+  REQUIRE_THROWS( A.quantile(1.5) );
+  }
+
+
+
+TEST_CASE("running_quantile_2")
+  {
+  vec x = linspace<vec>(0, 1, 100001);
+  
+  x = shuffle(x);
+  
+  running_quantile<double> A;
+  running_quantile<double> B;
+  
+  for(uword i=0; i < 50000; ++i)  { A(x(i)); }
+  
+  B(x.tail(x.n_elem - 50000));
+  
+  A.merge(B);
+  
+  vec P = { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 };
+  
+  vec Q = A.quantile(P);
+  
+  REQUIRE( A.count() == Approx(100001.0) );
+  
+  REQUIRE( max(abs(Q - P)) < 0.01 );
+  }
+
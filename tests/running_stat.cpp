@@ -0,0 +1,123 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("running_stat_1")
+  {
+  vec x = linspace<vec>(-2, 3, 1001);
+  x = x % x;
+
+  running_stat<double> A;
+  running_stat<double> B;
+  running_stat<double> C;
+
+  for(uword i=0; i < x.n_elem; ++i)  { A(x(i)); }
+
+  B(x.head(300));
+  C(x.tail(701));
+
+  B.merge(C);
+
+  REQUIRE( B.count()  == Approx(A.count()) );
+  REQUIRE( B.mean()   == Approx(A.mean())  );
+  REQUIRE( B.var()    == Approx(A.var())   );
+  REQUIRE( B.var(1)   == Approx(A.var(1))  );
+  REQUIRE( B.min()    == Approx(A.min())   );
+  REQUIRE( B.max()    == Approx(A.max())   );
+
+  REQUIRE( B.mean()   == Approx(mean(x)) );
+  REQUIRE( B.var()    == Approx(var(x))  );
+  }
+
+
+
+TEST_CASE("running_stat_2")
+  {
+  running_stat<double> A;
+  running_stat<double> B;
+
+  A(1.0);
+  A(2.0);
+
+  A.merge(B);
+
+  REQUIRE( A.count() == Approx(2.0) );
+  REQUIRE( A.mean()  == Approx(1.5) );
+
+  B.merge(A);
+
+  REQUIRE( B.count() == Approx(2.0) );
+  REQUIRE( B.var()   == Approx(0.5) );
+  }
+
+
+
+TEST_CASE("running_stat_vec_1")
+  {
+  mat X =
+    {
+    { 0.061198, 0.201990, 0.019678, -0.493936, -0.126745,  0.051408 },
+    { 0.437242, 0.058956,-0.149362, -0.045465,  0.296153,  0.035437 },
+    {-0.492474,-0.031309, 0.314156,  0.419733,  0.068317, -0.454499 },
+    { 0.336352, 0.411541, 0.458476, -0.393139, -0.135040,  0.373833 }
+    };
+
+  running_stat_vec<vec> A(true);
+  running_stat_vec<vec> B(true);
+  running_stat_vec<vec> C(true);
+
+  for(uword i=0; i < X.n_cols; ++i)  { A(X.col(i)); }
+
+  B.batch(X.cols(0,1));
+  C.batch(X.cols(2,5));
+
+  B.merge(C);
+
+  REQUIRE( B.count() == Approx(A.count()) );
+
+  REQUIRE( accu(abs(B.mean() - A.mean())) == Approx(0.0) );
+  REQUIRE( accu(abs(B.var()  - A.var() )) == Approx(0.0) );
+  REQUIRE( accu(abs(B.cov()  - A.cov() )) == Approx(0.0) );
+  REQUIRE( accu(abs(B.min()  - A.min() )) == Approx(0.0) );
+  REQUIRE( accu(abs(B.max()  - A.max() )) == Approx(0.0) );
+
+  REQUIRE( accu(abs(B.cov() - cov(X.t()))) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("running_stat_vec_2")
+  {
+  mat X = randu<mat>(20, 3);
+
+  running_stat_vec<rowvec> A;
+  running_stat_vec<rowvec> B;
+
+  for(uword i=0; i < X.n_rows; ++i)  { A(X.row(i)); }
+
+  B.batch(X);
+
+  REQUIRE( B.mean().n_rows == 1 );
+  REQUIRE( B.mean().n_cols == 3 );
+
+  REQUIRE( accu(abs(B.mean() - A.mean())) == Approx(0.0) );
+  REQUIRE( accu(abs(B.var()  - A.var() )) == Approx(0.0) );
+  }